@@ -32,6 +32,10 @@
 #include "drivers/system.h"
 #include "drivers/dac.h"
 #include "drivers/adc.h"
+#include "drivers/audio_ram.h"
+#include "drivers/profiler.h"
+#include "drivers/scheduler.h"
+#include "drivers/tracer.h"
 #include "stmlib/utils/random.h"
 #include "stmlib/system/uid.h"
 #include "ui.h"
@@ -45,6 +49,9 @@ Dac dac;
 Adc adc;
 Ui ui;
 Processor processor;
+Profiler profiler;
+Tracer tracer;
+Scheduler scheduler;
 
 extern "C" {
   void HardFault_Handler(void) { while (1); }
@@ -54,18 +61,45 @@ extern "C" {
   void NMI_Handler(void) { }
   void SVC_Handler(void) { }
   void DebugMon_Handler(void) { }
-  void PendSV_Handler(void) { }
   void __cxa_pure_virtual() { while (1); }
   void assert_failed(uint8_t* file, uint32_t line) { while (1); }
 }
 
+void PollUi() { ui.Poll(); }
+void DrainTrace() { tracer.Drain(); }
+
+void DoUiEvents() {
+  // a save erases and programs the flash, far over the budget
+  if (ui.DoEvents())
+    scheduler.Exempt(TASK_EVENTS);
+}
+
+// budgets, in cycles per run: all run every millisecond. The tracer
+// then sends 2 records on average, of 100us each over SWO.
+const Task tasks[TASK_LAST] = {
+  { &PollUi, F_CPU / 1000 / 8 },
+  { &DoUiEvents, F_CPU / 1000 / 4 },
+  { &DrainTrace, F_CPU / 1000 / 4 },
+};
+
 void Init() {
+  // first, as the SRAM functions are not there before
+  InitAudioRam();
   sys.Init(F_CPU / SAMPLE_RATE - 1, true);
   system_clock.Init();
   adc.Init();
   ui.Init(&adc); // must be after adc
+#ifdef BLOCK_RENDERING
+  profiler.Init(F_CPU / SAMPLE_RATE * kBlockSize);
+#else
+  profiler.Init(F_CPU / SAMPLE_RATE);
+#endif
+  ui.set_profiler(&profiler);
+  scheduler.Init(tasks, &profiler);
+  ui.set_scheduler(&scheduler);
   dac.Init();
-  processor.Init(&ui, &adc, &dac);
+  tracer.Init();
+  processor.Init(&ui, &adc, &dac, &tracer);
   Random::Seed(GetUniqueId(1));
 
   sys.StartTimers();
@@ -74,29 +108,75 @@ void Init() {
 int main(void) {
   Init();
   while(1) {
-    ui.DoEvents();
+    scheduler.RunBackground();
     __WFI();
   }
 }
 
 extern "C" {
 
-  // slow timer for the UI
+  // slow timer for the UI, polled from PendSV, below every interrupt
   void SysTick_Handler() {
     system_clock.Tick();  // Tick global ms counter.
-    ui.Poll();
+    scheduler.Post(TASK_UI_POLL);
+    scheduler.Tick();
   }
 
+  void PendSV_Handler() {
+    scheduler.RunDeferred();
+  }
+
+#ifdef BLOCK_RENDERING
+
+  // the DAC's DMA is done with half of the buffer: render the next
+  // block into it
+  AUDIO_RAMFUNC void DMA1_Channel3_IRQHandler(void) {
+    uint8_t half;
+    // read the flags once, straight from the register
+    uint32_t flags = DMA1->ISR;
+    if (flags & DMA1_IT_HT3) {
+      half = 0;
+    } else if (flags & DMA1_IT_TC3) {
+      half = 1;
+    } else {
+      return;
+    }
+    DMA1->IFCR = DMA1_IT_GL3;
+    profiler.Start();
+
+    dac.StartBlock(half);
+    for (size_t i=0; i<kBlockSize; i++) {
+      adc.Scan();
+      profiler.Mark(PROFILE_SECTION_ADC);
+      processor.Process();
+      profiler.Mark(PROFILE_SECTION_PROCESS);
+      dac.Write();
+      profiler.Mark(PROFILE_SECTION_DAC);
+    }
+
+    profiler.Stop(DMA1->ISR & (DMA1_IT_HT3 | DMA1_IT_TC3));
+  }
+
+#else
+
   // fast timer for processing
-  void TIM1_UP_IRQHandler(void) {
-    if (TIM_GetITStatus(TIM1, TIM_IT_Update) == RESET) {
+  AUDIO_RAMFUNC void TIM1_UP_IRQHandler(void) {
+    if (!(TIM1->SR & TIM_IT_Update)) {
       return;
     }
-    TIM_ClearITPendingBit(TIM1, TIM_IT_Update);
+    TIM1->SR = static_cast<uint16_t>(~TIM_IT_Update);
+    profiler.Start();
 
     adc.Scan();
+    profiler.Mark(PROFILE_SECTION_ADC);
     processor.Process();
+    profiler.Mark(PROFILE_SECTION_PROCESS);
     dac.Write();
+    profiler.Mark(PROFILE_SECTION_DAC);
+
+    profiler.Stop(TIM1->SR & TIM_IT_Update);
   }
+
+#endif  // BLOCK_RENDERING
   
 }
@@ -0,0 +1,74 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Clock tracker for sync mode.
+
+#include "clock_tracker.h"
+
+namespace batumi {
+
+void ClockTracker::Init() {
+  for (uint8_t i=0; i<kClockHistorySize; i++)
+    history_[i] = 0;
+  head_ = 0;
+  num_intervals_ = 0;
+  fresh_ = false;
+  period_ = 0;
+}
+
+bool ClockTracker::Update() {
+  if (!fresh_)
+    return false;
+  fresh_ = false;
+
+  uint32_t estimate;
+  if (num_intervals_ < kClockHistorySize) {
+    // not enough history yet: follow the last interval
+    estimate = history_[(head_ + kClockHistorySize - 1) % kClockHistorySize];
+  } else {
+    // median of three: a single late or early edge is ignored
+    uint32_t a = history_[0], b = history_[1], c = history_[2];
+    if (a > b) { uint32_t t = a; a = b; b = t; }
+    if (b > c) { b = c; }
+    estimate = a > b ? a : b;
+  }
+
+  int32_t error = estimate - period_;
+  uint32_t tolerance = period_ >> kClockTempoChangeShift;
+  if (error > static_cast<int32_t>(tolerance) ||
+      error < -static_cast<int32_t>(tolerance)) {
+    // tempo change: jump to the new period
+    period_ = estimate;
+  } else {
+    // rounded to nearest, halves away from zero: a plain shift rounds
+    // towards minus infinity, and the period would drift short
+    int32_t rounding = (1 << (kClockSmoothingShift - 1)) - (error < 0);
+    period_ += (error + rounding) >> kClockSmoothingShift;
+  }
+  return true;
+}
+
+}  // namespace batumi
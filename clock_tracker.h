@@ -0,0 +1,81 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Clock tracker for sync mode: rejects outliers in the intervals between
+// the sync edges and smoothes the period.
+
+#ifndef BATUMI_CLOCK_TRACKER_H_
+#define BATUMI_CLOCK_TRACKER_H_
+
+#include "stmlib/stmlib.h"
+
+namespace batumi {
+
+// the period is the median of the last intervals...
+const uint8_t kClockHistorySize = 3;
+// ...smoothed unless it moves by more than 1/8 (tempo change)
+const uint8_t kClockTempoChangeShift = 3;
+const uint8_t kClockSmoothingShift = 2;
+
+class ClockTracker {
+ public:
+  ClockTracker() { }
+  ~ClockTracker() { }
+
+  void Init();
+
+  // interval between two edges, in 1/32 of a sample; audio rate, so it
+  // only records it
+  inline void Tap(uint32_t interval) {
+    history_[head_] = interval;
+    head_ = (head_ + 1) % kClockHistorySize;
+    if (num_intervals_ < kClockHistorySize)
+      num_intervals_++;
+    fresh_ = true;
+  }
+
+  // updates the period from the new intervals, at control rate; returns
+  // true when it changed
+  bool Update();
+
+  // period in 1/32 of a sample
+  inline uint32_t period() const {
+    return period_;
+  }
+
+ private:
+  uint32_t history_[kClockHistorySize];
+  uint8_t head_;
+  uint8_t num_intervals_;
+  bool fresh_;
+  uint32_t period_;
+
+  DISALLOW_COPY_AND_ASSIGN(ClockTracker);
+};
+
+}  // namespace batumi
+
+#endif  // BATUMI_CLOCK_TRACKER_H_
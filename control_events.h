@@ -0,0 +1,164 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+//
+// Queue of control events. The UI interrupt posts the events of each pot
+// to a slot of its own, where the latest one replaces those not read
+// yet, and the switch edges to a FIFO, where each counts. The main loop
+// reads a snapshot of both. When it is late, it handles at most one
+// event per pot on each pass, and every press and release in order.
+
+#ifndef BATUMI_CONTROL_EVENTS_H_
+#define BATUMI_CONTROL_EVENTS_H_
+
+#include "stmlib/stmlib.h"
+
+#include "stmlib/system/system_clock.h"
+#include "stmlib/ui/event_queue.h"
+
+namespace batumi {
+
+struct TimedEvent {
+  stmlib::ControlType control_type;
+  uint16_t control_id;
+  int32_t data;
+  // milliseconds, when the event was posted
+  uint32_t time;
+};
+
+template<uint8_t num_slots, uint8_t num_edges>
+class ControlEvents {
+ public:
+  ControlEvents() { }
+  ~ControlEvents() { }
+
+  void Init() {
+    for (uint8_t i=0; i<num_slots; i++) {
+      sequence_[i] = read_sequence_[i] = 0;
+    }
+    edge_write_ = edge_read_ = 0;
+  }
+
+  // From the interrupt; replaces the event of the slot if it was not
+  // read yet.
+  inline void Post(
+      uint8_t slot,
+      stmlib::ControlType control_type,
+      uint16_t control_id,
+      int32_t data) {
+    TimedEvent* e = &events_[slot];
+    e->control_type = control_type;
+    e->control_id = control_id;
+    e->data = data;
+    e->time = stmlib::system_clock.milliseconds();
+    // the event is complete before the main loop sees it
+    __asm__ __volatile__("" ::: "memory");
+    sequence_[slot] = sequence_[slot] + 1;
+  }
+
+  // From the interrupt; queues a switch edge, which is dropped if the
+  // main loop left num_edges of them unread.
+  inline void PostEdge(
+      stmlib::ControlType control_type,
+      uint16_t control_id,
+      int32_t data) {
+    uint32_t write = edge_write_;
+    if (write - edge_read_ == num_edges) {
+      return;
+    }
+    TimedEvent* e = &edges_[write & (num_edges - 1)];
+    e->control_type = control_type;
+    e->control_id = control_id;
+    e->data = data;
+    e->time = stmlib::system_clock.milliseconds();
+    __asm__ __volatile__("" ::: "memory");
+    edge_write_ = write + 1;
+  }
+
+  // From the main loop: copies the events posted since the previous
+  // call, oldest first (the edges in the order of the FIFO, then the
+  // slots in their order, for the same time), and returns their number,
+  // at most num_edges + num_slots.
+  uint8_t Snapshot(TimedEvent* events) {
+    uint8_t num_events = 0;
+    uint32_t write = edge_write_;
+    __asm__ __volatile__("" ::: "memory");
+    for (uint32_t read = edge_read_; read != write; ++read) {
+      events[num_events++] = edges_[read & (num_edges - 1)];
+    }
+    // the interrupt may use the entries again
+    __asm__ __volatile__("" ::: "memory");
+    edge_read_ = write;
+
+    for (uint8_t i=0; i<num_slots; i++) {
+      uint32_t sequence;
+      TimedEvent e;
+      // read again if the interrupt posted meanwhile
+      do {
+        sequence = sequence_[i];
+        __asm__ __volatile__("" ::: "memory");
+        e = events_[i];
+        __asm__ __volatile__("" ::: "memory");
+      } while (sequence != sequence_[i]);
+      if (sequence == read_sequence_[i]) {
+        continue;
+      }
+      read_sequence_[i] = sequence;
+
+      uint8_t j = num_events++;
+      while (j > 0 && static_cast<int32_t>(events[j - 1].time - e.time) > 0) {
+        events[j] = events[j - 1];
+        --j;
+      }
+      events[j] = e;
+    }
+    return num_events;
+  }
+
+  // From the main loop: discards the events not read yet.
+  void Flush() {
+    for (uint8_t i=0; i<num_slots; i++) {
+      read_sequence_[i] = sequence_[i];
+    }
+    edge_read_ = edge_write_;
+  }
+
+ private:
+  TimedEvent events_[num_slots];
+  volatile uint32_t sequence_[num_slots];
+  uint32_t read_sequence_[num_slots];
+  // the indices wrap around num_edges, a power of 2
+  typedef char num_edges_check[(num_edges & (num_edges - 1)) ? -1 : 1];
+  TimedEvent edges_[num_edges];
+  volatile uint32_t edge_write_;
+  volatile uint32_t edge_read_;
+
+  DISALLOW_COPY_AND_ASSIGN(ControlEvents);
+};
+
+}  // namespace batumi
+
+#endif  // BATUMI_CONTROL_EVENTS_H_
@@ -51,65 +51,135 @@ void Adc::Init() {
   gpio_init.GPIO_Mode = GPIO_Mode_Out_PP;
   GPIO_Init(GPIOA, &gpio_init);
 
+  // both ADCs convert simultaneously, on the TIM1 CC1 event; the ranks
+  // repeat the same channel for oversampling
   ADC_DeInit(ADC1);
   ADC_DeInit(ADC2);
-  adc_init.ADC_Mode = ADC_Mode_Independent;
-  adc_init.ADC_ScanConvMode = DISABLE;
+  adc_init.ADC_Mode = ADC_Mode_RegSimult;
+  adc_init.ADC_ScanConvMode = ENABLE;
   adc_init.ADC_ContinuousConvMode = DISABLE;
-  adc_init.ADC_ExternalTrigConv = ADC_ExternalTrigConv_None;
+  adc_init.ADC_ExternalTrigConv = ADC_ExternalTrigConv_T1_CC1;
   adc_init.ADC_DataAlign = ADC_DataAlign_Left;
-  adc_init.ADC_NbrOfChannel = 1;
+  adc_init.ADC_NbrOfChannel = kAdcOversampling;
   ADC_Init(ADC1, &adc_init);
+  adc_init.ADC_ExternalTrigConv = ADC_ExternalTrigConv_None;
   ADC_Init(ADC2, &adc_init);
 
-  ADC_RegularChannelConfig(ADC1, ADC_Channel_1, 1, ADC_SampleTime_55Cycles5);
-  ADC_RegularChannelConfig(ADC2, ADC_Channel_0, 1, ADC_SampleTime_55Cycles5);
+  for (uint8_t i=0; i<kAdcOversampling; i++) {
+    ADC_RegularChannelConfig(ADC1, ADC_Channel_1, i+1, ADC_SampleTime_55Cycles5);
+    ADC_RegularChannelConfig(ADC2, ADC_Channel_0, i+1, ADC_SampleTime_55Cycles5);
+  }
+  ADC_ExternalTrigConvCmd(ADC1, ENABLE);
+  ADC_ExternalTrigConvCmd(ADC2, ENABLE);
+  ADC_DMACmd(ADC1, ENABLE);
 
   ADC_Cmd(ADC1, ENABLE);
   ADC_Cmd(ADC2, ENABLE);
 
+  // both ADCs calibrate at the same time
   ADC_ResetCalibration(ADC1);
-  while (ADC_GetResetCalibrationStatus(ADC1));
-  ADC_StartCalibration(ADC1);
-  while (ADC_GetCalibrationStatus(ADC1));
   ADC_ResetCalibration(ADC2);
-  while (ADC_GetResetCalibrationStatus(ADC2));
+  while (ADC_GetResetCalibrationStatus(ADC1) ||
+         ADC_GetResetCalibrationStatus(ADC2));
+  ADC_StartCalibration(ADC1);
   ADC_StartCalibration(ADC2);
-  while (ADC_GetCalibrationStatus(ADC2));
+  while (ADC_GetCalibrationStatus(ADC1) || ADC_GetCalibrationStatus(ADC2));
 
-  index_ = kNumAdcChannels - 1;
-  last_read_ = 0;
-  state_ = false;
-  
-  // read all current values by scanning completely once
-  for (uint8_t i=0; i<kNumAdcChannels * 2; i++) {
-    Scan();
-    for(int j=0; j<2000; j++)	// wait a bit for the mux to catch up
-      asm(""); // this is to avoid GCC's optimization
+  InitDma();
+  index_ = 0;
+  for (uint8_t i=0; i<kNumAdcChannels; i++) {
+    sequence_[i] = 0;
+    age_[i] = 0;
   }
+
+  // read all current values: run the main timer for a whole pass over
+  // the mux (it is started again, with its interrupt, later on)
+  TIM_Cmd(TIM1, ENABLE);
+  while (DMA_GetCurrDataCounter(DMA1_Channel1) >
+         (kAdcBufferChannels - kNumAdcChannels) * kAdcOversampling);
+  Scan();
+}
+
+void Adc::InitDma() {
+  // The main timer steps the mux on its update event, and triggers the
+  // conversions on CC1, late in the period to let the mux settle. The
+  // first conversion happens before the first update: start from
+  // address 0 and make the update number i set address i + 1.
+  for (uint8_t i=0; i<kNumAdcChannels; i++) {
+    uint32_t address = ((i + 1) % kNumAdcChannels) << 3;
+    mux_address_[i] = address | ((~address & (7 << 3)) << 16);
+  }
+  GPIOA->BRR = 7 << 3;
+
+  TIM_OCInitTypeDef timer_oc;
+  TIM_OCStructInit(&timer_oc);
+  timer_oc.TIM_OCMode = TIM_OCMode_PWM1;
+  timer_oc.TIM_OutputState = TIM_OutputState_Enable;
+  timer_oc.TIM_Pulse = (TIM1->ARR + 1) * 3 / 4;
+  timer_oc.TIM_OCPolarity = TIM_OCPolarity_High;
+  TIM_OC1Init(TIM1, &timer_oc);
+  // the CC events of TIM1 only reach the ADC with the main output
+  // enabled; PA8 is not configured as alternate function, so it is left
+  // untouched
+  TIM_CtrlPWMOutputs(TIM1, ENABLE);
+
+  DMA_InitTypeDef dma_init;
+  dma_init.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+  dma_init.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  dma_init.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+  dma_init.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+  dma_init.DMA_Mode = DMA_Mode_Circular;
+  dma_init.DMA_Priority = DMA_Priority_High;
+  dma_init.DMA_M2M = DMA_M2M_Disable;
+
+  // ADC1 (with ADC2's data) is on DMA1 channel 1
+  dma_init.DMA_DIR = DMA_DIR_PeripheralSRC;
+  dma_init.DMA_BufferSize = kAdcBufferChannels * kAdcOversampling;
+  dma_init.DMA_PeripheralBaseAddr = reinterpret_cast<uint32_t>(&ADC1->DR);
+  dma_init.DMA_MemoryBaseAddr = reinterpret_cast<uint32_t>(samples_);
+  DMA_DeInit(DMA1_Channel1);
+  DMA_Init(DMA1_Channel1, &dma_init);
+
+  // TIM1_UP is on DMA1 channel 5
+  dma_init.DMA_DIR = DMA_DIR_PeripheralDST;
+  dma_init.DMA_BufferSize = kNumAdcChannels;
+  dma_init.DMA_PeripheralBaseAddr = reinterpret_cast<uint32_t>(&GPIOA->BSRR);
+  dma_init.DMA_MemoryBaseAddr = reinterpret_cast<uint32_t>(mux_address_);
+  DMA_DeInit(DMA1_Channel5);
+  DMA_Init(DMA1_Channel5, &dma_init);
+
+  TIM_DMACmd(TIM1, TIM_DMA_Update, ENABLE);
+
+  DMA_Cmd(DMA1_Channel1, ENABLE);
+  DMA_Cmd(DMA1_Channel5, ENABLE);
 }
 
 void Adc::Scan() {
-  if (state_) {
-    // Read the value from the previous conversion.
-    values1_[index_] = ADC1->DR - 32768;
-    values2_[index_] = ADC2->DR - 32768;
-    last_read_ = index_;
+  // read the channels converted since the last call
+  uint8_t end = (kAdcBufferChannels * kAdcOversampling -
+                 DMA1_Channel1->CNDTR) / kAdcOversampling;
+  // conversions still to read after the current one, i.e. the number of
+  // samples elapsed since it happened
+  uint8_t pending = (end + kAdcBufferChannels - index_) % kAdcBufferChannels;
+  while (index_ != end) {
+    --pending;
+    const uint32_t* samples = &samples_[index_ * kAdcOversampling];
+    uint32_t sum1 = 0;
+    uint32_t sum2 = 0;
+    for (uint8_t i=0; i<kAdcOversampling; i++) {
+      sum1 += samples[i] & 0xffff;
+      sum2 += samples[i] >> 16;
+    }
+    uint8_t channel = index_ % kNumAdcChannels;
+    values1_[channel] = sum1 / kAdcOversampling - 32768;
+    values2_[channel] = sum2 / kAdcOversampling - 32768;
+    age_[channel] = pending * 32 + kAdcConversionAge;
+    ++sequence_[channel];
     ++index_;
-    if (index_ >= kNumAdcChannels) {
+    if (index_ >= kAdcBufferChannels) {
       index_ = 0;
     }
-
-    // Write the mux address.
-    GPIO_WriteBit(GPIOA, GPIO_Pin_3, static_cast<BitAction>(index_ & 1));
-    GPIO_WriteBit(GPIOA, GPIO_Pin_4, static_cast<BitAction>(index_ & 2));
-    GPIO_WriteBit(GPIOA, GPIO_Pin_5, static_cast<BitAction>(index_ & 4));
-  
-  } else {
-    ADC_SoftwareStartConvCmd(ADC1, ENABLE);
-    ADC_SoftwareStartConvCmd(ADC2, ENABLE);
   }
-  state_ = !state_;
 }
 
 }  // namespace batumi
@@ -31,10 +31,23 @@
 
 #include "stmlib/stmlib.h"
 
+#include "drivers/audio_ram.h"
+
 namespace batumi {
 
 const uint8_t kNumAdcChannels = 8;
 
+// conversions of each mux channel, averaged
+const uint8_t kAdcOversampling = 2;
+// a given mux channel is converted once every kAdcRefreshPeriod samples
+const uint8_t kAdcRefreshPeriod = kNumAdcChannels;
+// the DMA buffer holds two passes over the mux, so that Scan() can tell
+// a whole pass between two calls (block rendering) from no progress
+const uint8_t kAdcBufferChannels = 2 * kNumAdcChannels;
+// conversions are triggered at 3/4 of the sample period: they are 1/4
+// sample old at the next update, in 1/32 of a sample
+const uint8_t kAdcConversionAge = 8;
+
 enum AdcChannel {
   ADC_CV1,
   ADC_CV2,
@@ -57,33 +70,65 @@ class Adc {
   ~Adc() { }
   
   void Init();
-  void Scan();
+  AUDIO_RAMFUNC void Scan();
 
-  inline int16_t value(uint8_t i) const {
+  AUDIO_INLINE int16_t value(uint8_t i) const {
     if (i<8) return values1_[i];
     else return values2_[i-8];
   }
 
-  inline int16_t cv(uint8_t i) const {
+  // incremented each time a new value of the channel is available
+  AUDIO_INLINE uint8_t sequence(uint8_t i) const {
+    return sequence_[i < 8 ? i : i-8];
+  }
+
+  // time between the conversion of the last value of the channel and
+  // the last Scan(), in 1/32 of a sample
+  AUDIO_INLINE uint16_t age(uint8_t i) const {
+    return age_[i < 8 ? i : i-8];
+  }
+
+  AUDIO_INLINE int16_t cv(uint8_t i) const {
     return value(ADC_CV1+i);
   }
 
-  inline int16_t reset(uint8_t i) const {
+  AUDIO_INLINE int16_t reset(uint8_t i) const {
     return value(ADC_RESET1+i);
   }
 
-  inline uint16_t pot(uint8_t i) const {
+  AUDIO_INLINE uint16_t pot(uint8_t i) const {
     return value(ADC_POT1+i) + 32768;
   }
 
+  AUDIO_INLINE uint8_t cv_sequence(uint8_t i) const {
+    return sequence(ADC_CV1+i);
+  }
+
+  AUDIO_INLINE uint8_t reset_sequence(uint8_t i) const {
+    return sequence(ADC_RESET1+i);
+  }
+
+  AUDIO_INLINE uint16_t reset_age(uint8_t i) const {
+    return age(ADC_RESET1+i);
+  }
+
 
  private:
   int16_t values1_[kNumAdcChannels];
   int16_t values2_[kNumAdcChannels];
-
-  bool state_;
+  // both ADCs share the mux, hence the sequence numbers
+  uint8_t sequence_[kNumAdcChannels];
+  uint16_t age_[kNumAdcChannels];
+
+  void InitDma();
+
+  // written by DMA: one word per conversion, with ADC1 in the lower half
+  // and ADC2 in the upper half (dual regular simultaneous mode)
+  uint32_t samples_[kAdcBufferChannels * kAdcOversampling];
+  // streamed to GPIOA->BSRR by DMA to set the mux address
+  uint32_t mux_address_[kNumAdcChannels];
+  // next entry of samples_ to read
   uint8_t index_;
-  uint8_t last_read_;
 
   DISALLOW_COPY_AND_ASSIGN(Adc);
 };
@@ -0,0 +1,82 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+//
+// Placement of the audio path in SRAM.
+
+#include "drivers/audio_ram.h"
+
+#include <stm32f10x_conf.h>
+
+#include <cstring>
+
+namespace batumi {
+
+#ifdef AUDIO_IN_RAM
+
+// bounds of the .ramfunc section, and its load address in flash
+extern "C" {
+extern uint32_t _sramfunc;
+extern uint32_t _eramfunc;
+extern const uint32_t _siramfunc;
+}
+
+int16_t ram_wav_sine[WAV_SINE_SIZE];
+int16_t ram_wav_saw_mipmap[WAV_SAW_MIPMAP_SIZE];
+int16_t ram_wav_tri_mipmap[WAV_TRI_MIPMAP_SIZE];
+int16_t ram_wav_trap_mipmap[WAV_TRAP_MIPMAP_SIZE];
+int16_t ram_wav_bl_step[WAV_BL_STEP_SIZE];
+
+// The vector table is read on each interrupt entry, so it moves to SRAM
+// too: the audio interrupt then keeps running during flash writes. The
+// 16 system and 43 peripheral vectors of the medium density parts are
+// rounded up to a power of two, which VTOR needs as alignment.
+const size_t kNumVectors = 64;
+uint32_t ram_vectors[kNumVectors] __attribute__((aligned(kNumVectors * 4)));
+
+void InitAudioRam() {
+  memcpy(&_sramfunc, &_siramfunc,
+         reinterpret_cast<uint8_t*>(&_eramfunc) -
+         reinterpret_cast<uint8_t*>(&_sramfunc));
+
+  memcpy(ram_wav_sine, wav_sine, sizeof(ram_wav_sine));
+  memcpy(ram_wav_saw_mipmap, wav_saw_mipmap, sizeof(ram_wav_saw_mipmap));
+  memcpy(ram_wav_tri_mipmap, wav_tri_mipmap, sizeof(ram_wav_tri_mipmap));
+  memcpy(ram_wav_trap_mipmap, wav_trap_mipmap, sizeof(ram_wav_trap_mipmap));
+  memcpy(ram_wav_bl_step, wav_bl_step, sizeof(ram_wav_bl_step));
+
+  memcpy(ram_vectors, reinterpret_cast<const void*>(SCB->VTOR),
+         sizeof(ram_vectors));
+  SCB->VTOR = reinterpret_cast<uint32_t>(ram_vectors);
+}
+
+#else
+
+void InitAudioRam() { }
+
+#endif  // AUDIO_IN_RAM
+
+}  // namespace batumi
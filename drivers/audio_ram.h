@@ -0,0 +1,76 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+//
+// Placement of the audio path in SRAM, to avoid the flash wait states
+// (AUDIO_IN_RAM build option).
+
+#ifndef BATUMI_DRIVERS_AUDIO_RAM_H_
+#define BATUMI_DRIVERS_AUDIO_RAM_H_
+
+#include "stmlib/stmlib.h"
+
+#include "resources.h"
+
+namespace batumi {
+
+#ifdef AUDIO_IN_RAM
+
+// Functions in the .ramfunc section are placed in SRAM by the linker
+// script of the option (drivers/audio_ram.ld), and copied there from
+// flash by InitAudioRam(). Calls between flash and SRAM are out of range
+// of a BL instruction, hence long_call.
+#define AUDIO_RAMFUNC __attribute__((section(".ramfunc"), long_call))
+
+// SRAM copies of the tables read on every sample, filled by
+// InitAudioRam()
+#define AUDIO_TABLE(name) ram_##name
+
+extern int16_t ram_wav_sine[WAV_SINE_SIZE];
+extern int16_t ram_wav_saw_mipmap[WAV_SAW_MIPMAP_SIZE];
+extern int16_t ram_wav_tri_mipmap[WAV_TRI_MIPMAP_SIZE];
+extern int16_t ram_wav_trap_mipmap[WAV_TRAP_MIPMAP_SIZE];
+extern int16_t ram_wav_bl_step[WAV_BL_STEP_SIZE];
+
+#else
+
+#define AUDIO_RAMFUNC
+#define AUDIO_TABLE(name) name
+
+#endif  // AUDIO_IN_RAM
+
+// The functions called on the audio path, from the AUDIO_RAMFUNC
+// functions, are inlined into them, rather than left out of line in
+// flash.
+#define AUDIO_INLINE inline __attribute__((always_inline))
+
+// Copies the AUDIO_RAMFUNC functions, the tables and the vector table to
+// SRAM; must run before any of these functions is called.
+void InitAudioRam();
+
+}  // namespace batumi
+
+#endif  // BATUMI_DRIVERS_AUDIO_RAM_H_
@@ -51,8 +51,17 @@ void Dac::Init() {
   // configure timers 3 and 4 for PWM
   TIM_TimeBaseInitTypeDef timer_init;
   TIM_TimeBaseStructInit(&timer_init);
+#ifdef BLOCK_RENDERING
+  timer_init.TIM_Period = kPwmPeriod - 1;
+  timer_init.TIM_Prescaler = 0;
+#else
   timer_init.TIM_Period = (1 << kPwmResolution) - 1;
+#ifdef DAC_DITHER
+  timer_init.TIM_Prescaler = 0;
+#else
   timer_init.TIM_Prescaler = 1;
+#endif
+#endif
   timer_init.TIM_ClockDivision = TIM_CKD_DIV1;
   timer_init.TIM_CounterMode = TIM_CounterMode_Up;
   timer_init.TIM_RepetitionCounter = 0;
@@ -76,20 +85,102 @@ void Dac::Init() {
   TIM_OC3Init(TIM4, &output_compare);
   TIM_OC4Init(TIM4, &output_compare);
 
-  for (int i=0; i<kNumDacChannels; i++)
+  for (int i=0; i<kNumDacChannels; i++) {
     value_[i] = UINT16_MAX;
+#ifdef DAC_DITHER
+    error_[i] = 0;
+#endif
+  }
+
+#ifdef BLOCK_RENDERING
+  frame_ = 0;
+  for (size_t i=0; i<2 * kBlockSize; i++)
+    Write();
+  InitDma();
+#else
   Write();
+#endif
+}
+
+#ifdef BLOCK_RENDERING
+
+void Dac::InitDma() {
+  // TIM3 and TIM4 update events request a burst of 4 transfers into
+  // CCR1..CCR4 through the DMAR register
+  DMA_InitTypeDef dma_init;
+  dma_init.DMA_DIR = DMA_DIR_PeripheralDST;
+  dma_init.DMA_BufferSize = 2 * kBlockSize * 4;
+  dma_init.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+  dma_init.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  dma_init.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+  dma_init.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+  dma_init.DMA_Mode = DMA_Mode_Circular;
+  dma_init.DMA_Priority = DMA_Priority_VeryHigh;
+  dma_init.DMA_M2M = DMA_M2M_Disable;
+
+  // TIM3_UP is on DMA1 channel 3
+  dma_init.DMA_PeripheralBaseAddr = reinterpret_cast<uint32_t>(&TIM3->DMAR);
+  dma_init.DMA_MemoryBaseAddr = reinterpret_cast<uint32_t>(tim3_buffer_);
+  DMA_DeInit(DMA1_Channel3);
+  DMA_Init(DMA1_Channel3, &dma_init);
+
+  // TIM4_UP is on DMA1 channel 7
+  dma_init.DMA_PeripheralBaseAddr = reinterpret_cast<uint32_t>(&TIM4->DMAR);
+  dma_init.DMA_MemoryBaseAddr = reinterpret_cast<uint32_t>(tim4_buffer_);
+  DMA_DeInit(DMA1_Channel7);
+  DMA_Init(DMA1_Channel7, &dma_init);
+
+  TIM_DMAConfig(TIM3, TIM_DMABase_CCR1, TIM_DMABurstLength_4Transfers);
+  TIM_DMAConfig(TIM4, TIM_DMABase_CCR1, TIM_DMABurstLength_4Transfers);
+  TIM_DMACmd(TIM3, TIM_DMA_Update, ENABLE);
+  TIM_DMACmd(TIM4, TIM_DMA_Update, ENABLE);
+
+  // both timers share the same period, so channel 3 alone tells when
+  // a half of the buffer is free
+  DMA_ITConfig(DMA1_Channel3, DMA_IT_HT | DMA_IT_TC, ENABLE);
+
+  NVIC_InitTypeDef dma_interrupt;
+  dma_interrupt.NVIC_IRQChannel = DMA1_Channel3_IRQn;
+  dma_interrupt.NVIC_IRQChannelPreemptionPriority = 0;
+  dma_interrupt.NVIC_IRQChannelSubPriority = 0;
+  dma_interrupt.NVIC_IRQChannelCmd = ENABLE;
+  NVIC_Init(&dma_interrupt);
+
+  DMA_Cmd(DMA1_Channel3, ENABLE);
+  DMA_Cmd(DMA1_Channel7, ENABLE);
 }
 
 void Dac::Write() {
-  TIM_SetCompare1(TIM3, value_[0]);
-  TIM_SetCompare2(TIM3, value_[1]);
-  TIM_SetCompare3(TIM3, value_[2]);
-  TIM_SetCompare4(TIM3, value_[3]);
-  TIM_SetCompare3(TIM4, value_[4]);
-  TIM_SetCompare2(TIM4, value_[5]);
-  TIM_SetCompare1(TIM4, value_[6]);
-  TIM_SetCompare4(TIM4, value_[7]);
+  uint16_t* tim3 = tim3_buffer_[frame_];
+  uint16_t* tim4 = tim4_buffer_[frame_];
+  tim3[0] = value_[0];
+  tim3[1] = value_[1];
+  tim3[2] = value_[2];
+  tim3[3] = value_[3];
+  tim4[0] = value_[6];
+  tim4[1] = value_[5];
+  tim4[2] = value_[4];
+  tim4[3] = value_[7];
+  if (++frame_ >= 2 * kBlockSize) {
+    frame_ = 0;
+  }
 }
 
+#else
+
+void Dac::Write() {
+  // straight to the compare registers: the library calls would sit in
+  // flash, out of line
+  TIM3->CCR1 = value_[0];
+  TIM3->CCR2 = value_[1];
+  TIM3->CCR3 = value_[2];
+  TIM3->CCR4 = value_[3];
+  TIM4->CCR3 = value_[4];
+  TIM4->CCR2 = value_[5];
+  TIM4->CCR1 = value_[6];
+  TIM4->CCR4 = value_[7];
+}
+
+#endif  // BLOCK_RENDERING
+
 }  // namespace batumi
@@ -32,8 +32,25 @@
 
 #include "stmlib/stmlib.h"
 
+#include "drivers/audio_ram.h"
+
 const uint8_t kNumDacChannels = 8;
+#ifdef DAC_DITHER
+// The PWM carrier runs 8 times faster than with 12 bits (70 kHz instead
+// of 8.8 kHz). In both rendering modes, an error feedback loop spreads
+// the truncation error of each output over the following samples.
+const uint16_t kPwmResolution = 10;  // bits
+#else
 const uint16_t kPwmResolution = 12;  // bits
+#endif
+
+#ifdef BLOCK_RENDERING
+// In block mode the PWM timers run at the sample rate, and DMA reloads
+// their compare registers from a ping-pong buffer of 2 * kBlockSize
+// frames on each update event.
+const uint16_t kPwmPeriod = F_CPU / SAMPLE_RATE;
+const size_t kBlockSize = 8;
+#endif
 
 namespace batumi {
 
@@ -44,17 +61,56 @@ class Dac {
   
   void Init();
 
-  inline void set(uint8_t channel, int16_t value) {
-    value_[channel] = (32768 - value) >> (16 - kPwmResolution);
+#ifdef BLOCK_RENDERING
+  AUDIO_INLINE void set(uint8_t channel, int16_t value) {
+    uint32_t v = static_cast<uint32_t>(32768 - value) * kPwmPeriod;
+#ifdef DAC_DITHER
+    v += error_[channel];
+    error_[channel] = v & 0xffff;
+#endif
+    value_[channel] = v >> 16;
   }
 
-  inline void set_sine(uint8_t channel, int16_t value) { set(channel, value); }
-  inline void set_asgn(uint8_t channel, int16_t value) { set(channel+4, value); }
+  // Points Write() to the first frame of the given half of the buffer
+  // (0 or 1), which the DMA has just finished reading.
+  AUDIO_INLINE void StartBlock(uint8_t half) {
+    frame_ = half * kBlockSize;
+  }
+#else
+  AUDIO_INLINE void set(uint8_t channel, int16_t value) {
+    uint32_t v = 32768 - value;
+#ifdef DAC_DITHER
+    v += error_[channel];
+    error_[channel] = v & ((1 << (16 - kPwmResolution)) - 1);
+#endif
+    value_[channel] = v >> (16 - kPwmResolution);
+  }
+#endif
 
-  void Write();
+  AUDIO_INLINE void set_sine(uint8_t channel, int16_t value) {
+    set(channel, value);
+  }
+  AUDIO_INLINE void set_asgn(uint8_t channel, int16_t value) {
+    set(channel+4, value);
+  }
+
+  AUDIO_RAMFUNC void Write();
   
  private:
   uint16_t value_[kNumDacChannels];
+#ifdef DAC_DITHER
+  // truncation error of the last sample, fed back into the next one
+  uint16_t error_[kNumDacChannels];
+#endif
+
+#ifdef BLOCK_RENDERING
+  void InitDma();
+
+  // frames are stored in the order of the compare registers
+  uint16_t tim3_buffer_[2 * kBlockSize][4];
+  uint16_t tim4_buffer_[2 * kBlockSize][4];
+  size_t frame_;
+#endif
 
   DISALLOW_COPY_AND_ASSIGN(Dac);
 };
@@ -52,10 +52,14 @@ void Leds::Init() {
 }
 
 void Leds::Write() {
-  GPIO_WriteBit(GPIOC, GPIO_Pin_13, static_cast<BitAction>(values_[0]));
-  GPIO_WriteBit(GPIOC, GPIO_Pin_14, static_cast<BitAction>(values_[1]));
-  GPIO_WriteBit(GPIOC, GPIO_Pin_15, static_cast<BitAction>(values_[2]));
-  GPIO_WriteBit(GPIOA, GPIO_Pin_2, static_cast<BitAction>(values_[3]));
+  // one BSRR write per port: set bits in the lower half, reset bits in
+  // the upper half
+  uint32_t port_c = 0;
+  port_c |= values_[0] ? GPIO_Pin_13 : GPIO_Pin_13 << 16;
+  port_c |= values_[1] ? GPIO_Pin_14 : GPIO_Pin_14 << 16;
+  port_c |= values_[2] ? GPIO_Pin_15 : GPIO_Pin_15 << 16;
+  GPIOC->BSRR = port_c;
+  GPIOA->BSRR = values_[3] ? GPIO_Pin_2 : GPIO_Pin_2 << 16;
 }
 
 }  // namespace batumi
@@ -0,0 +1,57 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Cycle-accurate profiling of the audio interrupt.
+
+#include "drivers/profiler.h"
+
+#ifdef PROFILE_ISR
+
+#include <stm32f10x_conf.h>
+
+namespace batumi {
+
+void Profiler::Init(uint32_t budget) {
+  budget_ = budget;
+
+  // enable the trace unit, then the cycle counter
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA;
+  *kDwtCycleCounter = 0;
+  *kDwtControl |= 1;
+
+  isr_cycles_ = 0;
+  Reset();
+}
+
+void Profiler::Reset() {
+  for (uint8_t i=0; i<PROFILE_SECTION_LAST; i++)
+    stats_[i].Init();
+  overruns_ = 0;
+}
+
+}  // namespace batumi
+
+#endif  // PROFILE_ISR
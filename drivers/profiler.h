@@ -0,0 +1,161 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Cycle-accurate profiling of the audio interrupt with the DWT cycle
+// counter. All methods compile to nothing unless PROFILE_ISR is defined.
+
+#ifndef BATUMI_DRIVERS_PROFILER_H_
+#define BATUMI_DRIVERS_PROFILER_H_
+
+#include "stmlib/stmlib.h"
+
+#include "drivers/audio_ram.h"
+
+namespace batumi {
+
+enum ProfilerSection {
+  PROFILE_SECTION_ADC,
+  PROFILE_SECTION_PROCESS,
+  PROFILE_SECTION_DAC,
+  PROFILE_SECTION_ISR,
+  PROFILE_SECTION_LAST
+};
+
+// number of measurements averaged into one mean value
+const uint8_t kProfilerWindowShift = 12;
+
+struct CycleStats {
+  uint32_t min;
+  uint32_t max;
+  uint32_t mean;
+  uint32_t sum;
+  uint16_t count;
+
+  void Init() {
+    min = UINT32_MAX;
+    max = mean = sum = count = 0;
+  }
+
+  AUDIO_INLINE void Add(uint32_t cycles) {
+    if (cycles < min) min = cycles;
+    if (cycles > max) max = cycles;
+    sum += cycles;
+    if (++count >= (1 << kProfilerWindowShift)) {
+      mean = sum >> kProfilerWindowShift;
+      sum = 0;
+      count = 0;
+    }
+  }
+};
+
+#ifdef PROFILE_ISR
+
+// CMSIS 1.x does not describe the DWT unit
+volatile uint32_t* const kDwtControl =
+  reinterpret_cast<volatile uint32_t*>(0xe0001000);
+volatile uint32_t* const kDwtCycleCounter =
+  reinterpret_cast<volatile uint32_t*>(0xe0001004);
+
+class Profiler {
+ public:
+  Profiler() { }
+  ~Profiler() { }
+
+  // budget: number of cycles available between two interrupts
+  void Init(uint32_t budget);
+  void Reset();
+
+  AUDIO_INLINE void Start() {
+    start_ = last_ = *kDwtCycleCounter;
+  }
+
+  // Closes the section that started at the previous mark.
+  AUDIO_INLINE void Mark(ProfilerSection section) {
+    uint32_t now = *kDwtCycleCounter;
+    stats_[section].Add(now - last_);
+    last_ = now;
+  }
+
+  // overrun: the interrupt is already pending again
+  AUDIO_INLINE void Stop(bool overrun) {
+    uint32_t cycles = *kDwtCycleCounter - start_;
+    stats_[PROFILE_SECTION_ISR].Add(cycles);
+    isr_cycles_ += cycles;
+    if (overrun) {
+      ++overruns_;
+    }
+  }
+
+  inline const CycleStats& stats(ProfilerSection section) const {
+    return stats_[section];
+  }
+
+  // Mean share of the budget spent in the interrupt, 0 to 65535.
+  inline uint16_t load() const {
+    uint64_t mean = stats_[PROFILE_SECTION_ISR].mean;
+    uint64_t load = (mean << 16) / budget_;
+    return load > UINT16_MAX ? UINT16_MAX : load;
+  }
+
+  inline uint32_t overruns() const { return overruns_; }
+
+  // cycles spent in the interrupt since Init(), wrapping around; not
+  // cleared by Reset(), so that differences across it hold
+  inline uint32_t isr_cycles() const { return isr_cycles_; }
+
+ private:
+  CycleStats stats_[PROFILE_SECTION_LAST];
+  uint32_t budget_;
+  uint32_t start_;
+  uint32_t last_;
+  volatile uint32_t overruns_;
+  volatile uint32_t isr_cycles_;
+
+  DISALLOW_COPY_AND_ASSIGN(Profiler);
+};
+
+#else
+
+class Profiler {
+ public:
+  Profiler() { }
+  ~Profiler() { }
+
+  void Init(uint32_t budget) { }
+  void Reset() { }
+  AUDIO_INLINE void Start() { }
+  AUDIO_INLINE void Mark(ProfilerSection section) { }
+  AUDIO_INLINE void Stop(bool overrun) { }
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(Profiler);
+};
+
+#endif  // PROFILE_ISR
+
+}  // namespace batumi
+
+#endif  // BATUMI_DRIVERS_PROFILER_H_
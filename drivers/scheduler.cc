@@ -0,0 +1,106 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+//
+// Cooperative scheduler of the work done outside of the audio interrupt.
+
+#include "drivers/scheduler.h"
+
+#include <stm32f10x_conf.h>
+
+namespace batumi {
+
+void Scheduler::Init(const Task* tasks, const Profiler* profiler) {
+  tasks_ = tasks;
+  profiler_ = profiler;
+  for (uint8_t i=0; i<kNumDeferredTasks; i++)
+    pending_[i] = false;
+  background_tick_ = false;
+#ifdef PROFILE_ISR
+  deferred_cycles_ = 0;
+  Reset();
+#endif  // PROFILE_ISR
+}
+
+void Scheduler::Post(TaskId id) {
+  pending_[id] = true;
+  SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+}
+
+void Scheduler::RunDeferred() {
+  for (uint8_t i=0; i<kNumDeferredTasks; i++) {
+    // a post during the run requests another one
+    if (pending_[i]) {
+      pending_[i] = false;
+      Run(static_cast<TaskId>(i));
+    }
+  }
+}
+
+void Scheduler::RunBackground() {
+  if (!background_tick_)
+    return;
+  // a tick during the run requests another one
+  background_tick_ = false;
+  for (uint8_t i=kNumDeferredTasks; i<TASK_LAST; i++)
+    Run(static_cast<TaskId>(i));
+}
+
+#ifdef PROFILE_ISR
+
+void Scheduler::Reset() {
+  for (uint8_t i=0; i<TASK_LAST; i++) {
+    stats_[i].Init();
+    overruns_[i] = 0;
+  }
+}
+
+void Scheduler::Run(TaskId id) {
+  exempt_[id] = false;
+  uint32_t start = *kDwtCycleCounter;
+  uint32_t preempted = profiler_->isr_cycles() + deferred_cycles_;
+  (*tasks_[id].fn)();
+  // net of what preempted the run
+  preempted = profiler_->isr_cycles() + deferred_cycles_ - preempted;
+  uint32_t cycles = *kDwtCycleCounter - start - preempted;
+  stats_[id].Add(cycles);
+  if (id < kNumDeferredTasks) {
+    deferred_cycles_ += cycles;
+  }
+  if (cycles > tasks_[id].budget && !exempt_[id]) {
+    ++overruns_[id];
+  }
+}
+
+#else
+
+void Scheduler::Run(TaskId id) {
+  (*tasks_[id].fn)();
+}
+
+#endif  // PROFILE_ISR
+
+}  // namespace batumi
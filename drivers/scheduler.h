@@ -0,0 +1,130 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+//
+// Deferred UI poll, and background tasks of the main loop.
+//
+// This is not a scheduler of the audio path: the audio interrupt keeps
+// the parameter mapping at control rate (Processor::ProcessControl),
+// since it writes the LFO state that the samples read. Below it:
+//  - the deferred tasks (the UI poll), posted by interrupts and run from
+//    PendSV, the lowest interrupt priority, in the order of their ids
+//  - the background tasks, all run by the main loop once per SysTick
+//    (it wakes up on every interrupt), in the order of their ids
+// Tasks run to completion. Each task has a budget of cycles per run. With
+// PROFILE_ISR, the runs are measured net of the audio interrupt and of
+// the deferred tasks that preempt them, and those over budget are
+// counted, unless the task exempts the run (e.g. a flash write).
+
+#ifndef BATUMI_DRIVERS_SCHEDULER_H_
+#define BATUMI_DRIVERS_SCHEDULER_H_
+
+#include "stmlib/stmlib.h"
+
+#include "drivers/profiler.h"
+
+namespace batumi {
+
+enum TaskId {
+  // deferred
+  TASK_UI_POLL,
+  // background
+  TASK_EVENTS,
+  TASK_TRACE,
+  TASK_LAST
+};
+
+const uint8_t kNumDeferredTasks = TASK_UI_POLL + 1;
+
+typedef void (*TaskFn)();
+
+struct Task {
+  TaskFn fn;
+  uint32_t budget;
+};
+
+class Scheduler {
+ public:
+  Scheduler() { }
+  ~Scheduler() { }
+
+  // tasks: TASK_LAST tasks, indexed by their ids; profiler: the cycles
+  // of the audio interrupt, taken out of the measurements of the tasks
+  void Init(const Task* tasks, const Profiler* profiler);
+
+  // Requests a run of a deferred task, from an interrupt.
+  void Post(TaskId id);
+
+  // Runs the deferred tasks posted, from PendSV.
+  void RunDeferred();
+
+  // Requests a run of the background tasks, from SysTick.
+  inline void Tick() { background_tick_ = true; }
+
+  // Runs the background tasks if a tick came since the last run, from the
+  // main loop.
+  void RunBackground();
+
+#ifdef PROFILE_ISR
+  // from the task, while it runs: the run is not checked against the
+  // budget
+  inline void Exempt(TaskId id) { exempt_[id] = true; }
+
+  void Reset();
+
+  inline const CycleStats& stats(TaskId id) const {
+    return stats_[id];
+  }
+
+  // runs over budget
+  inline uint32_t overruns(TaskId id) const {
+    return overruns_[id];
+  }
+#else
+  inline void Exempt(TaskId id) { }
+#endif  // PROFILE_ISR
+
+ private:
+  void Run(TaskId id);
+
+  const Task* tasks_;
+  const Profiler* profiler_;
+  volatile bool pending_[kNumDeferredTasks];
+  volatile bool background_tick_;
+#ifdef PROFILE_ISR
+  CycleStats stats_[TASK_LAST];
+  uint32_t overruns_[TASK_LAST];
+  bool exempt_[TASK_LAST];
+  // cycles of the deferred runs, net, wrapping around
+  volatile uint32_t deferred_cycles_;
+#endif  // PROFILE_ISR
+
+  DISALLOW_COPY_AND_ASSIGN(Scheduler);
+};
+
+}  // namespace batumi
+
+#endif  // BATUMI_DRIVERS_SCHEDULER_H_
@@ -0,0 +1,201 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Wear-leveled storage of the settings.
+
+#include "drivers/settings_storage.h"
+
+#include <stm32f10x_conf.h>
+#include <string.h>
+
+#include "stmlib/system/system_clock.h"
+
+namespace batumi {
+
+using namespace stmlib;
+
+const uint16_t kSettingsMagic = 0xba70;
+
+const uint32_t kFlashKey1 = 0x45670123;
+const uint32_t kFlashKey2 = 0xcdef89ab;
+
+bool SettingsStorage::Init(void* data, size_t size) {
+  data_ = data;
+  size_ = size;
+  record_size_ = 3 + (size_ + 1) / 2;
+  // records do not straddle pages, so that erasing a page only loses
+  // whole records
+  slots_per_page_ = kSettingsStoragePageSize / (record_size_ * 2);
+  num_slots_ = slots_per_page_ * kSettingsStorageNumPages;
+  next_slot_ = 0;
+  sequence_ = 0;
+  save_pending_ = false;
+  save_time_ = 0;
+  busy_ = false;
+  if (size_ > kSettingsMaxSize) {
+    // no slots: Load() finds nothing and RequestSave() is ignored
+    num_slots_ = 0;
+    return false;
+  }
+  return true;
+}
+
+const uint16_t* SettingsStorage::slot(uint16_t index) const {
+  uint32_t address = kSettingsStorageBase +
+    (index / slots_per_page_) * kSettingsStoragePageSize +
+    (index % slots_per_page_) * record_size_ * 2;
+  return reinterpret_cast<const uint16_t*>(address);
+}
+
+bool SettingsStorage::blank(uint16_t index) const {
+  const uint16_t* record = slot(index);
+  for (size_t i=0; i<record_size_; i++) {
+    if (record[i] != 0xffff)
+      return false;
+  }
+  return true;
+}
+
+uint16_t SettingsStorage::Checksum(const uint16_t* record) const {
+  uint16_t sum = 0;
+  for (size_t i=0; i<record_size_-1; i++) {
+    sum += record[i];
+  }
+  return ~sum;
+}
+
+bool SettingsStorage::Load() {
+  bool found = false;
+  uint16_t newest = 0;
+  for (uint16_t i=0; i<num_slots_; i++) {
+    const uint16_t* record = slot(i);
+    if (record[0] != kSettingsMagic ||
+        record[record_size_-1] != Checksum(record))
+      continue;
+    // sequence numbers wrap around
+    if (!found || static_cast<int16_t>(record[1] - sequence_) > 0) {
+      found = true;
+      newest = i;
+      sequence_ = record[1];
+    }
+  }
+  if (!found)
+    return false;
+  memcpy(data_, slot(newest) + 2, size_);
+  next_slot_ = (newest + 1) % num_slots_;
+  return true;
+}
+
+void SettingsStorage::RequestSave() {
+  if (!num_slots_)
+    return;
+  save_pending_ = true;
+  save_time_ = system_clock.milliseconds() + kSettingsSaveDelay;
+}
+
+void SettingsStorage::RequestImmediateSave() {
+  if (!num_slots_)
+    return;
+  save_pending_ = true;
+  save_time_ = system_clock.milliseconds();
+}
+
+bool SettingsStorage::Poll() {
+  if (save_pending_ &&
+      static_cast<int32_t>(system_clock.milliseconds() - save_time_) >= 0) {
+    save_pending_ = false;
+    Save();
+    return true;
+  }
+  return false;
+}
+
+void SettingsStorage::Save() {
+  memset(record_, 0xff, sizeof(record_));
+  record_[0] = kSettingsMagic;
+  record_[1] = ++sequence_;
+  memcpy(&record_[2], data_, size_);
+  record_[record_size_-1] = Checksum(record_);
+
+  // records are appended; a page is erased when the writes wrap around
+  // to it. Anything else in the way (e.g. settings of earlier
+  // firmwares) moves the writes to the next page.
+  if (!blank(next_slot_)) {
+    if (next_slot_ % slots_per_page_) {
+      next_slot_ = (next_slot_ / slots_per_page_ + 1) * slots_per_page_;
+      next_slot_ %= num_slots_;
+    }
+    if (!blank(next_slot_))
+      ErasePage(reinterpret_cast<uint32_t>(slot(next_slot_)));
+  }
+  Program(reinterpret_cast<uint32_t>(slot(next_slot_)), record_,
+          record_size_);
+  next_slot_ = (next_slot_ + 1) % num_slots_;
+}
+
+void SettingsStorage::StartFlashOperation() {
+  busy_ = true;
+  // the UI interrupt, and the UI task it posts, run from flash: hold them
+  // back during the operation
+  systick_ctrl_ = SysTick->CTRL;
+  SysTick->CTRL = systick_ctrl_ & ~SysTick_CTRL_TICKINT_Msk;
+  if (FLASH->CR & FLASH_CR_LOCK) {
+    FLASH->KEYR = kFlashKey1;
+    FLASH->KEYR = kFlashKey2;
+  }
+  FLASH->SR = FLASH_SR_EOP | FLASH_SR_PGERR | FLASH_SR_WRPRTERR;
+}
+
+void SettingsStorage::EndFlashOperation() {
+  FLASH->CR |= FLASH_CR_LOCK;
+  SysTick->CTRL = systick_ctrl_;
+  busy_ = false;
+}
+
+void SettingsStorage::ErasePage(uint32_t address) {
+  StartFlashOperation();
+  FLASH->CR |= FLASH_CR_PER;
+  FLASH->AR = address;
+  FLASH->CR |= FLASH_CR_STRT;
+  while (FLASH->SR & FLASH_SR_BSY);
+  FLASH->CR &= ~FLASH_CR_PER;
+  EndFlashOperation();
+}
+
+void SettingsStorage::Program(uint32_t address, const uint16_t* data,
+                              size_t size) {
+  StartFlashOperation();
+  FLASH->CR |= FLASH_CR_PG;
+  for (size_t i=0; i<size; i++) {
+    *reinterpret_cast<volatile uint16_t*>(address) = data[i];
+    address += 2;
+    while (FLASH->SR & FLASH_SR_BSY);
+  }
+  FLASH->CR &= ~FLASH_CR_PG;
+  EndFlashOperation();
+}
+
+}  // namespace batumi
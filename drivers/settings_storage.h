@@ -0,0 +1,121 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Wear-leveled storage of the settings in the last pages of the flash,
+// written from the main loop once they stop changing.
+
+#ifndef BATUMI_DRIVERS_SETTINGS_STORAGE_H_
+#define BATUMI_DRIVERS_SETTINGS_STORAGE_H_
+
+#include "stmlib/stmlib.h"
+
+#include "drivers/audio_ram.h"
+
+namespace batumi {
+
+// the region of stmlib::Storage<0x8020000, 4>, used by earlier firmwares
+const uint32_t kSettingsStorageEnd = 0x8020000;
+const uint32_t kSettingsStoragePageSize = 0x400;  // medium density
+const uint8_t kSettingsStorageNumPages = 4;
+const uint32_t kSettingsStorageBase = kSettingsStorageEnd -
+  kSettingsStorageNumPages * kSettingsStoragePageSize;
+
+// largest block of settings, in bytes
+const size_t kSettingsMaxSize = 64;
+// a record is a magic number, a sequence number, the settings and a
+// checksum, in half words (the flash is programmed by half words)
+const size_t kSettingsMaxRecordSize = 3 + (kSettingsMaxSize + 1) / 2;
+
+// the settings are saved once they have been left unchanged this long,
+// in ms, so that a burst of changes costs a single write, and short
+// enough for the last of them to be saved before a power off
+const uint32_t kSettingsSaveDelay = 500;
+
+class SettingsStorage {
+ public:
+  SettingsStorage() { }
+  ~SettingsStorage() { }
+
+  // data points to the block of size bytes to load and save; false if
+  // they do not fit in a record (size above kSettingsMaxSize), in which
+  // case nothing is ever loaded or saved
+  bool Init(void* data, size_t size);
+
+  // restores the last record saved; false if there is none
+  bool Load();
+
+  // schedules a save, coalesced with the pending one
+  void RequestSave();
+
+  // schedules a save for the next Poll(), along with the pending one;
+  // for the settings that are done changing
+  void RequestImmediateSave();
+
+  // called from the main loop, performs the save when due; true if it
+  // did
+  bool Poll();
+
+  // true while the flash is erased or programmed: code and data in
+  // flash are stalled, only SRAM can be used (see AUDIO_IN_RAM). The
+  // resets and syncs detected meanwhile are latched and delivered at the
+  // end, with their delay counted from the edge.
+  inline bool busy() const { return busy_; }
+
+ private:
+  void Save();
+  const uint16_t* slot(uint16_t index) const;
+  bool blank(uint16_t index) const;
+  uint16_t Checksum(const uint16_t* record) const;
+
+  // these run from SRAM with AUDIO_IN_RAM, so that the audio interrupt
+  // goes on during the flash operations
+  AUDIO_RAMFUNC void ErasePage(uint32_t address);
+  AUDIO_RAMFUNC void Program(uint32_t address, const uint16_t* data,
+                             size_t size);
+  AUDIO_RAMFUNC void StartFlashOperation();
+  AUDIO_RAMFUNC void EndFlashOperation();
+
+  void* data_;
+  size_t size_;
+  size_t record_size_;
+  uint16_t slots_per_page_;
+  uint16_t num_slots_;
+
+  uint16_t next_slot_;
+  uint16_t sequence_;
+  uint16_t record_[kSettingsMaxRecordSize];
+
+  bool save_pending_;
+  uint32_t save_time_;
+  volatile bool busy_;
+  uint32_t systick_ctrl_;
+
+  DISALLOW_COPY_AND_ASSIGN(SettingsStorage);
+};
+
+}  // namespace batumi
+
+#endif  // BATUMI_DRIVERS_SETTINGS_STORAGE_H_
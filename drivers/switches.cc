@@ -52,12 +52,12 @@ void Switches::Init(Adc *adc) {
 }
 
 void Switches::Debounce() {
-  switch_state_[0] = (switch_state_[0] << 1) |
-    GPIO_ReadInputDataBit(GPIOB, GPIO_Pin_4);
-  switch_state_[1] = (switch_state_[1] << 1) |
-    GPIO_ReadInputDataBit(GPIOB, GPIO_Pin_5);
-  switch_state_[2] = (switch_state_[2] << 1) |
-    GPIO_ReadInputDataBit(GPIOA, GPIO_Pin_8);
+  // one read per port
+  uint32_t port_a = GPIOA->IDR;
+  uint32_t port_b = GPIOB->IDR;
+  switch_state_[0] = (switch_state_[0] << 1) | ((port_b >> 4) & 1);
+  switch_state_[1] = (switch_state_[1] << 1) | ((port_b >> 5) & 1);
+  switch_state_[2] = (switch_state_[2] << 1) | ((port_a >> 8) & 1);
   switch_state_[3] = (switch_state_[3] << 1) |
     (adc_->value(ADC_TACT_SWITCH) > 0);
 
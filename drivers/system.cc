@@ -64,22 +64,30 @@ void System::Init(uint32_t timer_period, bool application) {
   TIM_TimeBaseInit(TIM1, &timer_init);
 
   NVIC_PriorityGroupConfig(NVIC_PriorityGroup_2);  // 2.2 priority split.
-  
+
+  // in block mode, the DAC's DMA interrupt drives processing instead
+#ifndef BLOCK_RENDERING
   NVIC_InitTypeDef timer_interrupt;
   timer_interrupt.NVIC_IRQChannel = TIM1_UP_IRQn;
   timer_interrupt.NVIC_IRQChannelPreemptionPriority = 0;
   timer_interrupt.NVIC_IRQChannelSubPriority = 0;
   timer_interrupt.NVIC_IRQChannelCmd = ENABLE;
   NVIC_Init(&timer_interrupt);
-
+#endif
 }
 
 void System::StartTimers() {
   SysTick_Config(F_CPU / 1000);
+  // below the audio interrupt; the deferred tasks run below everything
+  uint32_t grouping = NVIC_GetPriorityGrouping();
+  NVIC_SetPriority(SysTick_IRQn, NVIC_EncodePriority(grouping, 2, 0));
+  NVIC_SetPriority(PendSV_IRQn, NVIC_EncodePriority(grouping, 3, 0));
   TIM_Cmd(TIM1, ENABLE);
   TIM_Cmd(TIM3, ENABLE);
   TIM_Cmd(TIM4, ENABLE);
+#ifndef BLOCK_RENDERING
   TIM_ITConfig(TIM1, TIM_IT_Update, ENABLE);
+#endif
 }
 
 }  // namespace batumi
@@ -0,0 +1,97 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+//
+// Streaming of the state of the processor over the SWO pin.
+
+#include "drivers/tracer.h"
+
+#ifdef TRACE
+
+#include <stm32f10x_conf.h>
+
+namespace batumi {
+
+// CMSIS 1.x does not describe the TPIU
+volatile uint32_t* const kTpiuPrescaler =
+  reinterpret_cast<volatile uint32_t*>(0xe0040010);
+volatile uint32_t* const kTpiuProtocol =
+  reinterpret_cast<volatile uint32_t*>(0xe00400f0);
+volatile uint32_t* const kTpiuFormatter =
+  reinterpret_cast<volatile uint32_t*>(0xe0040304);
+
+void Tracer::Init() {
+  write_ = read_ = 0;
+  time_ = 0;
+  drops_ = reported_drops_ = 0;
+
+  // SWO on PB3, asynchronous, NRZ, without the formatter
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA;
+  DBGMCU->CR = (DBGMCU->CR & ~DBGMCU_CR_TRACE_MODE) | DBGMCU_CR_TRACE_IOEN;
+  *kTpiuProtocol = 2;
+  *kTpiuPrescaler = F_CPU / kTraceBaudRate - 1;
+  *kTpiuFormatter = 0x100;
+
+  // unlock the ITM, enable it with ATB ID 1, then the stimulus port
+  ITM->LAR = 0xc5acce55;
+  ITM->TCR = (1 << 16) | 1;
+  ITM->TPR = 0;
+  ITM->TER = 1 << kTracePort;
+}
+
+void Tracer::Send(const uint32_t* words) {
+  for (uint8_t i=0; i<kTraceRecordWords; i++) {
+    // wait for room in the ITM FIFO
+    while (!ITM->PORT[kTracePort].u32);
+    ITM->PORT[kTracePort].u32 = words[i];
+  }
+}
+
+void Tracer::Drain() {
+  uint8_t read = read_;
+  while (read != write_) {
+    Send(records_[read].words);
+    // the record is sent before the audio interrupt reuses it
+    __asm__ __volatile__("" ::: "memory");
+    read = (read + 1) & (kTraceBufferSize - 1);
+    read_ = read;
+  }
+
+  // the drops are reported by the main loop, which owns no slot in the
+  // buffer: straight to the ITM
+  uint32_t drops = drops_;
+  if (drops != reported_drops_) {
+    uint32_t words[kTraceRecordWords] = {
+      time_, TraceHeader(TRACE_RECORD_DROPS, 0, 0), drops, 0
+    };
+    Send(words);
+    reported_drops_ = drops;
+  }
+}
+
+}  // namespace batumi
+
+#endif  // TRACE
@@ -0,0 +1,171 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+//
+// Streaming of the state of the processor over the SWO pin, through the
+// ITM. The audio interrupt writes records to a ring buffer, the main loop
+// sends them. All methods compile to nothing unless TRACE is defined;
+// the record format is also read by the host decoder (sim/trace_decode.cc).
+
+#ifndef BATUMI_DRIVERS_TRACER_H_
+#define BATUMI_DRIVERS_TRACER_H_
+
+#include "stmlib/stmlib.h"
+
+#include "drivers/audio_ram.h"
+
+namespace batumi {
+
+// Each record is kTraceRecordWords 32-bit writes to ITM stimulus port
+// kTracePort:
+//  0: time, in samples
+//  1: kTraceMagic << 24 | type << 20 | channel << 16 | aux
+//  2, 3: two values, depending on the type
+enum TraceRecordType {
+  // every kTraceDecimation samples, one channel after the other;
+  // aux: BLEP step rendering << 15 | multiplier << 8 | divider,
+  // values: output phase, phase increment
+  TRACE_RECORD_STATE,
+  // a reset edge; aux: its delay, in 1/32 of a sample; values: interval
+  // since the previous edge, in 1/32 of a sample, then 0
+  TRACE_RECORD_RESET,
+  // a sync edge; as a reset, then the period tracked before it
+  TRACE_RECORD_SYNC,
+  // records lost to a full buffer; values: total count, then 0
+  TRACE_RECORD_DROPS,
+  TRACE_RECORD_LAST
+};
+
+const uint8_t kTraceRecordWords = 4;
+const uint8_t kTraceMagic = 0xba;
+const uint8_t kTracePort = 1;
+const uint8_t kTraceDecimationShift = 3;
+const uint8_t kTraceDecimation = 1 << kTraceDecimationShift;
+const uint32_t kTraceBaudRate = 2000000;
+
+AUDIO_INLINE uint32_t TraceHeader(
+    TraceRecordType type,
+    uint8_t channel,
+    uint16_t aux) {
+  return (static_cast<uint32_t>(kTraceMagic) << 24) | (type << 20) |
+    ((channel & 0xf) << 16) | aux;
+}
+
+#ifdef TRACE
+
+// a power of 2
+const uint8_t kTraceBufferSize = 64;
+
+struct TraceRecord {
+  uint32_t words[kTraceRecordWords];
+};
+
+class Tracer {
+ public:
+  Tracer() { }
+  ~Tracer() { }
+
+  void Init();
+
+  // Starts a sample; true when the state of a channel is due.
+  AUDIO_INLINE bool Tick() {
+    uint32_t time = time_ + 1;
+    time_ = time;
+    return (time & (kTraceDecimation - 1)) == 0;
+  }
+
+  // channel whose state is due, out of num_channels
+  AUDIO_INLINE uint8_t channel(uint8_t num_channels) const {
+    return (time_ >> kTraceDecimationShift) % num_channels;
+  }
+
+  // Called by the audio interrupt only; the record is dropped when the
+  // main loop falls behind.
+  AUDIO_INLINE void Write(
+      TraceRecordType type,
+      uint8_t channel,
+      uint16_t aux,
+      uint32_t a,
+      uint32_t b) {
+    uint8_t write = write_;
+    uint8_t next = (write + 1) & (kTraceBufferSize - 1);
+    if (next == read_) {
+      ++drops_;
+      return;
+    }
+    uint32_t* words = records_[write].words;
+    words[0] = time_;
+    words[1] = TraceHeader(type, channel, aux);
+    words[2] = a;
+    words[3] = b;
+    // the record is complete before the main loop sees it
+    __asm__ __volatile__("" ::: "memory");
+    write_ = next;
+  }
+
+  // Sends the pending records, from the main loop.
+  void Drain();
+
+ private:
+  void Send(const uint32_t* words);
+
+  TraceRecord records_[kTraceBufferSize];
+  volatile uint8_t write_;
+  volatile uint8_t read_;
+  volatile uint32_t time_;
+  volatile uint32_t drops_;
+  uint32_t reported_drops_;
+
+  DISALLOW_COPY_AND_ASSIGN(Tracer);
+};
+
+#else
+
+class Tracer {
+ public:
+  Tracer() { }
+  ~Tracer() { }
+
+  void Init() { }
+  AUDIO_INLINE bool Tick() { return false; }
+  AUDIO_INLINE uint8_t channel(uint8_t num_channels) const { return 0; }
+  AUDIO_INLINE void Write(
+      TraceRecordType type,
+      uint8_t channel,
+      uint16_t aux,
+      uint32_t a,
+      uint32_t b) { }
+  void Drain() { }
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(Tracer);
+};
+
+#endif  // TRACE
+
+}  // namespace batumi
+
+#endif  // BATUMI_DRIVERS_TRACER_H_
@@ -0,0 +1,72 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+//
+// Kernels on pairs of signed 16-bit samples packed in a word, the first
+// in the low half.
+
+#ifndef BATUMI_DSP_H_
+#define BATUMI_DSP_H_
+
+#include "stmlib/stmlib.h"
+
+#include "drivers/audio_ram.h"
+
+namespace batumi {
+
+AUDIO_INLINE uint32_t PackSamples(int16_t low, int16_t high) {
+  return static_cast<uint16_t>(low) | static_cast<uint32_t>(high) << 16;
+}
+
+AUDIO_INLINE int16_t LowSample(uint32_t x) {
+  return static_cast<int16_t>(x);
+}
+
+AUDIO_INLINE int16_t HighSample(uint32_t x) {
+  return static_cast<int16_t>(x >> 16);
+}
+
+// Both samples multiplied by gain / 65536, rounded down.
+AUDIO_INLINE uint32_t ScaleSamples(uint32_t x, uint16_t gain) {
+  int32_t low = LowSample(x) * static_cast<int32_t>(gain) >> 16;
+  int32_t high = HighSample(x) * static_cast<int32_t>(gain) >> 16;
+  return PackSamples(low, high);
+}
+
+// Sum of the products of the low samples and of the high samples; with
+// weights w and 1 - w in y, a crossfade between the samples of x.
+AUDIO_INLINE int32_t MultiplyAddSamples(uint32_t x, uint32_t y) {
+  return LowSample(x) * LowSample(y) + HighSample(x) * HighSample(y);
+}
+
+AUDIO_INLINE int16_t Saturate16(int32_t x) {
+  CONSTRAIN(x, INT16_MIN, INT16_MAX);
+  return x;
+}
+
+}  // namespace batumi
+
+#endif  // BATUMI_DSP_H_
@@ -48,38 +48,86 @@ void Lfo::Init() {
   multiplied_phase_ = 0;
   initial_phase_ = 0;
   phase_increment_ = UINT32_MAX >> 8;
+  pitch_ = kNoPitch;
   divider_ = 1;
   multiplier_ = 1;
   cycle_counter_ = 0;
+  divider_reciprocal_ = UINT32_MAX;
+  divided_alignment_ = 0;
+  cycle_index_ = 0;
+  cycle_offset_ = 0;
+  random_type_ = RANDOM_WHITE;
+  shape_ = SHAPE_SINE;
+  mipmap_level_[0] = mipmap_level_[1] = 0;
+  UpdateIncrement();
   level_ = UINT16_MAX;
   current_value_ = UINT16_MAX / 2;
   next_value_ = 0;
   logistic_seed_ = 368 + (Random::GetWord() >> 27);
   next_random_armed_ = false;
+  bl_step_counter_ = 0;
   direction_ = true;
   hold_ = false;
 }
 
-void Lfo::Step() {
-  if (!linked_ && !hold_)
-    phase_ += direction_ ? phase_increment_ : -phase_increment_;
+// advances the LFO by num_samples samples
+inline void Lfo::Advance(uint8_t num_samples) {
+  // a follower runs on the accumulator of the LFO it is linked to, and
+  // only derives its divided values from it
+  const Lfo* master = linked_ ? linked_ : this;
+  if (linked_) {
+    if (alignment_phase_ != master->alignment_phase_) {
+      alignment_phase_ = master->alignment_phase_;
+      divided_alignment_ = alignment_phase_ / divider_;
+    }
+    if (phase_increment_ != master->phase_increment_) {
+      phase_increment_ = master->phase_increment_;
+      UpdateIncrement();
+    }
+  }
+  uint32_t span = phase_increment_ * num_samples;
+  if (!linked_ && !hold_) {
+    phase_ += direction_ ? span : -span;
+  }
+  uint32_t accumulator = master->phase_;
 
-  if (phase_ < phase_increment_) {
-    direction_ ? cycle_counter_++ : cycle_counter_--;
+  if (accumulator < span) {
+    if (master->direction_) {
+      cycle_counter_++;
+      if (++cycle_index_ == divider_) {
+	cycle_index_ = 0;
+	cycle_offset_ = 0;
+      } else {
+	cycle_offset_ += divider_reciprocal_;
+      }
+    } else {
+      cycle_counter_--;
+      if (cycle_index_ == 0) {
+	cycle_index_ = divider_ - 1;
+	cycle_offset_ = divider_reciprocal_ * cycle_index_;
+      } else {
+	cycle_index_--;
+	cycle_offset_ -= divider_reciprocal_;
+      }
+    }
   }
 
-  divided_phase_ = phase_ / divider_ +
-    UINT32_MAX / divider_ * (cycle_counter_ % divider_);
+  // accumulator / divider_, by multiplication with the reciprocal
+  divided_phase_ = divider_ == 1 ? accumulator :
+    (static_cast<uint64_t>(accumulator) * divider_reciprocal_ >> 32);
+  divided_phase_ += cycle_offset_;
   multiplied_phase_ = divided_phase_ * multiplier_;
 
-  if (phase() > UINT32_MAX / 4 * 3) {
+  uint32_t phase = this->phase();
+
+  if (phase > UINT32_MAX / 4 * 3) {
     next_random_armed_ = true;
   }
 
   // compute the next random value on phase restart, *only if* we went
   // through a good part of the previous phase (prevents retriggering
   // when synced)
-  if (phase() < phase_increment_ / divider_ * multiplier_ &&
+  if (phase < increment_ * num_samples &&
       next_random_armed_) {
     if (linked_) {
       current_value_ = next_value_;
@@ -91,6 +139,16 @@ void Lfo::Step() {
   }
 }
 
+void Lfo::Step() {
+  Advance(1);
+}
+
+#ifdef ADAPTIVE_RATE
+void Lfo::Step(uint8_t num_samples) {
+  Advance(num_samples);
+}
+#endif  // ADAPTIVE_RATE
+
 void Lfo::ComputeNextRandom() {
   current_value_ = next_value_;
   switch (random_type_) {
@@ -106,185 +164,316 @@ void Lfo::ComputeNextRandom() {
   }
 }
 
-void Lfo::Reset(uint8_t subsample) {
-  /* save the current osc. value and compute the future value at the
-   * end of the reset step */
-  uint32_t end_phase = WAV_BL_STEP0_SIZE *
-    phase_increment_ / divider_ * multiplier_;
-  for (int i=0; i<kNumLfoShapes; i++) {
-    LfoShape s = static_cast<LfoShape>(i);
-    step_begin_[i] = ComputeSampleShape(s, phase());
-    step_end_[i] = ComputeSampleShape(s, end_phase);
-  }
+void Lfo::Reset(uint16_t delay) {
+  /* save the current value of the routed outputs */
+  uint32_t begin = ComputeOutputs(phase());
 
-  // reset phase etc.
-  phase_ = 0;
+  // reset phase etc., catching up with the time elapsed since the edge
+  phase_ = PhaseAdvance(phase_increment_, delay);
+  if (!direction_)
+    phase_ = -phase_;
+  divided_phase_ = 0;
+  multiplied_phase_ = 0;
   alignment_phase_ = 0;
+  divided_alignment_ = 0;
   cycle_counter_ = 0;
+  cycle_index_ = 0;
+  cycle_offset_ = 0;
   ComputeNextRandom();
+
+  /* compute the future value at the end of the reset step */
+  uint32_t end_phase = phase() +
+    PhaseAdvance(increment_, (kBlStepLength << 5) + delay);
+  uint32_t end = ComputeOutputs(end_phase);
+  step_[LFO_OUTPUT_SINE] = PackSamples(LowSample(begin), LowSample(end));
+  step_[LFO_OUTPUT_SHAPE] = PackSamples(HighSample(begin), HighSample(end));
+
   // and start the reset step
-  bl_step_counter_ = WAV_BL_STEP0_SIZE;
-  reset_subsample_ = subsample;
+  bl_step_counter_ = kBlStepLength;
+  // fractional position of the edge in the current sample
+  reset_subsample_ = -delay & 31;
 }
 
-uint32_t Lfo::ComputePhaseIncrement(int16_t pitch) {
-  int16_t num_shifts = 0;
-  while (pitch < 0) {
-    pitch += kOctave;
-    --num_shifts;
-  }
-  while (pitch >= kOctave) {
-    pitch -= kOctave;
-    ++num_shifts;
-  }
-  // Lookup phase increment
-  uint32_t a = lut_increments[pitch >> 4];
-  uint32_t b = lut_increments[(pitch >> 4) + 1];
-  uint32_t phase_increment = a + ((b - a) * (pitch & 0xf) >> 4);
+uint32_t Lfo::ComputePhaseIncrement(int32_t pitch) {
+  // octave and position in the octave of the pitch, made positive: a
+  // division by a constant, instead of a loop over the octaves
+  uint32_t biased = pitch + kPitchOctaveBias * kPitchOctave;
+  uint32_t octave = biased / kPitchOctave;
+  uint32_t position = biased - octave * kPitchOctave;
+  int32_t num_shifts = static_cast<int32_t>(octave) - kPitchOctaveBias;
+
+  // step of the position, then the ratio of its fraction
+  uint32_t phase_increment = lut_pitch_increments[
+    position >> kPitchFractionShift];
+  phase_increment += (phase_increment >> 7) *
+    lut_pitch_fractions[position & (kNumPitchFractions - 1)] >> 16;
   return num_shifts >= 0
       ? phase_increment << num_shifts
       : phase_increment >> -num_shifts;
 }
 
-inline int16_t Lfo::ComputeSampleShape(LfoShape s, uint32_t phase) {
-  switch (s) {
-  case SHAPE_SINE:
-    return ComputeSampleSine(phase);
-  case SHAPE_TRIANGLE:
-    return ComputeSampleTriangle(phase);
-  case SHAPE_SAW:
-    return ComputeSampleSaw(phase);
-  case SHAPE_RAMP:
-    return ComputeSampleRamp(phase);
+void Lfo::UpdateIncrement() {
+  increment_ = phase_increment_ / divider_ * multiplier_;
+
+  // level i is crossfaded with level i + 1 along the octave of
+  // increments starting at 2^(kMipMapBaseBits + i); the first level is
+  // used alone down to 2^21, and crossfaded with the naive shape below
+  if (increment_ < 1UL << (kMipMapBaseBits - 3)) {
+    band_limit_tier_ = BAND_LIMIT_NONE;
+    band_limit_balance_ = 0;
+  } else {
+    uint8_t msb = 31 - __builtin_clz(increment_);
+    uint8_t level = 0;
+    band_limit_tier_ = BAND_LIMIT_MIPMAP;
+    band_limit_balance_ = (increment_ >> (msb - 16)) & 0xffff;
+    if (msb < kMipMapBaseBits - 2) {
+      band_limit_tier_ = BAND_LIMIT_LOW;
+    } else if (msb < kMipMapBaseBits) {
+      band_limit_balance_ = 0;
+    } else if (msb - kMipMapBaseBits < kNumMipMapLevels - 1) {
+      level = msb - kMipMapBaseBits;
+    } else {
+      level = kNumMipMapLevels - 1;
+      band_limit_balance_ = 0;
+    }
+    mipmap_level_[0] = level;
+    mipmap_level_[1] = band_limit_balance_ ? level + 1 : level;
+    UpdateMipMap();
+  }
+  render_fn_ = fn_table_[shape_][band_limit_tier_];
+}
+
+void Lfo::UpdateMipMap() {
+  const int16_t* table;
+  WavetableSymmetry symmetry;
+  switch (shape_) {
   case SHAPE_TRAPEZOID:
-    return ComputeSampleTrapezoid(phase);
-  case SHAPE_SQUARE:
-    return ComputeSampleSquare(phase);
-  case SHAPE_RANDOM_STEP:
-    random_type_ = RANDOM_WHITE;
-    return ComputeSampleRandom(phase, false);
-  case SHAPE_RANDOM_SMOOTH:
+    table = AUDIO_TABLE(wav_trap_mipmap);
+    symmetry = WAVETABLE_QUARTER;
+    break;
+  case SHAPE_RAMP:
+  case SHAPE_SAW:
+    table = AUDIO_TABLE(wav_saw_mipmap);
+    symmetry = WAVETABLE_HALF;
+    break;
+  case SHAPE_TRIANGLE:
+    table = AUDIO_TABLE(wav_tri_mipmap);
+    symmetry = WAVETABLE_QUARTER;
+    break;
+  default:
+    return;
+  }
+  // the levels are stored one after the other, each half the size of
+  // the previous one down to the minimum size
+  for (uint8_t i = 0; i < 2; i++) {
+    const int16_t* level = table;
+    for (uint8_t j = 0; j < mipmap_level_[i]; j++)
+      level += WavetableSize(symmetry, MipMapSizeBits(j));
+    mipmap_[i] = level;
+    mipmap_size_bits_[i] = MipMapSizeBits(mipmap_level_[i]);
+  }
+}
+
+void Lfo::set_shape(LfoShape shape) {
+  if (shape >= SHAPE_LAST)
+    shape = SHAPE_SINE;
+  shape_ = shape;
+  if (shape == SHAPE_RANDOM_STEP || shape == SHAPE_RANDOM_SMOOTH)
     random_type_ = RANDOM_WHITE;
-    return ComputeSampleRandom(phase, true);
-  case SHAPE_LOGISTIC_STEP:
-    random_type_ = RANDOM_LOGISTIC;
-    return ComputeSampleRandom(phase, false);
-  case SHAPE_LOGISTIC_SMOOTH:
+  else if (shape == SHAPE_LOGISTIC_STEP || shape == SHAPE_LOGISTIC_SMOOTH)
     random_type_ = RANDOM_LOGISTIC;
-    return ComputeSampleRandom(phase, true);
-  }
-  return 0;			// never reached
+  UpdateMipMap();
+  render_fn_ = fn_table_[shape_][band_limit_tier_];
+}
+
+inline uint32_t Lfo::ComputeOutputs(uint32_t phase) {
+  return ScaleSamples(
+      PackSamples(ComputeSampleSine(phase), (this->*render_fn_)(phase)),
+      level_);
 }
 
-int16_t Lfo::ComputeSampleShape(LfoShape s) {
+inline int16_t Lfo::ComputeBlStep(LfoOutput output, uint32_t weights) {
+  return Saturate16(MultiplyAddSamples(step_[output], weights) >> kBlStepShift);
+}
+
+void Lfo::Render(int16_t* sine, int16_t* shape) {
   if (bl_step_counter_ == 0) {
-    return ComputeSampleShape(s, phase());
+    uint32_t outputs = ComputeOutputs(phase());
+    *sine = LowSample(outputs);
+    *shape = HighSample(outputs);
+    return;
   }
 
-  int32_t end = step_begin_[s];
-  int32_t begin = step_end_[s];
-
-  int32_t step = waveform_table[WAV_BL_STEP0 + reset_subsample_][bl_step_counter_];
-  step = (begin - end) * step / 30000 + end;
-  CONSTRAIN(step, INT16_MIN, INT16_MAX);
+  // both outputs share the position in the band-limited step; the table
+  // goes from the value after the step to the value before
   bl_step_counter_--;
-  return step;
+  int16_t step = AUDIO_TABLE(wav_bl_step)[
+    bl_step_counter_ * kNumBlStepPositions + reset_subsample_];
+  // weights of the values before and after the step
+  uint32_t weights = PackSamples((1 << kBlStepShift) - step, step);
+  *sine = ComputeBlStep(LFO_OUTPUT_SINE, weights);
+  *shape = ComputeBlStep(LFO_OUTPUT_SHAPE, weights);
 }
 
-int16_t Lfo::ComputeSampleSine(uint32_t phase) {
-  int16_t sine = Interpolate1022(wav_sine, phase);
-  return -sine * level_ >> 16;
+template<BandLimitTier tier, WavetableSymmetry symmetry>
+inline int16_t Lfo::BandLimit(int16_t naive, uint32_t phase) {
+  switch (tier) {
+  case BAND_LIMIT_MIPMAP:
+  {
+    int32_t a = InterpolateWave<symmetry>(
+	mipmap_[0], phase, mipmap_size_bits_[0]);
+    int32_t b = InterpolateWave<symmetry>(
+	mipmap_[1], phase, mipmap_size_bits_[1]);
+    return a + ((b - a) * static_cast<int32_t>(band_limit_balance_) >> 16);
+  }
+  case BAND_LIMIT_LOW:
+  {
+    int32_t a = naive;
+    int32_t b = InterpolateWave<symmetry>(
+	mipmap_[0], phase, mipmap_size_bits_[0]);
+    return a + ((b - a) * static_cast<int32_t>(band_limit_balance_) >> 16);
+  }
+  default:
+    return naive;
+  }
 }
 
-int16_t Lfo::ComputeSampleTriangle(uint32_t phase) {
+inline int16_t Lfo::ComputeSampleSine(uint32_t phase) {
+  return -InterpolateQuarterWave(AUDIO_TABLE(wav_sine), phase);
+}
+
+template<BandLimitTier tier>
+inline int16_t Lfo::ComputeSampleTriangle(uint32_t phase) {
   int16_t tri = phase < 1UL << 31
       ? -32768 + (phase >> 15)
       :  32767 - (phase >> 15);
-  uint32_t pi = phase_increment_ / divider_ * multiplier_ >> 16;
-  int16_t x = 0;
-  if (pi > kPI100Hz) {
-    x = Interpolate1022(wav_tri100, phase);
-  } else if (pi > kPI10Hz) {
-    uint16_t balance = (pi - kPI10Hz) * 65535L / (kPI100Hz - kPI10Hz);
-    x = Crossfade1022(wav_tri10, wav_tri100, phase, balance);
-  } else if (pi > kPI1Hz) {
-    uint16_t balance = (pi - kPI1Hz) * 65535L / (kPI10Hz - kPI1Hz);
-    int32_t a = tri;
-    int32_t b = Interpolate1022(wav_tri10, phase);
-    x = a + ((b - a) * static_cast<int32_t>(balance) >> 16);
-  } else {
-    x = tri;
-  }
-  return x * level_ >> 16;
-}
-
-int16_t Lfo::ComputeSampleSaw(uint32_t phase) {
-  return -ComputeSampleRamp(phase);
+  return BandLimit<tier, WAVETABLE_QUARTER>(tri, phase - (1UL << 30));
 }
 
-int16_t Lfo::ComputeSampleRamp(uint32_t phase) {
+template<BandLimitTier tier>
+inline int16_t Lfo::ComputeSampleRamp(uint32_t phase) {
   int16_t ramp = -32678 + (phase >> 16);
-  uint32_t pi = phase_increment_ / divider_ * multiplier_ >> 16;
-  int16_t x = 0;
-  if (pi > kPI100Hz) {
-    x = Interpolate1022(wav_saw100, phase);
-  } else if (pi > kPI10Hz) {
-    uint16_t balance = (pi - kPI10Hz) * 65535L / (kPI100Hz - kPI10Hz);
-    x = Crossfade1022(wav_saw10, wav_saw100, phase, balance);
-  } else if (pi > kPI1Hz) {
-    uint16_t balance = (pi - kPI1Hz) * 65535L / (kPI10Hz - kPI1Hz);
-    int32_t a = ramp;
-    int32_t b = Interpolate1022(wav_saw10, phase);
-    x = a + ((b - a) * static_cast<int32_t>(balance) >> 16);
-  } else {
-    x = ramp;
-  }
-  return x * level_ >> 16;
+  return BandLimit<tier, WAVETABLE_HALF>(ramp, phase);
 }
 
-int16_t Lfo::ComputeSampleTrapezoid(uint32_t phase) {
+template<BandLimitTier tier>
+inline int16_t Lfo::ComputeSampleTrapezoid(uint32_t phase) {
   int16_t tri = phase < 1UL << 31 ? -32768 + (phase >> 15) :  32767 - (phase >> 15);
   int32_t trap = tri * 2;
   CONSTRAIN(trap, INT16_MIN, INT16_MAX);
-  uint32_t pi = phase_increment_ / divider_ * multiplier_ >> 16;
-  int16_t x = 0;
-  if (pi > kPI100Hz) {
-    x = Interpolate1022(wav_trap100, phase);
-  } else if (pi > kPI10Hz) {
-    uint16_t balance = (pi - kPI10Hz) * 65535L / (kPI100Hz - kPI10Hz);
-    x = Crossfade1022(wav_trap10, wav_trap100, phase, balance);
-  } else if (pi > kPI1Hz) {
-    uint16_t balance = (pi - kPI1Hz) * 65535L / (kPI10Hz - kPI1Hz);
-    int32_t a = trap;
-    int32_t b = Interpolate1022(wav_trap10, phase);
-    x = a + ((b - a) * static_cast<int32_t>(balance) >> 16);
-  } else {
-    x = trap;
-  }
-  return x * level_ >> 16;
+  return BandLimit<tier, WAVETABLE_QUARTER>(trap, phase - (1UL << 30));
 }
 
-int16_t Lfo::ComputeSampleSquare(uint32_t phase) {
+inline int16_t Lfo::ComputeSampleSquare(uint32_t phase) {
   int16_t x;
   if (phase < UINT32_MAX / 2)
     x = INT16_MAX;
   else
     x = INT16_MIN >> 3;		// asymmetric square sounds better
 				// when added in Quad mode.
-  return x * level_ >> 16;
+  return x;
 }
 
-int16_t Lfo::ComputeSampleRandom(uint32_t phase, bool interpolation) {
+template<bool interpolation>
+inline int16_t Lfo::ComputeSampleRandom(uint32_t phase) {
   int16_t x;
 
   if (interpolation) {
-    phase = Interpolate1022(wav_sine, (phase / 2) + UINT32_MAX / 4 * 3) + 32768;
-    x = (next_value_ - current_value_) * phase / 65535 + current_value_;
+    phase = InterpolateQuarterWave(AUDIO_TABLE(wav_sine),
+				   (phase / 2) + UINT32_MAX / 4 * 3) + 32768;
+    // phase + (phase >> 15) maps 0..65535 to 0..65536; halved, so that
+    // the product with the 17-bit difference fits in 32 bits
+    int32_t weight = (phase + (phase >> 15)) >> 1;
+    int32_t delta = next_value_ - current_value_;
+    x = current_value_ + (delta * weight >> 15);
   } else {
     x = current_value_;
   }
 
-  return x * level_ >> 16;
+  return x;
 }
 
+template<LfoShape shape, BandLimitTier tier>
+inline int16_t Lfo::RenderShape(uint32_t phase) {
+  switch (shape) {
+  case SHAPE_SINE:
+    return ComputeSampleSine(phase);
+  case SHAPE_TRIANGLE:
+    return ComputeSampleTriangle<tier>(phase);
+  case SHAPE_SAW:
+    return Saturate16(-ComputeSampleRamp<tier>(phase));
+  case SHAPE_RAMP:
+    return ComputeSampleRamp<tier>(phase);
+  case SHAPE_TRAPEZOID:
+    return ComputeSampleTrapezoid<tier>(phase);
+  case SHAPE_SQUARE:
+    return ComputeSampleSquare(phase);
+  case SHAPE_RANDOM_STEP:
+  case SHAPE_LOGISTIC_STEP:
+    return ComputeSampleRandom<false>(phase);
+  case SHAPE_RANDOM_SMOOTH:
+  case SHAPE_LOGISTIC_SMOOTH:
+    return ComputeSampleRandom<true>(phase);
+  case SHAPE_LAST:
+    break;
+  }
+  return 0;			// never reached
+}
+
+/* The renderers are explicit specializations wrapping RenderShape, as
+ * GCC ignores the section attribute of AUDIO_RAMFUNC on implicit
+ * template instances. */
+#define DEFINE_RENDER_FN(s, t) \
+  template<> \
+  AUDIO_RAMFUNC int16_t Lfo::Render<s, t>(uint32_t phase) { \
+    return RenderShape<s, t>(phase); \
+  }
+
+#define DEFINE_RENDER_FN_BAND_LIMITED(s) \
+  DEFINE_RENDER_FN(s, BAND_LIMIT_NONE) \
+  DEFINE_RENDER_FN(s, BAND_LIMIT_LOW) \
+  DEFINE_RENDER_FN(s, BAND_LIMIT_MIPMAP)
+
+DEFINE_RENDER_FN(SHAPE_SINE, BAND_LIMIT_NONE)
+DEFINE_RENDER_FN_BAND_LIMITED(SHAPE_TRAPEZOID)
+DEFINE_RENDER_FN_BAND_LIMITED(SHAPE_RAMP)
+DEFINE_RENDER_FN_BAND_LIMITED(SHAPE_SAW)
+DEFINE_RENDER_FN_BAND_LIMITED(SHAPE_TRIANGLE)
+DEFINE_RENDER_FN(SHAPE_SQUARE, BAND_LIMIT_NONE)
+DEFINE_RENDER_FN(SHAPE_RANDOM_STEP, BAND_LIMIT_NONE)
+DEFINE_RENDER_FN(SHAPE_RANDOM_SMOOTH, BAND_LIMIT_NONE)
+DEFINE_RENDER_FN(SHAPE_LOGISTIC_STEP, BAND_LIMIT_NONE)
+DEFINE_RENDER_FN(SHAPE_LOGISTIC_SMOOTH, BAND_LIMIT_NONE)
+
+#undef DEFINE_RENDER_FN
+#undef DEFINE_RENDER_FN_BAND_LIMITED
+
+/* shapes without band-limiting use the same renderer for every tier */
+#define RENDER_FN(s) \
+  { &Lfo::Render<s, BAND_LIMIT_NONE>, \
+    &Lfo::Render<s, BAND_LIMIT_NONE>, \
+    &Lfo::Render<s, BAND_LIMIT_NONE> }
+
+#define RENDER_FN_BAND_LIMITED(s) \
+  { &Lfo::Render<s, BAND_LIMIT_NONE>, \
+    &Lfo::Render<s, BAND_LIMIT_LOW>, \
+    &Lfo::Render<s, BAND_LIMIT_MIPMAP> }
+
+/* static */
+const Lfo::RenderFn Lfo::fn_table_[SHAPE_LAST][BAND_LIMIT_LAST] = {
+  RENDER_FN(SHAPE_SINE),
+  RENDER_FN_BAND_LIMITED(SHAPE_TRAPEZOID),
+  RENDER_FN_BAND_LIMITED(SHAPE_RAMP),
+  RENDER_FN_BAND_LIMITED(SHAPE_SAW),
+  RENDER_FN_BAND_LIMITED(SHAPE_TRIANGLE),
+  RENDER_FN(SHAPE_SQUARE),
+  RENDER_FN(SHAPE_RANDOM_STEP),
+  RENDER_FN(SHAPE_RANDOM_SMOOTH),
+  RENDER_FN(SHAPE_LOGISTIC_STEP),
+  RENDER_FN(SHAPE_LOGISTIC_SMOOTH),
+};
+
+#undef RENDER_FN
+#undef RENDER_FN_BAND_LIMITED
+
 }  // namespace batumi
@@ -30,16 +30,25 @@
 #define BATUMI_MODULATIONS_LFO_H_
 
 #include "stmlib/stmlib.h"
+#include "drivers/audio_ram.h"
+#include "dsp.h"
 #include "resources.h"
+#include "wavetable.h"
 
 namespace batumi {
 
 const int16_t kOctave = 12 * 128;
 
-/* phase increment values for given frequencies */
-const uint32_t kPI1Hz = UINT16_MAX / SAMPLE_RATE * 1;
-const uint32_t kPI10Hz = UINT16_MAX / SAMPLE_RATE * 10;
-const uint32_t kPI100Hz = UINT16_MAX / SAMPLE_RATE * 100;
+// pitches given to the LFOs have kPitchFractionBits more bits than
+// kOctave; lut_pitch_increments holds the increment of every
+// kNumPitchFractions-th pitch of an octave, and lut_pitch_fractions the
+// ratios of the pitches in between
+const uint8_t kPitchFractionBits = 4;
+const int32_t kPitchOctave = kOctave << kPitchFractionBits;
+const uint8_t kPitchFractionShift = 8;
+const int32_t kNumPitchFractions = 1 << kPitchFractionShift;
+// octaves added to the pitches to split them with unsigned arithmetic
+const int32_t kPitchOctaveBias = 32;
 
 enum LfoShape {
   SHAPE_SINE,
@@ -52,9 +61,33 @@ enum LfoShape {
   SHAPE_RANDOM_SMOOTH,
   SHAPE_LOGISTIC_STEP,
   SHAPE_LOGISTIC_SMOOTH,
+  SHAPE_LAST
 };
 
-const uint8_t kNumLfoShapes = 5;
+/* band-limited step applied on reset: number of samples, of sub-sample
+ * positions, and normalization of the wav_bl_step table */
+const uint8_t kBlStepLength = 8;
+const uint8_t kNumBlStepPositions = 32;
+const uint8_t kBlStepShift = 14;
+
+/* mip-maps of the band-limited shapes (wav_*_mipmap): level i holds
+ * 128 >> i harmonics, free of aliasing for phase increments below
+ * 2^(kMipMapBaseBits + 1 + i), in a period of 2^(10 - i) samples but
+ * no less than 128 */
+const uint8_t kNumMipMapLevels = 8;
+const uint8_t kMipMapBaseBits = 23;	// 32Hz at 16384Hz
+
+AUDIO_INLINE uint8_t MipMapSizeBits(uint8_t level) {
+  return level < 3 ? 10 - level : 7;
+}
+
+/* band-limiting strategy, depending on the phase increment */
+enum BandLimitTier {
+  BAND_LIMIT_NONE,		// below 2^20: naive waveform
+  BAND_LIMIT_LOW,		// 2^20-2^21: naive blended with first level
+  BAND_LIMIT_MIPMAP,		// above 2^21: crossfade of two levels
+  BAND_LIMIT_LAST
+};
 
 class Lfo {
  public:
@@ -63,44 +96,75 @@ class Lfo {
   ~Lfo() { }
   
   void Init();
-  void Step();
-
-  inline void set_pitch(int16_t pitch) {
-    if (pitch == INT16_MIN)
-      phase_increment_ = 0;
-    else
-      phase_increment_ = ComputePhaseIncrement(pitch);
+  AUDIO_RAMFUNC void Step();
+#ifdef ADAPTIVE_RATE
+  // steps num_samples samples at once
+  AUDIO_RAMFUNC void Step(uint8_t num_samples);
+
+  // whether the outputs can be rendered every few samples and
+  // interpolated: below max_increment, and out of a reset step
+  AUDIO_INLINE bool slow(uint32_t max_increment) const {
+    return increment_ < max_increment && bl_step_counter_ == 0;
+  }
+#endif  // ADAPTIVE_RATE
+
+  // pitch in 1/(128 << kPitchFractionBits) semitone; the increment is
+  // only computed when it changes
+  inline void set_pitch(int32_t pitch) {
+    if (pitch == pitch_)
+      return;
+    pitch_ = pitch;
+    phase_increment_ = ComputePhaseIncrement(pitch);
+    UpdateIncrement();
   };
 
+  // period in 1/32 of a sample; the division is done on 64 bits, which
+  // keeps the fractional part at any period, and only runs when the clock
+  // changes
   inline void set_period(uint32_t period) {
-    phase_increment_ = UINT32_MAX / period;
+    phase_increment_ = (static_cast<uint64_t>(UINT32_MAX) << 5) / period;
+    pitch_ = kNoPitch;
+    UpdateIncrement();
   }
 
   inline void set_initial_phase(uint16_t phase) {
     initial_phase_ = phase << 16;
   }
 
-  inline void align() {
-    alignment_phase_ = -phase_;
+  // the phase is aligned to an edge that occurred delay/32 samples ago
+  AUDIO_INLINE void align(uint16_t delay) {
+    uint32_t elapsed = PhaseAdvance(phase_increment_, delay);
+    alignment_phase_ = direction_ ? elapsed - phase_ : -elapsed - phase_;
+    divided_alignment_ = alignment_phase_ / divider_;
   }
 
   inline void set_divider(uint16_t divider) {
+    if (divider == divider_)
+      return;
     divider_ = divider;
+    divider_reciprocal_ = UINT32_MAX / divider_;
+    divided_alignment_ = alignment_phase_ / divider_;
+    cycle_index_ = cycle_counter_ % divider_;
+    cycle_offset_ = divider_reciprocal_ * cycle_index_;
+    UpdateIncrement();
   }
 
   inline void set_multiplier(uint16_t mult) {
+    if (mult == multiplier_)
+      return;
     multiplier_ = mult;
+    UpdateIncrement();
   }
 
   inline void set_level(uint16_t level) {
     level_ = level;
   }
 
-  inline uint16_t level() {
+  AUDIO_INLINE uint16_t level() {
     return level_;
   }
 
-  inline void set_direction(bool direction) {
+  AUDIO_INLINE void set_direction(bool direction) {
     direction_ = direction;
   }
 
@@ -108,57 +172,124 @@ class Lfo {
     return direction_;
   }
 
-  inline void set_hold(bool hold) {
+  AUDIO_INLINE void set_hold(bool hold) {
     hold_ = hold;
   }
 
-  void Reset(uint8_t subsample);
+  // state reported by the trace
+  inline uint32_t increment() const { return increment_; }
+  inline uint16_t divider() const { return divider_; }
+  inline uint16_t multiplier() const { return multiplier_; }
+  inline bool bl_step_active() const { return bl_step_counter_ != 0; }
+
+  // phase of the outputs
+  AUDIO_INLINE uint32_t phase() const {
+    return multiplied_phase_ + initial_phase_ + divided_alignment_
+      + UINT32_MAX / 1000 * 3;
+  }
+
+  // selects the shape rendered on the second output of Render()
+  void set_shape(LfoShape shape);
+
+  // restarts the LFO from an edge that occurred delay/32 samples ago
+  AUDIO_RAMFUNC void Reset(uint16_t delay);
 
-  inline void link_to(Lfo *lfo) {
+  // makes this LFO follow lfo, whose accumulator, direction and
+  // frequency it reads when it steps; lfo must step after it
+  inline void link_to(const Lfo* lfo) {
     linked_ = lfo;
-    phase_ = lfo->phase_;
-    direction_ = lfo->direction_;
-    alignment_phase_ = lfo->alignment_phase_;
-    phase_increment_ = lfo->phase_increment_;
   }
 
-  int16_t ComputeSampleShape(LfoShape s);
-  int16_t ComputeSampleSine(uint32_t phase);
-  int16_t ComputeSampleTriangle(uint32_t phase);
-  int16_t ComputeSampleTrapezoid(uint32_t phase);
-  int16_t ComputeSampleRamp(uint32_t phase);
-  int16_t ComputeSampleSaw(uint32_t phase);
-  int16_t ComputeSampleSquare(uint32_t phase);
-  int16_t ComputeSampleRandom(uint32_t phase, bool interpolation);
+  // renders the samples of the sine output and of the selected shape
+  // output
+  AUDIO_RAMFUNC void Render(int16_t* sine, int16_t* shape);
 
  private:
 
-  inline uint32_t phase() {
-    return multiplied_phase_ + initial_phase_ + alignment_phase_ / divider_
-      + UINT32_MAX / 1000 * 3;
+  enum LfoOutput {
+    LFO_OUTPUT_SINE,
+    LFO_OUTPUT_SHAPE,
+    LFO_OUTPUT_LAST
+  };
+
+  // the renderers of the shapes return them at full level
+  typedef int16_t (Lfo::*RenderFn)(uint32_t phase);
+
+  template<LfoShape shape, BandLimitTier tier>
+  AUDIO_RAMFUNC int16_t Render(uint32_t phase);
+  template<LfoShape shape, BandLimitTier tier>
+  AUDIO_INLINE int16_t RenderShape(uint32_t phase);
+  template<BandLimitTier tier, WavetableSymmetry symmetry>
+  AUDIO_INLINE int16_t BandLimit(int16_t naive, uint32_t phase);
+  AUDIO_INLINE int16_t ComputeSampleSine(uint32_t phase);
+  template<BandLimitTier tier>
+  AUDIO_INLINE int16_t ComputeSampleTriangle(uint32_t phase);
+  template<BandLimitTier tier>
+  AUDIO_INLINE int16_t ComputeSampleTrapezoid(uint32_t phase);
+  template<BandLimitTier tier>
+  AUDIO_INLINE int16_t ComputeSampleRamp(uint32_t phase);
+  AUDIO_INLINE int16_t ComputeSampleSquare(uint32_t phase);
+  template<bool interpolation>
+  AUDIO_INLINE int16_t ComputeSampleRandom(uint32_t phase);
+
+  static const RenderFn fn_table_[SHAPE_LAST][BAND_LIMIT_LAST];
+
+  // also called from Advance(), when a follower gets a new increment
+  AUDIO_RAMFUNC void UpdateIncrement();
+  AUDIO_RAMFUNC void UpdateMipMap();
+  AUDIO_INLINE void Advance(uint8_t num_samples);
+
+  // phase covered in time/32 samples, without overflowing 32 bits
+  static AUDIO_INLINE uint32_t PhaseAdvance(uint32_t increment, uint32_t time) {
+    return (time >> 5) * increment + (time & 31) * (increment >> 5);
   }
 
-  int16_t ComputeSampleShape(LfoShape s, uint32_t phase);
-  void ComputeNextRandom();
+  // the samples of the two outputs, packed and scaled by the level
+  AUDIO_INLINE uint32_t ComputeOutputs(uint32_t phase);
+  AUDIO_INLINE int16_t ComputeBlStep(LfoOutput output, uint32_t weights);
+  AUDIO_RAMFUNC void ComputeNextRandom();
+
+  // the increment was not set from a pitch
+  static const int32_t kNoPitch = INT32_MIN;
 
-  uint32_t ComputePhaseIncrement(int16_t pitch);
+  uint32_t ComputePhaseIncrement(int32_t pitch);
   uint32_t phase_, divided_phase_, multiplied_phase_;
   uint16_t divider_, cycle_counter_;
   uint16_t multiplier_;
   uint16_t level_;
   uint32_t initial_phase_, alignment_phase_;
   uint32_t phase_increment_;
+  int32_t pitch_;
+
+  /* cached values derived from the divider and multiplier, so that
+   * Step() needs no division: */
+  uint32_t increment_;		// phase_increment_ / divider_ * multiplier_
+  uint32_t divider_reciprocal_;	// UINT32_MAX / divider_
+  uint32_t divided_alignment_;	// alignment_phase_ / divider_
+  uint16_t cycle_index_;	// cycle_counter_ % divider_
+  uint32_t cycle_offset_;	// divider_reciprocal_ * cycle_index_
+
+  /* band-limiting tier and crossfade amount, updated with the
+   * increment, and the two mip-map levels crossfaded, updated with the
+   * increment and the shape */
+  BandLimitTier band_limit_tier_;
+  uint16_t band_limit_balance_;
+  uint8_t mipmap_level_[2];
+  const int16_t* mipmap_[2];
+  uint8_t mipmap_size_bits_[2];
+
+  LfoShape shape_;
+  RenderFn render_fn_;
   uint16_t bl_step_counter_;
   uint8_t reset_subsample_;
   uint16_t logistic_seed_;
   bool next_random_armed_;
-  Lfo* linked_;
+  const Lfo* linked_;
   bool direction_, hold_;
 
-  /* values of the oscillators for each shape before and
-   * after reset */
-  int16_t step_begin_[kNumLfoShapes];
-  int16_t step_end_[kNumLfoShapes];
+  /* values of the two outputs before reset (low half) and after
+   * reset (high half) */
+  uint32_t step_[LFO_OUTPUT_LAST];
 
   /* random waveshapes */
   int16_t next_value_;
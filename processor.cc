@@ -44,24 +44,54 @@ const int16_t kUnsyncPotThreshold = INT16_MAX / 20;
 const int16_t kResetThresholdLow = 10000;
 const int16_t kResetThresholdHigh = 20000;
 
-void Processor::Init(Ui *ui, Adc *adc, Dac *dac) {
+// the CV filter runs on each new CV reading, i.e. every
+// kAdcRefreshPeriod (8) samples: 64 samples time constant
+const uint8_t kCvFilterShift = 3;
+
+void Processor::Init(Ui *ui, Adc *adc, Dac *dac, Tracer *tracer) {
   ui_ = ui;
   adc_ = adc;
   dac_ = dac;
-  previous_feat_mode_ = FEAT_MODE_LAST;
+  tracer_ = tracer;
+  feat_mode_ = FEAT_MODE_LAST;
+  process_fn_ = process_fn_table_[FEAT_MODE_FREE];
+  control_counter_ = 0;
   // no need to Init the LFOs, it'll be done in Process on first run
   for (uint8_t i=0; i<kNumChannels; i++) {
     reset_trigger_armed_[i]= false;
+    reset_triggered_[i] = false;
+    reset_pending_[i] = false;
     last_reset_[i] = 0;
+    reset_delay_[i] = 0;
+    clock_tracker_[i].Init();
+    previous_reset_[i] = 0;
+    filtered_cv_[i] = 0;
+    quad_gain_reciprocal_[i] = 1L << kQuadGainShift;
+#ifdef ADAPTIVE_RATE
+    output_[i] = output_[kNumChannels + i] = 0;
+#endif  // ADAPTIVE_RATE
+    reset_sequence_[i] = adc->reset_sequence(i);
+    cv_sequence_[i] = adc->cv_sequence(i);
   }
   waveform_offset_ = 0;
+  quadrature_ = false;
+#ifdef ADAPTIVE_RATE
+  reduced_rate_samples_ = 0;
+#endif  // ADAPTIVE_RATE
 }
 
-inline int16_t AdcValuesToPitch(uint16_t coarse, int16_t fine, int16_t cv) {
-  coarse = Interpolate88(lut_scale_pitch, coarse) - 32768;
-  fine = (1 * kOctave * static_cast<int32_t>(fine)) >> 16;
-  cv = cv * 5 * kOctave >> 15;
-  return coarse + fine + cv;
+// pitch in 1/(128 << kPitchFractionBits) semitone; the coarse pitch is
+// interpolated to the same resolution
+inline int32_t AdcValuesToPitch(uint16_t coarse, int16_t fine, int16_t cv) {
+  int32_t a = lut_scale_pitch[coarse >> 8];
+  int32_t b = lut_scale_pitch[(coarse >> 8) + 1];
+  int32_t pitch = ((a - 32768) << kPitchFractionBits) +
+    ((b - a) * static_cast<int32_t>(coarse & 0xff) >>
+     (8 - kPitchFractionBits));
+  pitch += (1 * kOctave * static_cast<int32_t>(fine)) >>
+    (16 - kPitchFractionBits);
+  pitch += (cv * 5 * kOctave) >> (15 - kPitchFractionBits);
+  return pitch;
 }
 
 inline uint8_t AdcValuesToDivider(uint16_t pot, int16_t fine, int16_t cv) {
@@ -141,22 +171,7 @@ void Processor::SetFrequency(int8_t lfo_no) {
     }
   }
 
-  // sync or reset
-  if (reset_triggered_[lfo_no]) {
-    if (ui_->sync_mode()) {
-      lfo_[lfo_no].set_period(last_reset_[lfo_no]);
-      lfo_[lfo_no].align();
-      synced_[lfo_no] = true;
-    } else {
-      lfo_[lfo_no].Reset(reset_subsample_[lfo_no]);
-    }
-    reset_trigger_armed_[lfo_no] = false;
-    last_reset_[lfo_no] = 0;
-  } else {
-    last_reset_[lfo_no]++;
-  }
-
-  int16_t pitch = AdcValuesToPitch(ui_->coarse(lfo_no),
+  int32_t pitch = AdcValuesToPitch(ui_->coarse(lfo_no),
 				   ui_->fine(lfo_no),
 				   cv);
 
@@ -172,137 +187,310 @@ void Processor::SetFrequency(int8_t lfo_no) {
     last_coarse_[lfo_no] = ui_->coarse(lfo_no);
     synced_[lfo_no] = false;
   }
+
+  // follow the clock
+  if (clock_tracker_[lfo_no].Update() && synced_[lfo_no])
+    lfo_[lfo_no].set_period(clock_tracker_[lfo_no].period());
 }
 
-void Processor::Process() {
+bool Processor::ProcessTrigger(int8_t lfo_no) {
+  // sync or reset; like the control path, they wait for the end of a
+  // flash write. The trigger is latched meanwhile, even if the pulse ends
+  // before, and its delay keeps counting from the edge.
+  if (reset_triggered_[lfo_no])
+    reset_pending_[lfo_no] = true;
+  if (reset_pending_[lfo_no] && !ui_->saving()) {
+    uint16_t delay = reset_delay_[lfo_no];
+    uint32_t interval = last_reset_[lfo_no] + 32 - delay;
+    if (ui_->sync_mode()) {
+      tracer_->Write(TRACE_RECORD_SYNC, lfo_no, delay, interval,
+		     clock_tracker_[lfo_no].period());
+      // interval between the two edges; the period follows at control
+      // rate
+      clock_tracker_[lfo_no].Tap(interval);
+      lfo_[lfo_no].align(delay);
+      synced_[lfo_no] = true;
+    } else {
+      tracer_->Write(TRACE_RECORD_RESET, lfo_no, delay, interval, 0);
+      lfo_[lfo_no].Reset(delay);
+    }
+    reset_trigger_armed_[lfo_no] = false;
+    reset_pending_[lfo_no] = false;
+    last_reset_[lfo_no] = delay;
+    return true;
+  }
+  AgeReset(lfo_no);
+  if (reset_pending_[lfo_no] && reset_delay_[lfo_no] <= UINT16_MAX - 32)
+    reset_delay_[lfo_no] += 32;
+  return false;
+}
 
-  // do not run during the splash animation
-  if (ui_->mode() == UI_MODE_SPLASH)
-    return;
+void Processor::ProcessControl(uint8_t stage) {
+  if (stage == CONTROL_STAGE_MODE) {
+    UpdateMode();
+  } else if (stage < CONTROL_STAGE_MIX) {
+    UpdateChannel(stage - CONTROL_STAGE_CHANNEL);
+  } else if (stage == CONTROL_STAGE_MIX) {
+    if (feat_mode_ == FEAT_MODE_QUAD)
+      UpdateQuadGains();
+  } else {
+    UpdateShape(stage - CONTROL_STAGE_SHAPE);
+  }
+}
+
+void Processor::UpdateMode() {
 
   // reset the LFOs if mode changed
-  if (ui_->feat_mode() != previous_feat_mode_) {
+  if (ui_->feat_mode() != feat_mode_) {
     for (int i=0; i<kNumChannels; i++)
       lfo_[i].Init();
-    previous_feat_mode_ = ui_->feat_mode();
+    feat_mode_ = ui_->feat_mode();
+    process_fn_ = process_fn_table_[feat_mode_];
     waveform_offset_ = 0;
+    // a trigger latched for the previous mode may not be delivered in
+    // this one
+    for (int i=0; i<kNumChannels; i++)
+      reset_pending_[i] = false;
+#ifdef ADAPTIVE_RATE
+    // the rest of a block rendered at the reduced rate would hold the
+    // outputs and the triggers of the previous mode
+    reduced_rate_samples_ = 0;
+#endif  // ADAPTIVE_RATE
+    // in the other modes, the LFOs follow the 1st one
+    if (feat_mode_ != FEAT_MODE_FREE)
+      for (int i=1; i<kNumChannels; i++)
+	lfo_[i].link_to(&lfo_[0]);
   }
 
-  for (int i=0; i<kNumChannels; i++) {
-    // set level
-    if (ui_->feat_mode() != FEAT_MODE_QUAD)
-      lfo_[i].set_level(AdcValuesToLevel(ui_->level(i), 0, 0));
-    // filter CV
-    filtered_cv_[i] += (adc_->cv(i) - filtered_cv_[i]) >> 6;
+  // in phase mode, if all the pots are maxed out, quadrature mode
+  quadrature_ = true;
+  for (int i=1; i<kNumChannels; i++)
+    quadrature_ = quadrature_ && ui_->coarse(i) > UINT16_MAX - 256;
+}
 
-    // detect triggers on the reset input
-    int16_t reset = adc_->reset(i);
+void Processor::UpdateChannel(uint8_t i) {
+  Lfo& lfo = lfo_[i];
 
-    if (reset < kResetThresholdLow)
-      reset_trigger_armed_[i] = true;
-
-    if (reset > kResetThresholdHigh &&
-	reset_trigger_armed_[i]) {
-      reset_triggered_[i] = true;
-      int32_t dist_to_trig = kResetThresholdHigh - previous_reset_[i];
-      int32_t dist_to_next = reset - previous_reset_[i];
-      reset_subsample_[i] = dist_to_trig * 32L / dist_to_next;
-    } else {
-      reset_triggered_[i] = false;
-    }
+  // set level
+  if (feat_mode_ != FEAT_MODE_QUAD || i == 0)
+    lfo.set_level(AdcValuesToLevel(ui_->level(i), 0, 0));
 
-    previous_reset_[i] = reset;
+  // the 1st channel sets frequency as usual, in all modes
+  if (i == 0 || feat_mode_ == FEAT_MODE_FREE) {
+    SetFrequency(i);
+    if (feat_mode_ != FEAT_MODE_PHASE)
+      lfo.set_initial_phase(ui_->phase(i));
+    return;
   }
 
-  switch (ui_->feat_mode()) {
+  // the others are special cases
+  int16_t cv = (filtered_cv_[i] * ui_->atten(i)) >> 16;
+
+  switch (feat_mode_) {
 
-  case FEAT_MODE_FREE:
+  case FEAT_MODE_QUAD:
   {
-    for (uint8_t i=0; i<kNumChannels; i++) {
-      SetFrequency(i);
-      lfo_[i].set_initial_phase(ui_->phase(i));
-    }
+    // main pot and CV sets level
+    lfo.set_level(AdcValuesToLevel(ui_->coarse(i), ui_->fine(i), cv));
+
+    // channel i is divided by i+1; second parameter adjusts divider
+    int16_t div = (7 * static_cast<int32_t>(65535 - ui_->level(i))) >> 16;
+    div += i + 1;
+    CONSTRAIN(div, 1, 16);
+    lfo.set_divider(div);
+
+    // last parameter controls phase
+    lfo.set_initial_phase(ui_->phase(i));
   }
   break;
 
-  case FEAT_MODE_QUAD:
+  case FEAT_MODE_PHASE:
   {
-    // 1st channel sets frequency as usual
-    SetFrequency(0);
-    lfo_[0].set_initial_phase(ui_->phase(0));
+    if (quadrature_) {
+      lfo.set_initial_phase((kNumChannels - i) * (UINT16_MAX / kNumChannels));
+    } else { // normal phase mode
+      lfo.set_initial_phase(AdcValuesToPhase(ui_->coarse(i),
+					     ui_->fine(i),
+					     cv));
+      int16_t div = (7 * static_cast<int32_t>(65535 - ui_->phase(i))) >> 16;
+      CONSTRAIN(div, 1, 16);
+      lfo.set_divider(div);
+    }
+  }
+  break;
 
-    // reset 2 holds the LFOs
-    lfo_[0].set_hold(reset_triggered_[1]);
-    // reset 3 changes direction
-    lfo_[0].set_direction(!reset_triggered_[2]);
-    // reset 4 changes waveform
-    if (reset_triggered_[3]) {
-      waveform_offset_++;
-      reset_trigger_armed_[3] = false;
+  case FEAT_MODE_DIVIDE:
+  {
+    // lfo.set_divider(AdcValuesToDivider(ui_->coarse(i),
+    // 				     ui_->fine(i),
+    // 				     cv));
+    // Expanded: Multiply value in Divide mode.
+    int8_t divMult = AdcValuesToDividerMultiplier(ui_->coarse(i),
+						  ui_->fine(i),
+						  cv);
+    if (divMult > 1) {
+      lfo.set_multiplier(1);
+      lfo.set_divider(divMult);
+    } else if (divMult < -1) {
+      lfo.set_multiplier(-divMult);
+      lfo.set_divider(1);
+    } else {
+      lfo.set_multiplier(1);
+      lfo.set_divider(1);
     }
+    lfo.set_initial_phase(ui_->phase(i));
+  }
+  break;
+
+  default: break;		// to please the compiler
+  }
+}
 
-    lfo_[0].set_level(AdcValuesToLevel(ui_->level(0), 0, 0));
+void Processor::UpdateQuadGains() {
+  // each output mixes its LFO with the following ones, normalized once
+  // their levels add up to more than unity gain; rounded down, so that
+  // the mix stays within 16 bits
+  uint32_t gain = 0;
+  for (int i=kNumChannels-1; i>=0; i--) {
+    gain += lfo_[i].level();
+    uint32_t g = gain < UINT16_MAX ? UINT16_MAX : gain;
+    quad_gain_reciprocal_[i] = (1UL << (16 + kQuadGainShift)) / g;
+  }
+}
 
-    // the others are special cases
-    for (int i=1; i<kNumChannels; i++) {
+void Processor::UpdateShape(uint8_t i) {
+  int ui_shape = ui_->shape(i);
+  uint8_t offset = 0;
+  switch (ui_->bank(i)) {
+  case BANK_CLASSIC:
+    offset = SHAPE_TRAPEZOID;
+    break;
+
+  case BANK_RANDOM:
+    // RANDOM is not affected by panel switches, but by random waveform setting
+    ui_shape = ui_->random_waveform_index(i);
+    offset = SHAPE_RANDOM_STEP;
+    break;
+
+  default:
+    offset = 42;
+    break;
+  }
 
-      // main pot and CV sets level
-      int32_t cv = (filtered_cv_[i] * ui_->atten(i)) >> 16;
-      lfo_[i].set_level(AdcValuesToLevel(ui_->coarse(i), ui_->fine(i), cv));
+  int s = ((ui_shape + waveform_offset_) % 4) + offset;
+  LfoShape shape = static_cast<LfoShape>(s);
 
-      // channel i is divided by i+1; second parameter adjusts divider
-      lfo_[i].link_to(&lfo_[0]);
-      int16_t div = (7 * static_cast<int32_t>(65535 - ui_->level(i))) >> 16;
-      div += i + 1;
-      CONSTRAIN(div, 1, 16);
-      lfo_[i].set_divider(div);
+  // exception: in quad mode, trapezoid becomes square
+  if (feat_mode_ == FEAT_MODE_QUAD &&
+      shape == SHAPE_TRAPEZOID)
+    shape = SHAPE_SQUARE;
 
-      // last parameter controls phase
-      lfo_[i].set_initial_phase(ui_->phase(i));
+  lfo_[i].set_shape(shape);
+}
+
+inline void Processor::DetectTrigger(uint8_t lfo_no) {
+  if (adc_->reset_sequence(lfo_no) == reset_sequence_[lfo_no]) {
+    // between two readings of the reset input, a trigger stays active
+    // until it is consumed (gates on the hold/direction inputs)
+    reset_triggered_[lfo_no] = reset_triggered_[lfo_no] &&
+      reset_trigger_armed_[lfo_no];
+  } else {
+    reset_sequence_[lfo_no] = adc_->reset_sequence(lfo_no);
+
+    // detect triggers on the reset input
+    int16_t reset = adc_->reset(lfo_no);
+
+    if (reset < kResetThresholdLow)
+      reset_trigger_armed_[lfo_no] = true;
+
+    reset_triggered_[lfo_no] = reset > kResetThresholdHigh &&
+      reset_trigger_armed_[lfo_no];
+
+    // a latched trigger keeps the delay of its own edge
+    if (reset_triggered_[lfo_no] && !reset_pending_[lfo_no]) {
+      // position of the crossing between the two readings, which are
+      // kAdcRefreshPeriod samples apart, in 1/32 of a sample
+      int32_t dist_to_trig = kResetThresholdHigh - previous_reset_[lfo_no];
+      int32_t dist_to_next = reset - previous_reset_[lfo_no];
+      // a held gate keeps hold/direction inputs armed with a flat
+      // signal; the Cortex-M3 division yields 0 there, do the same.
+      int32_t position = dist_to_next
+	? dist_to_trig * 32L * kAdcRefreshPeriod / dist_to_next
+	: 0;
+      // the edge is timestamped from there and from the conversion time
+      reset_delay_[lfo_no] = kAdcRefreshPeriod * 32 - position +
+	adc_->reset_age(lfo_no);
     }
+
+    previous_reset_[lfo_no] = reset;
   }
-  break;
+}
 
-  case FEAT_MODE_PHASE:
-  {
-    SetFrequency(0);
+void Processor::Process() {
 
-    // reset 2 holds the LFOs
-    lfo_[0].set_hold(reset_triggered_[1]);
-    // reset 3 changes direction
-    lfo_[0].set_direction(!reset_triggered_[2]);
-    // reset 4 changes waveform
-    if (reset_triggered_[3]) {
-      waveform_offset_++;
-      reset_trigger_armed_[3] = false;
+  // do not run during the splash animation, unless started from the
+  // stored settings
+  if (ui_->mode() == UI_MODE_SPLASH && !ui_->fast_start())
+    return;
+
+  // parameters are mapped at control rate, one stage on each of the first
+  // samples of the control period; the rest runs on every sample. The
+  // control path runs from flash, it pauses while it is written
+  if (control_counter_ < CONTROL_STAGE_LAST && !ui_->saving())
+    ProcessControl(control_counter_);
+  if (++control_counter_ == kControlRateDivider)
+    control_counter_ = 0;
+
+  (this->*process_fn_)();
+
+  // the state of one channel after the other
+  if (tracer_->Tick()) {
+    uint8_t i = tracer_->channel(kNumChannels);
+    const Lfo& lfo = lfo_[i];
+    uint16_t aux = (lfo.bl_step_active() << 15) |
+      ((lfo.multiplier() & 0x7f) << 8) | (lfo.divider() & 0xff);
+    tracer_->Write(TRACE_RECORD_STATE, i, aux, lfo.phase(), lfo.increment());
+  }
+}
+
+template<FeatureMode mode>
+inline void Processor::RunMode() {
+  // first sweep: inputs, and in free mode the resets they trigger
+  for (int i=0; i<kNumChannels; i++) {
+    // filter CV, on new readings only
+    if (adc_->cv_sequence(i) != cv_sequence_[i]) {
+      cv_sequence_[i] = adc_->cv_sequence(i);
+      filtered_cv_[i] += (adc_->cv(i) - filtered_cv_[i]) >> kCvFilterShift;
     }
 
-    // if all the pots are maxed out, quadrature mode
-    if (ui_->coarse(1) > UINT16_MAX - 256 &&
-	ui_->coarse(2) > UINT16_MAX - 256 &&
-	ui_->coarse(3) > UINT16_MAX - 256)
-      for (int i=1; i<kNumChannels; i++) {
-	lfo_[i].link_to(&lfo_[0]);
-	lfo_[i].set_initial_phase((kNumChannels - i) * (UINT16_MAX >> 2));
-      }
-    else // normal phase mode
-      for (int i=1; i<kNumChannels; i++) {
-	lfo_[i].link_to(&lfo_[0]);
-	int16_t cv = (filtered_cv_[i] * ui_->atten(i)) >> 16;
-	lfo_[i].set_initial_phase(AdcValuesToPhase(ui_->coarse(i),
-						   ui_->fine(i),
-						   cv));
-	int16_t div = (7 * static_cast<int32_t>(65535 - ui_->phase(i))) >> 16;
-	CONSTRAIN(div, 1, 16);
-	lfo_[i].set_divider(div);
-      }
+#ifdef ADAPTIVE_RATE
+    // within a block rendered at the reduced rate, the LFOs have already
+    // stepped to its end: triggers wait for it, and age meanwhile
+    if (reduced_rate_samples_) {
+      AgeReset(i);
+      if (!reset_triggered_[i])
+	DetectTrigger(i);
+      if (reset_triggered_[i])
+	reset_delay_[i] += 32;
+      continue;
+    }
+#endif  // ADAPTIVE_RATE
+
+    DetectTrigger(i);
+
+    if (mode == FEAT_MODE_FREE)
+      ProcessTrigger(i);
   }
-  break;
 
-  case FEAT_MODE_DIVIDE:
-  {
-    SetFrequency(0);
-    lfo_[0].set_initial_phase(ui_->phase(0));
+#ifdef ADAPTIVE_RATE
+  if (reduced_rate_samples_) {
+    InterpolateOutputs();
+    return;
+  }
+#endif  // ADAPTIVE_RATE
+
+  if (mode != FEAT_MODE_FREE) {
+    bool reset = ProcessTrigger(0);
 
     // reset 2 holds the LFOs
     lfo_[0].set_hold(reset_triggered_[1]);
@@ -314,92 +502,131 @@ void Processor::Process() {
       reset_trigger_armed_[3] = false;
     }
 
-    for (int i=1; i<kNumChannels; i++) {
-      lfo_[i].link_to(&lfo_[0]);
-      int16_t cv = (filtered_cv_[i] * ui_->atten(i)) >> 16;
-      // lfo_[i].set_divider(AdcValuesToDivider(ui_->coarse(i),
-			// 		     ui_->fine(i),
-			// 		     cv));
-      // Expanded: Multiply value in Divide mode.
-      int8_t divMult = AdcValuesToDividerMultiplier(ui_->coarse(i),
-					     ui_->fine(i),
-					     cv);
-      if (divMult > 1) {
-        lfo_[i].set_multiplier(1);
-        lfo_[i].set_divider(divMult);
-      } else if (divMult < -1) {
-        lfo_[i].set_multiplier(-divMult);
-        lfo_[i].set_divider(1);
-      } else {
-        lfo_[i].set_multiplier(1);
-        lfo_[i].set_divider(1);
-      }
-      lfo_[i].set_initial_phase(ui_->phase(i));
-      // when 1st channel resets, all other channels reset
-      if (!ui_->sync_mode() && reset_triggered_[0]) {
-	lfo_[i].Reset(reset_subsample_[0]);
-      }
-    }
-  }
-  break;
+    // in divide mode, when 1st channel resets, all other channels reset
+    bool divide_reset = mode == FEAT_MODE_DIVIDE &&
+      !ui_->sync_mode() && reset;
 
-  case FEAT_MODE_LAST: break;	// to please the compiler
+    if (divide_reset)
+      for (int i=1; i<kNumChannels; i++)
+	lfo_[i].Reset(reset_delay_[0]);
   }
 
-  LfoShape shape[4];
-  for (int i=0; i<4; i++) {
-    int ui_shape = ui_->shape(i);
-    uint8_t offset = 0;
-    switch (ui_->bank(i)) {
-    case BANK_CLASSIC:
-      offset = SHAPE_TRAPEZOID;
-      break;
-
-    case BANK_RANDOM:
-      // RANDOM is not affected by panel switches, but by random waveform setting
-      ui_shape = ui_->random_waveform_index(i);
-      offset = SHAPE_RANDOM_STEP;
-      break;
-
-    default:
-      offset = 42;
-      break;
+#ifdef ADAPTIVE_RATE
+  // step all but the last sample of a block at the reduced rate; the
+  // followers read the accumulator of the 1st LFO one sample behind, as
+  // they do at full rate
+  bool reduced_rate = CanReduceRate();
+  if (reduced_rate) {
+    if (mode == FEAT_MODE_FREE) {
+      for (int i=0; i<kNumChannels; i++)
+	lfo_[i].Step(kReducedRateDivider - 1);
+    } else {
+      lfo_[0].Step(kReducedRateDivider - 2);
+      for (int i=1; i<kNumChannels; i++)
+	lfo_[i].Step(kReducedRateDivider - 1);
+      lfo_[0].Step(1);
     }
-
-    int s = ((ui_shape + waveform_offset_) % 4) + offset;
-    shape[i] = static_cast<LfoShape>(s);
-
-    // exception: in quad mode, trapezoid becomes square
-    if (ui_->feat_mode() == FEAT_MODE_QUAD &&
-        shape[i] == SHAPE_TRAPEZOID)
-      shape[i] = SHAPE_SQUARE;
   }
+#endif  // ADAPTIVE_RATE
 
   int32_t sample1 = 0;
   int32_t sample2 = 0;
-  int32_t gain = 0;
 
-  // send to DAC and step
+  // second sweep: step, render and send to DAC. The followers come
+  // first, so that they step with the 1st channel they are linked to.
   for (int i=kNumChannels-1; i>=0; i--) {
     lfo_[i].Step();
 
-    if (ui_->feat_mode() != FEAT_MODE_QUAD) {
-      sample1 = sample2 = gain = 0;
+    if (mode != FEAT_MODE_QUAD) {
+      sample1 = sample2 = 0;
     }
 
-    sample1 += lfo_[i].ComputeSampleShape(SHAPE_SINE);
-    sample2 += lfo_[i].ComputeSampleShape(shape[i]);
-    gain += lfo_[i].level();
+    int16_t sine, shape;
+    lfo_[i].Render(&sine, &shape);
+    sample1 += sine;
+    sample2 += shape;
 
-    if (ui_->feat_mode() == FEAT_MODE_QUAD) {
+    int16_t out_sine = sample1;
+    int16_t out_asgn = sample2;
+    if (mode == FEAT_MODE_QUAD) {
       // normalized
-      int32_t g = gain < UINT16_MAX ? UINT16_MAX : gain;
-      dac_->set_sine(i, ((sample1 << 13) / g) << 3);
-      dac_->set_asgn(i, ((sample2 << 13) / g) << 3);
-    } else {
-      dac_->set_sine(i, sample1);
-      dac_->set_asgn(i, sample2);
+      int32_t r = quad_gain_reciprocal_[i];
+      out_sine = Saturate16(sample1 * r >> kQuadGainShift);
+      out_asgn = Saturate16(sample2 * r >> kQuadGainShift);
+    }
+
+#ifdef ADAPTIVE_RATE
+    if (reduced_rate) {
+      output_block_[i] = PackSamples(output_[i], out_sine);
+      output_block_[kNumChannels + i] =
+	PackSamples(output_[kNumChannels + i], out_asgn);
     }
+    output_[i] = out_sine;
+    output_[kNumChannels + i] = out_asgn;
+    if (reduced_rate)
+      continue;
+#endif  // ADAPTIVE_RATE
+
+    dac_->set_sine(i, out_sine);
+    dac_->set_asgn(i, out_asgn);
+  }
+
+#ifdef ADAPTIVE_RATE
+  if (reduced_rate) {
+    reduced_rate_samples_ = kReducedRateDivider;
+    InterpolateOutputs();
+  }
+#endif  // ADAPTIVE_RATE
+}
+
+#ifdef ADAPTIVE_RATE
+
+inline bool Processor::CanReduceRate() {
+  if (ui_->sync_mode())
+    return false;
+  for (int i=0; i<kNumChannels; i++) {
+    if (reset_triggered_[i] || reset_pending_[i] ||
+	!lfo_[i].slow(kReducedRateMaxIncrement))
+      return false;
+  }
+  return true;
+}
+
+// sends the outputs of the next sample of the block rendered at the
+// reduced rate, interpolated between its start and its end
+inline void Processor::InterpolateOutputs() {
+  uint8_t position = kReducedRateDivider - --reduced_rate_samples_;
+  uint32_t weights = PackSamples(kReducedRateDivider - position, position);
+  for (int i=0; i<kNumChannels; i++) {
+    dac_->set_sine(i, MultiplyAddSamples(output_block_[i], weights)
+		   >> kReducedRateShift);
+    dac_->set_asgn(i, MultiplyAddSamples(output_block_[kNumChannels + i],
+					 weights) >> kReducedRateShift);
   }
 }
+
+#endif  // ADAPTIVE_RATE
+
+/* The audio paths of the modes are explicit specializations wrapping
+ * RunMode, as GCC ignores the section attribute of AUDIO_RAMFUNC on
+ * implicit template instances, and places explicit instances in COMDAT
+ * sections, which conflict with .ramfunc. */
+#define DEFINE_PROCESS_FN(m) \
+  template<> \
+  AUDIO_RAMFUNC void Processor::ProcessMode<m>() { \
+    RunMode<m>(); \
+  }
+
+DEFINE_PROCESS_FN(FEAT_MODE_FREE)
+DEFINE_PROCESS_FN(FEAT_MODE_QUAD)
+DEFINE_PROCESS_FN(FEAT_MODE_PHASE)
+DEFINE_PROCESS_FN(FEAT_MODE_DIVIDE)
+
+const Processor::ProcessFn Processor::process_fn_table_[FEAT_MODE_LAST] = {
+  &Processor::ProcessMode<FEAT_MODE_FREE>,
+  &Processor::ProcessMode<FEAT_MODE_QUAD>,
+  &Processor::ProcessMode<FEAT_MODE_PHASE>,
+  &Processor::ProcessMode<FEAT_MODE_DIVIDE>,
+};
+
 }
@@ -30,8 +30,11 @@
 #define BATUMI_MODULATIONS_PROCESSOR_H_
 
 #include "drivers/adc.h"
+#include "drivers/audio_ram.h"
 #include "drivers/dac.h"
+#include "drivers/tracer.h"
 
+#include "clock_tracker.h"
 #include "lfo.h"
 #include "ui.h"
 
@@ -39,34 +42,121 @@ namespace batumi {
 
 const uint8_t kNumChannels = 4;
 
+// number of samples between two updates of the LFO parameters
+const uint8_t kControlRateDivider = 16;
+
+// the update is spread over the first samples of the control period, one
+// stage per sample: mode changes, the parameters of each channel, the
+// gains of the quad mode mix, then the shape of each channel
+enum ControlStage {
+  CONTROL_STAGE_MODE,
+  CONTROL_STAGE_CHANNEL,
+  CONTROL_STAGE_MIX = CONTROL_STAGE_CHANNEL + kNumChannels,
+  CONTROL_STAGE_SHAPE,
+  CONTROL_STAGE_LAST = CONTROL_STAGE_SHAPE + kNumChannels
+};
+
+typedef char control_stage_check[
+    CONTROL_STAGE_LAST <= kControlRateDivider ? 1 : -1];
+
+// the time since the last edge, in 1/32 of a sample, saturates here
+// (about 34 minutes), so that the intervals between edges stay in range
+// of the clock tracker
+const uint32_t kMaxResetInterval = 1UL << 30;
+
+// fractional bits of the reciprocals of the quad mode gains
+const uint8_t kQuadGainShift = 15;
+
+#ifdef ADAPTIVE_RATE
+// while all the LFOs are below kReducedRateMaxIncrement (8 Hz), and no
+// reset or sync is going on, they are rendered every
+// kReducedRateDivider samples and the outputs are interpolated
+const uint8_t kReducedRateShift = 3;
+const uint8_t kReducedRateDivider = 1 << kReducedRateShift;
+const uint32_t kReducedRateMaxIncrement = 1UL << 21;
+// a trigger waits for the end of the block it is detected in; with
+// blocks as long as the ADC refresh period, the next reading of the reset
+// input never comes before the pending trigger is consumed
+typedef char reduced_rate_divider_check[
+    kReducedRateDivider == kAdcRefreshPeriod ? 1 : -1];
+#endif  // ADAPTIVE_RATE
+
 class Processor {
 public:
 
   Processor() { }
   ~Processor() { }
 
-  void Init(Ui *ui, Adc *adc, Dac *dac);
-  void Process();
+  void Init(Ui *ui, Adc *adc, Dac *dac, Tracer *tracer);
+  AUDIO_RAMFUNC void Process();
 
 private:
   Lfo lfo_[kNumChannels];
   Ui *ui_;
   Adc *adc_;
   Dac *dac_;
+  Tracer *tracer_;
+
+  // the audio path of each feature mode, with no test of the mode;
+  // installed by ProcessControl() when the mode changes
+  typedef void (Processor::*ProcessFn)();
+  static const ProcessFn process_fn_table_[FEAT_MODE_LAST];
 
-  FeatureMode previous_feat_mode_;
+  FeatureMode feat_mode_;
+  ProcessFn process_fn_;
+  uint8_t control_counter_;
 
   bool reset_trigger_armed_[kNumChannels];
   bool reset_triggered_[kNumChannels];
-  uint8_t reset_subsample_[kNumChannels];
+  // a trigger that came during a flash write, held until it is delivered
+  bool reset_pending_[kNumChannels];
+  // time elapsed since the edge that triggered the reset, and since the
+  // previous one, in 1/32 of a sample
+  uint16_t reset_delay_[kNumChannels];
   uint32_t last_reset_[kNumChannels];
   int16_t previous_reset_[kNumChannels];
+  uint8_t reset_sequence_[kNumChannels];
+  uint8_t cv_sequence_[kNumChannels];
   uint16_t last_coarse_[kNumChannels];
   bool synced_[kNumChannels];
+  ClockTracker clock_tracker_[kNumChannels];
   int16_t filtered_cv_[kNumChannels];
+  // in quad mode, reciprocal of the sum of the levels mixed on each
+  // output, updated with the levels
+  int32_t quad_gain_reciprocal_[kNumChannels];
   uint8_t waveform_offset_;
+  // in phase mode, the pots of the followers are all maxed out: their
+  // phases are in quadrature
+  bool quadrature_;
   uint16_t sync_counter_;
+#ifdef ADAPTIVE_RATE
+  // samples left in the block rendered at the reduced rate, the last
+  // values sent to the DAC, and for each output its values at the start
+  // (low half) and at the end (high half) of the block
+  uint8_t reduced_rate_samples_;
+  int16_t output_[2 * kNumChannels];
+  uint32_t output_block_[2 * kNumChannels];
+#endif  // ADAPTIVE_RATE
   
+  void ProcessControl(uint8_t stage);
+  void UpdateMode();
+  void UpdateChannel(uint8_t i);
+  void UpdateQuadGains();
+  void UpdateShape(uint8_t i);
+  template<FeatureMode mode>
+  AUDIO_RAMFUNC void ProcessMode();
+  template<FeatureMode mode>
+  AUDIO_INLINE void RunMode();
+  AUDIO_INLINE void DetectTrigger(uint8_t lfo_no);
+  AUDIO_INLINE void AgeReset(uint8_t lfo_no) {
+    if (last_reset_[lfo_no] < kMaxResetInterval)
+      last_reset_[lfo_no] += 32;
+  }
+  AUDIO_RAMFUNC bool ProcessTrigger(int8_t lfo_no);
+#ifdef ADAPTIVE_RATE
+  AUDIO_INLINE bool CanReduceRate();
+  AUDIO_INLINE void InterpolateOutputs();
+#endif  // ADAPTIVE_RATE
   void SetFrequency(int8_t lfo_no);
 
   DISALLOW_COPY_AND_ASSIGN(Processor);
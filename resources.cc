@@ -41,6 +41,73 @@ const char* string_table[] = {
   str_dummy,
 };
 
+const uint16_t lut_pitch_fractions[] = {
+       0,    237,    473,    710,
+     946,   1183,   1420,   1656,
+    1893,   2130,   2366,   2603,
+    2840,   3076,   3313,   3550,
+    3786,   4023,   4260,   4496,
+    4733,   4970,   5207,   5443,
+    5680,   5917,   6154,   6390,
+    6627,   6864,   7101,   7338,
+    7574,   7811,   8048,   8285,
+    8522,   8759,   8995,   9232,
+    9469,   9706,   9943,  10180,
+   10417,  10653,  10890,  11127,
+   11364,  11601,  11838,  12075,
+   12312,  12549,  12786,  13023,
+   13260,  13497,  13734,  13971,
+   14208,  14445,  14682,  14919,
+   15156,  15393,  15630,  15867,
+   16104,  16341,  16578,  16815,
+   17052,  17289,  17526,  17763,
+   18000,  18238,  18475,  18712,
+   18949,  19186,  19423,  19660,
+   19897,  20135,  20372,  20609,
+   20846,  21083,  21321,  21558,
+   21795,  22032,  22269,  22507,
+   22744,  22981,  23218,  23456,
+   23693,  23930,  24167,  24405,
+   24642,  24879,  25117,  25354,
+   25591,  25828,  26066,  26303,
+   26540,  26778,  27015,  27253,
+   27490,  27727,  27965,  28202,
+   28439,  28677,  28914,  29152,
+   29389,  29626,  29864,  30101,
+   30339,  30576,  30814,  31051,
+   31289,  31526,  31764,  32001,
+   32239,  32476,  32714,  32951,
+   33189,  33426,  33664,  33901,
+   34139,  34376,  34614,  34852,
+   35089,  35327,  35564,  35802,
+   36040,  36277,  36515,  36752,
+   36990,  37228,  37465,  37703,
+   37941,  38178,  38416,  38654,
+   38891,  39129,  39367,  39604,
+   39842,  40080,  40318,  40555,
+   40793,  41031,  41269,  41506,
+   41744,  41982,  42220,  42457,
+   42695,  42933,  43171,  43409,
+   43646,  43884,  44122,  44360,
+   44598,  44836,  45074,  45311,
+   45549,  45787,  46025,  46263,
+   46501,  46739,  46977,  47215,
+   47453,  47690,  47928,  48166,
+   48404,  48642,  48880,  49118,
+   49356,  49594,  49832,  50070,
+   50308,  50546,  50784,  51022,
+   51260,  51498,  51736,  51974,
+   52213,  52451,  52689,  52927,
+   53165,  53403,  53641,  53879,
+   54117,  54355,  54594,  54832,
+   55070,  55308,  55546,  55784,
+   56022,  56261,  56499,  56737,
+   56975,  57213,  57452,  57690,
+   57928,  58166,  58405,  58643,
+   58881,  59119,  59358,  59596,
+   59834,  60072,  60311,  60549,
+};
+
 const uint16_t lut_scale_pitch[] = {
    17906,  18043,  18180,  18317,
    18454,  18592,  18729,  18866,
@@ -245,6 +312,15 @@ const uint16_t lut_scale_divide[] = {
        2,
 };
 
+
+
+const uint16_t* lookup_table_table[] = {
+  lut_pitch_fractions,
+  lut_scale_pitch,
+  lut_scale_phase,
+  lut_scale_divide,
+};
+
 const int16_t lut_scale_divide_multiply[] = {
       32,     32,     32,     32,
       32,     32,     32,     32,
@@ -254,11 +330,11 @@ const int16_t lut_scale_divide_multiply[] = {
       16,     16,     16,     16,
       16,     16,     16,     16,
       16,     16,     16,     16,
-      8,     8,     8,     8,
-      8,     8,     8,     8,
-      8,     8,     8,     8,
-      8,     8,     8,     8,
-      8,     8,     8,     8,
+       8,      8,      8,      8,
+       8,      8,      8,      8,
+       8,      8,      8,      8,
+       8,      8,      8,      8,
+       8,      8,      8,      8,
        4,      4,      4,      4,
        4,      4,      4,      4,
        4,      4,      4,      4,
@@ -282,76 +358,74 @@ const int16_t lut_scale_divide_multiply[] = {
        1,      1,      1,      1,
        1,      1,      1,      1,
        1,      1,      1,      1,
-       -2,      -2,      -2,      -2,
-       -2,      -2,      -2,      -2,
-       -2,      -2,      -2,      -2,
-       -2,      -2,      -2,      -2,
-       -2,      -2,      -2,      -2,
-       -3,      -3,      -3,      -3,
-       -3,      -3,      -3,      -3,
-       -3,      -3,      -3,      -3,
-       -3,      -3,      -3,      -3,
-       -3,      -3,      -3,      -3,
-       -4,      -4,      -4,      -4,
-       -4,      -4,      -4,      -4,
-       -4,      -4,      -4,      -4,
-       -4,      -4,      -4,      -4,
-       -4,      -4,      -4,      -4,
-       -8,      -8,      -8,      -8,
-       -8,      -8,      -8,      -8,
-       -8,      -8,      -8,      -8,
-       -8,      -8,      -8,      -8,
-       -8,      -8,      -8,      -8,
-       -16,      -16,      -16,      -16,
-       -16,      -16,      -16,      -16,
-       -16,      -16,      -16,      -16,
-       -16,      -16,      -16,      -16,
-       -16,      -16,      -32,      -32,
-       -32,      -32,      -32,      -32,
-       -32,      -32,      -32,      -32,
-       -32,      -32,      -32,      -32,
-       -32,
+      -2,     -2,     -2,     -2,
+      -2,     -2,     -2,     -2,
+      -2,     -2,     -2,     -2,
+      -2,     -2,     -2,     -2,
+      -2,     -2,     -2,     -2,
+      -3,     -3,     -3,     -3,
+      -3,     -3,     -3,     -3,
+      -3,     -3,     -3,     -3,
+      -3,     -3,     -3,     -3,
+      -3,     -3,     -3,     -3,
+      -4,     -4,     -4,     -4,
+      -4,     -4,     -4,     -4,
+      -4,     -4,     -4,     -4,
+      -4,     -4,     -4,     -4,
+      -4,     -4,     -4,     -4,
+      -8,     -8,     -8,     -8,
+      -8,     -8,     -8,     -8,
+      -8,     -8,     -8,     -8,
+      -8,     -8,     -8,     -8,
+      -8,     -8,     -8,     -8,
+     -16,    -16,    -16,    -16,
+     -16,    -16,    -16,    -16,
+     -16,    -16,    -16,    -16,
+     -16,    -16,    -16,    -16,
+     -16,    -16,    -32,    -32,
+     -32,    -32,    -32,    -32,
+     -32,    -32,    -32,    -32,
+     -32,    -32,    -32,    -32,
+     -32,
 };
 
 
-const uint16_t* lookup_table_table[] = {
-  lut_scale_pitch,
-  lut_scale_phase,
-  lut_scale_divide,
+
+const int16_t* lookup_table_signed_table[] = {
+  lut_scale_divide_multiply,
 };
 
-const uint32_t lut_increments[] = {
-  2143236, 2158767, 2174410, 2190167,
-  2206038, 2222024, 2238125, 2254344,
-  2270680, 2287134, 2303707, 2320401,
-  2337216, 2354152, 2371211, 2388394,
-  2405701, 2423134, 2440693, 2458379,
-  2476194, 2494137, 2512211, 2530415,
-  2548752, 2567221, 2585824, 2604562,
-  2623436, 2642446, 2661595, 2680882,
-  2700308, 2719876, 2739585, 2759438,
-  2779434, 2799574, 2819861, 2840295,
-  2860877, 2881608, 2902490, 2923522,
-  2944707, 2966046, 2987539, 3009188,
+const uint32_t lut_pitch_increments[] = {
+  2143237, 2158767, 2174411, 2190167,
+  2206038, 2222024, 2238126, 2254344,
+  2270680, 2287134, 2303708, 2320402,
+  2337216, 2354153, 2371212, 2388394,
+  2405702, 2423134, 2440694, 2458380,
+  2476194, 2494138, 2512211, 2530416,
+  2548752, 2567222, 2585825, 2604563,
+  2623436, 2642447, 2661595, 2680882,
+  2700309, 2719876, 2739586, 2759438,
+  2779434, 2799575, 2819862, 2840296,
+  2860878, 2881609, 2902490, 2923523,
+  2944708, 2966046, 2987540, 3009188,
   3030994, 3052958, 3075081, 3097364,
-  3119809, 3142416, 3165187, 3188124,
-  3211226, 3234496, 3257934, 3281543,
-  3305322, 3329274, 3353399, 3377699,
-  3402176, 3426829, 3451661, 3476674,
+  3119809, 3142417, 3165188, 3188124,
+  3211227, 3234496, 3257935, 3281543,
+  3305323, 3329274, 3353400, 3377700,
+  3402176, 3426830, 3451662, 3476674,
   3501867, 3527243, 3552803, 3578548,
-  3604480, 3630599, 3656908, 3683407,
-  3710099, 3736984, 3764063, 3791339,
-  3818813, 3846486, 3874359, 3902434,
-  3930713, 3959196, 3987886, 4016784,
-  4045892, 4075210, 4104740, 4134485,
-  4164445, 4194622, 4225018, 4255635,
-  4286473,
+  3604480, 3630600, 3656908, 3683408,
+  3710099, 3736984, 3764064, 3791340,
+  3818814, 3846486, 3874359, 3902435,
+  3930713, 3959197, 3987887, 4016785,
+  4045892, 4075210, 4104741, 4134486,
+  4164446, 4194623, 4225019, 4255635,
 };
 
 
 
 const uint32_t* lookup_table_32_table[] = {
-  lut_increments,
+  lut_pitch_increments,
 };
 
 const int16_t wav_sine[] = {
@@ -419,1963 +493,707 @@ const int16_t wav_sine[] = {
    32678,  32692,  32705,  32717,
    32727,  32736,  32744,  32751,
    32757,  32761,  32764,  32766,
-   32767,  32766,  32764,  32761,
-   32757,  32751,  32744,  32736,
-   32727,  32717,  32705,  32692,
-   32678,  32662,  32646,  32628,
-   32609,  32588,  32567,  32544,
-   32520,  32495,  32468,  32441,
-   32412,  32382,  32350,  32318,
-   32284,  32249,  32213,  32176,
-   32137,  32097,  32056,  32014,
-   31970,  31926,  31880,  31833,
-   31785,  31735,  31684,  31633,
-   31580,  31525,  31470,  31413,
-   31356,  31297,  31236,  31175,
-   31113,  31049,  30984,  30918,
-   30851,  30783,  30713,  30643,
-   30571,  30498,  30424,  30349,
-   30272,  30195,  30116,  30036,
-   29955,  29873,  29790,  29706,
-   29621,  29534,  29446,  29358,
-   29268,  29177,  29085,  28992,
-   28897,  28802,  28706,  28608,
-   28510,  28410,  28309,  28208,
-   28105,  28001,  27896,  27790,
-   27683,  27575,  27466,  27355,
-   27244,  27132,  27019,  26905,
-   26789,  26673,  26556,  26437,
-   26318,  26198,  26077,  25954,
-   25831,  25707,  25582,  25456,
-   25329,  25201,  25072,  24942,
-   24811,  24679,  24546,  24413,
-   24278,  24143,  24006,  23869,
-   23731,  23592,  23452,  23311,
-   23169,  23027,  22883,  22739,
-   22594,  22448,  22301,  22153,
-   22004,  21855,  21705,  21554,
-   21402,  21249,  21096,  20942,
-   20787,  20631,  20474,  20317,
-   20159,  20000,  19840,  19680,
-   19519,  19357,  19194,  19031,
-   18867,  18702,  18537,  18371,
-   18204,  18036,  17868,  17699,
-   17530,  17360,  17189,  17017,
-   16845,  16672,  16499,  16325,
-   16150,  15975,  15799,  15623,
-   15446,  15268,  15090,  14911,
-   14732,  14552,  14372,  14191,
-   14009,  13827,  13645,  13462,
-   13278,  13094,  12909,  12724,
-   12539,  12353,  12166,  11980,
-   11792,  11604,  11416,  11227,
-   11038,  10849,  10659,  10469,
-   10278,  10087,   9895,   9703,
-    9511,   9319,   9126,   8932,
-    8739,   8545,   8351,   8156,
-    7961,   7766,   7571,   7375,
-    7179,   6982,   6786,   6589,
-    6392,   6195,   5997,   5799,
-    5601,   5403,   5205,   5006,
-    4807,   4608,   4409,   4210,
-    4011,   3811,   3611,   3411,
-    3211,   3011,   2811,   2610,
-    2410,   2209,   2009,   1808,
-    1607,   1406,   1206,   1005,
-     804,    603,    402,    201,
-       0,   -201,   -402,   -603,
-    -804,  -1005,  -1206,  -1406,
-   -1607,  -1808,  -2009,  -2209,
-   -2410,  -2610,  -2811,  -3011,
-   -3211,  -3411,  -3611,  -3811,
-   -4011,  -4210,  -4409,  -4608,
-   -4807,  -5006,  -5205,  -5403,
-   -5601,  -5799,  -5997,  -6195,
-   -6392,  -6589,  -6786,  -6982,
-   -7179,  -7375,  -7571,  -7766,
-   -7961,  -8156,  -8351,  -8545,
-   -8739,  -8932,  -9126,  -9319,
-   -9511,  -9703,  -9895, -10087,
-  -10278, -10469, -10659, -10849,
-  -11038, -11227, -11416, -11604,
-  -11792, -11980, -12166, -12353,
-  -12539, -12724, -12909, -13094,
-  -13278, -13462, -13645, -13827,
-  -14009, -14191, -14372, -14552,
-  -14732, -14911, -15090, -15268,
-  -15446, -15623, -15799, -15975,
-  -16150, -16325, -16499, -16672,
-  -16845, -17017, -17189, -17360,
-  -17530, -17699, -17868, -18036,
-  -18204, -18371, -18537, -18702,
-  -18867, -19031, -19194, -19357,
-  -19519, -19680, -19840, -20000,
-  -20159, -20317, -20474, -20631,
-  -20787, -20942, -21096, -21249,
-  -21402, -21554, -21705, -21855,
-  -22004, -22153, -22301, -22448,
-  -22594, -22739, -22883, -23027,
-  -23169, -23311, -23452, -23592,
-  -23731, -23869, -24006, -24143,
-  -24278, -24413, -24546, -24679,
-  -24811, -24942, -25072, -25201,
-  -25329, -25456, -25582, -25707,
-  -25831, -25954, -26077, -26198,
-  -26318, -26437, -26556, -26673,
-  -26789, -26905, -27019, -27132,
-  -27244, -27355, -27466, -27575,
-  -27683, -27790, -27896, -28001,
-  -28105, -28208, -28309, -28410,
-  -28510, -28608, -28706, -28802,
-  -28897, -28992, -29085, -29177,
-  -29268, -29358, -29446, -29534,
-  -29621, -29706, -29790, -29873,
-  -29955, -30036, -30116, -30195,
-  -30272, -30349, -30424, -30498,
-  -30571, -30643, -30713, -30783,
-  -30851, -30918, -30984, -31049,
-  -31113, -31175, -31236, -31297,
-  -31356, -31413, -31470, -31525,
-  -31580, -31633, -31684, -31735,
-  -31785, -31833, -31880, -31926,
-  -31970, -32014, -32056, -32097,
-  -32137, -32176, -32213, -32249,
-  -32284, -32318, -32350, -32382,
-  -32412, -32441, -32468, -32495,
-  -32520, -32544, -32567, -32588,
-  -32609, -32628, -32646, -32662,
-  -32678, -32692, -32705, -32717,
-  -32727, -32736, -32744, -32751,
-  -32757, -32761, -32764, -32766,
-  -32767, -32766, -32764, -32761,
-  -32757, -32751, -32744, -32736,
-  -32727, -32717, -32705, -32692,
-  -32678, -32662, -32646, -32628,
-  -32609, -32588, -32567, -32544,
-  -32520, -32495, -32468, -32441,
-  -32412, -32382, -32350, -32318,
-  -32284, -32249, -32213, -32176,
-  -32137, -32097, -32056, -32014,
-  -31970, -31926, -31880, -31833,
-  -31785, -31735, -31684, -31633,
-  -31580, -31525, -31470, -31413,
-  -31356, -31297, -31236, -31175,
-  -31113, -31049, -30984, -30918,
-  -30851, -30783, -30713, -30643,
-  -30571, -30498, -30424, -30349,
-  -30272, -30195, -30116, -30036,
-  -29955, -29873, -29790, -29706,
-  -29621, -29534, -29446, -29358,
-  -29268, -29177, -29085, -28992,
-  -28897, -28802, -28706, -28608,
-  -28510, -28410, -28309, -28208,
-  -28105, -28001, -27896, -27790,
-  -27683, -27575, -27466, -27355,
-  -27244, -27132, -27019, -26905,
-  -26789, -26673, -26556, -26437,
-  -26318, -26198, -26077, -25954,
-  -25831, -25707, -25582, -25456,
-  -25329, -25201, -25072, -24942,
-  -24811, -24679, -24546, -24413,
-  -24278, -24143, -24006, -23869,
-  -23731, -23592, -23452, -23311,
-  -23169, -23027, -22883, -22739,
-  -22594, -22448, -22301, -22153,
-  -22004, -21855, -21705, -21554,
-  -21402, -21249, -21096, -20942,
-  -20787, -20631, -20474, -20317,
-  -20159, -20000, -19840, -19680,
-  -19519, -19357, -19194, -19031,
-  -18867, -18702, -18537, -18371,
-  -18204, -18036, -17868, -17699,
-  -17530, -17360, -17189, -17017,
-  -16845, -16672, -16499, -16325,
-  -16150, -15975, -15799, -15623,
-  -15446, -15268, -15090, -14911,
-  -14732, -14552, -14372, -14191,
-  -14009, -13827, -13645, -13462,
-  -13278, -13094, -12909, -12724,
-  -12539, -12353, -12166, -11980,
-  -11792, -11604, -11416, -11227,
-  -11038, -10849, -10659, -10469,
-  -10278, -10087,  -9895,  -9703,
-   -9511,  -9319,  -9126,  -8932,
-   -8739,  -8545,  -8351,  -8156,
-   -7961,  -7766,  -7571,  -7375,
-   -7179,  -6982,  -6786,  -6589,
-   -6392,  -6195,  -5997,  -5799,
-   -5601,  -5403,  -5205,  -5006,
-   -4807,  -4608,  -4409,  -4210,
-   -4011,  -3811,  -3611,  -3411,
-   -3211,  -3011,  -2811,  -2610,
-   -2410,  -2209,  -2009,  -1808,
-   -1607,  -1406,  -1206,  -1005,
-    -804,   -603,   -402,   -201,
-       0,
-};
-
-const int16_t wav_saw10[] = {
-     177,  -2727,  -5583,  -8359,
-  -11031, -13559, -15943, -18151,
-  -20191, -22063, -23751, -25263,
-  -26607, -27791, -28815, -29695,
-  -30447, -31063, -31575, -31975,
-  -32279, -32503, -32655, -32735,
-  -32767, -32751, -32687, -32591,
-  -32471, -32327, -32167, -31991,
-  -31807, -31615, -31431, -31239,
-  -31047, -30863, -30679, -30503,
-  -30335, -30175, -30023, -29879,
-  -29735, -29607, -29487, -29367,
-  -29255, -29151, -29055, -28967,
-  -28879, -28791, -28719, -28639,
-  -28567, -28503, -28431, -28367,
-  -28303, -28247, -28183, -28127,
-  -28063, -28007, -27951, -27895,
-  -27839, -27775, -27719, -27663,
-  -27607, -27551, -27487, -27431,
-  -27375, -27311, -27255, -27191,
-  -27135, -27071, -27015, -26951,
-  -26887, -26831, -26767, -26703,
-  -26639, -26583, -26519, -26455,
-  -26391, -26327, -26263, -26207,
-  -26143, -26079, -26015, -25951,
-  -25887, -25823, -25759, -25703,
-  -25639, -25575, -25511, -25447,
-  -25383, -25319, -25255, -25199,
-  -25135, -25071, -25007, -24943,
-  -24879, -24815, -24751, -24695,
-  -24631, -24567, -24503, -24439,
-  -24375, -24319, -24255, -24191,
-  -24127, -24063, -23999, -23935,
-  -23879, -23815, -23751, -23687,
-  -23623, -23559, -23495, -23439,
-  -23375, -23311, -23247, -23183,
-  -23119, -23055, -22999, -22935,
-  -22871, -22807, -22743, -22679,
-  -22623, -22559, -22495, -22431,
-  -22367, -22303, -22239, -22183,
-  -22119, -22055, -21991, -21927,
-  -21863, -21799, -21743, -21679,
-  -21615, -21551, -21487, -21423,
-  -21367, -21303, -21239, -21175,
-  -21111, -21047, -20983, -20927,
-  -20863, -20799, -20735, -20671,
-  -20607, -20543, -20487, -20423,
-  -20359, -20295, -20231, -20167,
-  -20103, -20047, -19983, -19919,
-  -19855, -19791, -19727, -19671,
-  -19607, -19543, -19479, -19415,
-  -19351, -19287, -19231, -19167,
-  -19103, -19039, -18975, -18911,
-  -18847, -18791, -18727, -18663,
-  -18599, -18535, -18471, -18407,
-  -18351, -18287, -18223, -18159,
-  -18095, -18031, -17975, -17911,
-  -17847, -17783, -17719, -17655,
-  -17591, -17535, -17471, -17407,
-  -17343, -17279, -17215, -17151,
-  -17095, -17031, -16967, -16903,
-  -16839, -16775, -16711, -16655,
-  -16591, -16527, -16463, -16399,
-  -16335, -16279, -16215, -16151,
-  -16087, -16023, -15959, -15895,
-  -15839, -15775, -15711, -15647,
-  -15583, -15519, -15455, -15399,
-  -15335, -15271, -15207, -15143,
-  -15079, -15023, -14959, -14895,
-  -14831, -14767, -14703, -14639,
-  -14583, -14519, -14455, -14391,
-  -14327, -14263, -14199, -14143,
-  -14079, -14015, -13951, -13887,
-  -13823, -13759, -13703, -13639,
-  -13575, -13511, -13447, -13383,
-  -13327, -13263, -13199, -13135,
-  -13071, -13007, -12943, -12887,
-  -12823, -12759, -12695, -12631,
-  -12567, -12503, -12447, -12383,
-  -12319, -12255, -12191, -12127,
-  -12063, -12007, -11943, -11879,
-  -11815, -11751, -11687, -11631,
-  -11567, -11503, -11439, -11375,
-  -11311, -11247, -11191, -11127,
-  -11063, -10999, -10935, -10871,
-  -10807, -10751, -10687, -10623,
-  -10559, -10495, -10431, -10367,
-  -10311, -10247, -10183, -10119,
-  -10055,  -9991,  -9935,  -9871,
-   -9807,  -9743,  -9679,  -9615,
-   -9551,  -9495,  -9431,  -9367,
-   -9303,  -9239,  -9175,  -9111,
-   -9055,  -8991,  -8927,  -8863,
-   -8799,  -8735,  -8679,  -8615,
-   -8551,  -8487,  -8423,  -8359,
-   -8295,  -8239,  -8175,  -8111,
-   -8047,  -7983,  -7919,  -7855,
-   -7799,  -7735,  -7671,  -7607,
-   -7543,  -7479,  -7415,  -7359,
-   -7295,  -7231,  -7167,  -7103,
-   -7039,  -6983,  -6919,  -6855,
-   -6791,  -6727,  -6663,  -6599,
-   -6543,  -6479,  -6415,  -6351,
-   -6287,  -6223,  -6159,  -6103,
-   -6039,  -5975,  -5911,  -5847,
-   -5783,  -5719,  -5663,  -5599,
-   -5535,  -5471,  -5407,  -5343,
-   -5287,  -5223,  -5159,  -5095,
-   -5031,  -4967,  -4903,  -4847,
-   -4783,  -4719,  -4655,  -4591,
-   -4527,  -4463,  -4407,  -4343,
-   -4279,  -4215,  -4151,  -4087,
-   -4023,  -3967,  -3903,  -3839,
-   -3775,  -3711,  -3647,  -3591,
-   -3527,  -3463,  -3399,  -3335,
-   -3271,  -3207,  -3151,  -3087,
-   -3023,  -2959,  -2895,  -2831,
-   -2767,  -2711,  -2647,  -2583,
-   -2519,  -2455,  -2391,  -2327,
-   -2271,  -2207,  -2143,  -2079,
-   -2015,  -1951,  -1895,  -1831,
-   -1767,  -1703,  -1639,  -1575,
-   -1511,  -1455,  -1391,  -1327,
-   -1263,  -1199,  -1135,  -1071,
-   -1015,   -951,   -887,   -823,
-    -759,   -695,   -639,   -575,
-    -511,   -447,   -383,   -319,
-    -255,   -199,   -135,    -71,
-      -7,     57,    121,    185,
-     241,    305,    369,    433,
-     497,    561,    625,    681,
-     745,    809,    873,    937,
-    1001,   1057,   1121,   1185,
-    1249,   1313,   1377,   1441,
-    1497,   1561,   1625,   1689,
-    1753,   1817,   1881,   1937,
-    2001,   2065,   2129,   2193,
-    2257,   2321,   2377,   2441,
-    2505,   2569,   2633,   2697,
-    2753,   2817,   2881,   2945,
-    3009,   3073,   3137,   3193,
-    3257,   3321,   3385,   3449,
-    3513,   3577,   3633,   3697,
-    3761,   3825,   3889,   3953,
-    4017,   4073,   4137,   4201,
-    4265,   4329,   4393,   4449,
-    4513,   4577,   4641,   4705,
-    4769,   4833,   4889,   4953,
-    5017,   5081,   5145,   5209,
-    5273,   5329,   5393,   5457,
-    5521,   5585,   5649,   5705,
-    5769,   5833,   5897,   5961,
-    6025,   6089,   6145,   6209,
-    6273,   6337,   6401,   6465,
-    6529,   6585,   6649,   6713,
-    6777,   6841,   6905,   6969,
-    7025,   7089,   7153,   7217,
-    7281,   7345,   7401,   7465,
-    7529,   7593,   7657,   7721,
-    7785,   7841,   7905,   7969,
-    8033,   8097,   8161,   8225,
-    8281,   8345,   8409,   8473,
-    8537,   8601,   8665,   8721,
-    8785,   8849,   8913,   8977,
-    9041,   9097,   9161,   9225,
-    9289,   9353,   9417,   9481,
-    9537,   9601,   9665,   9729,
-    9793,   9857,   9921,   9977,
-   10041,  10105,  10169,  10233,
-   10297,  10361,  10417,  10481,
-   10545,  10609,  10673,  10737,
-   10793,  10857,  10921,  10985,
-   11049,  11113,  11177,  11233,
-   11297,  11361,  11425,  11489,
-   11553,  11617,  11673,  11737,
-   11801,  11865,  11929,  11993,
-   12057,  12113,  12177,  12241,
-   12305,  12369,  12433,  12489,
-   12553,  12617,  12681,  12745,
-   12809,  12873,  12929,  12993,
-   13057,  13121,  13185,  13249,
-   13313,  13369,  13433,  13497,
-   13561,  13625,  13689,  13745,
-   13809,  13873,  13937,  14001,
-   14065,  14129,  14185,  14249,
-   14313,  14377,  14441,  14505,
-   14569,  14625,  14689,  14753,
-   14817,  14881,  14945,  15009,
-   15065,  15129,  15193,  15257,
-   15321,  15385,  15441,  15505,
-   15569,  15633,  15697,  15761,
-   15825,  15881,  15945,  16009,
-   16073,  16137,  16201,  16265,
-   16321,  16385,  16449,  16513,
-   16577,  16641,  16705,  16761,
-   16825,  16889,  16953,  17017,
-   17081,  17137,  17201,  17265,
-   17329,  17393,  17457,  17521,
-   17577,  17641,  17705,  17769,
-   17833,  17897,  17961,  18017,
-   18081,  18145,  18209,  18273,
-   18337,  18401,  18457,  18521,
-   18585,  18649,  18713,  18777,
-   18833,  18897,  18961,  19025,
-   19089,  19153,  19217,  19273,
-   19337,  19401,  19465,  19529,
-   19593,  19657,  19713,  19777,
-   19841,  19905,  19969,  20033,
-   20089,  20153,  20217,  20281,
-   20345,  20409,  20473,  20529,
-   20593,  20657,  20721,  20785,
-   20849,  20913,  20969,  21033,
-   21097,  21161,  21225,  21289,
-   21353,  21409,  21473,  21537,
-   21601,  21665,  21729,  21785,
-   21849,  21913,  21977,  22041,
-   22105,  22169,  22225,  22289,
-   22353,  22417,  22481,  22545,
-   22609,  22665,  22729,  22793,
-   22857,  22921,  22985,  23049,
-   23105,  23169,  23233,  23297,
-   23361,  23425,  23481,  23545,
-   23609,  23673,  23737,  23801,
-   23865,  23921,  23985,  24049,
-   24113,  24177,  24241,  24305,
-   24361,  24425,  24489,  24553,
-   24617,  24681,  24745,  24801,
-   24865,  24929,  24993,  25057,
-   25121,  25185,  25241,  25305,
-   25369,  25433,  25497,  25561,
-   25625,  25689,  25745,  25809,
-   25873,  25937,  26001,  26065,
-   26129,  26193,  26249,  26313,
-   26377,  26441,  26505,  26569,
-   26625,  26689,  26753,  26817,
-   26873,  26937,  27001,  27057,
-   27121,  27177,  27241,  27297,
-   27361,  27417,  27473,  27537,
-   27593,  27649,  27705,  27761,
-   27825,  27881,  27937,  27993,
-   28049,  28113,  28169,  28233,
-   28289,  28353,  28417,  28481,
-   28553,  28625,  28697,  28777,
-   28857,  28945,  29041,  29137,
-   29241,  29345,  29465,  29585,
-   29713,  29857,  30001,  30153,
-   30313,  30481,  30649,  30833,
-   31017,  31209,  31401,  31585,
-   31777,  31961,  32137,  32297,
-   32449,  32569,  32673,  32737,
-   32761,  32737,  32665,  32521,
-   32305,  32009,  31617,  31129,
-   30521,  29793,  28929,  27921,
-   26753,  25433,  23937,  22273,
-   20433,  18409,  16217,  13857,
-   11345,   8697,   5929,   3081,
-     177,
-};
-
-const int16_t wav_saw100[] = {
-      97,  -1527,  -3143,  -4751,
-   -6343,  -7919,  -9471, -10991,
-  -12487, -13943, -15359, -16735,
-  -18063, -19335, -20559, -21735,
-  -22847, -23903, -24903, -25839,
-  -26711, -27519, -28271, -28959,
-  -29583, -30151, -30655, -31103,
-  -31495, -31823, -32103, -32327,
-  -32511, -32639, -32719, -32759,
-  -32759, -32727, -32655, -32551,
-  -32415, -32263, -32079, -31871,
-  -31647, -31407, -31151, -30887,
-  -30615, -30335, -30047, -29759,
-  -29471, -29183, -28895, -28615,
-  -28335, -28071, -27807, -27551,
-  -27303, -27071, -26847, -26639,
-  -26439, -26247, -26071, -25903,
-  -25751, -25615, -25487, -25367,
-  -25263, -25167, -25079, -25007,
-  -24943, -24887, -24839, -24799,
-  -24767, -24735, -24719, -24703,
-  -24687, -24679, -24679, -24679,
-  -24679, -24679, -24687, -24687,
-  -24695, -24703, -24703, -24703,
-  -24703, -24703, -24703, -24695,
-  -24687, -24679, -24663, -24647,
-  -24623, -24599, -24575, -24543,
-  -24511, -24471, -24431, -24383,
-  -24343, -24287, -24239, -24183,
-  -24119, -24063, -23999, -23935,
-  -23863, -23799, -23727, -23655,
-  -23583, -23503, -23431, -23351,
-  -23271, -23199, -23119, -23039,
-  -22959, -22887, -22807, -22727,
-  -22655, -22575, -22503, -22423,
-  -22351, -22279, -22199, -22127,
-  -22055, -21991, -21919, -21847,
-  -21783, -21719, -21647, -21583,
-  -21519, -21455, -21399, -21335,
-  -21271, -21215, -21151, -21095,
-  -21039, -20983, -20919, -20863,
-  -20807, -20751, -20695, -20639,
-  -20583, -20535, -20479, -20423,
-  -20367, -20311, -20255, -20199,
-  -20143, -20087, -20039, -19983,
-  -19927, -19871, -19815, -19751,
-  -19695, -19639, -19583, -19527,
-  -19471, -19407, -19351, -19295,
-  -19231, -19175, -19119, -19055,
-  -18999, -18935, -18879, -18815,
-  -18759, -18695, -18631, -18575,
-  -18511, -18455, -18391, -18327,
-  -18271, -18207, -18143, -18087,
-  -18023, -17959, -17903, -17839,
-  -17775, -17719, -17655, -17591,
-  -17535, -17471, -17407, -17351,
-  -17287, -17223, -17167, -17103,
-  -17047, -16983, -16927, -16863,
-  -16799, -16743, -16679, -16623,
-  -16559, -16503, -16439, -16383,
-  -16319, -16263, -16199, -16143,
-  -16087, -16023, -15967, -15903,
-  -15847, -15783, -15727, -15663,
-  -15607, -15543, -15487, -15423,
-  -15367, -15311, -15247, -15191,
-  -15127, -15071, -15007, -14951,
-  -14887, -14831, -14767, -14711,
-  -14647, -14591, -14527, -14471,
-  -14407, -14351, -14295, -14231,
-  -14175, -14111, -14055, -13991,
-  -13935, -13871, -13815, -13751,
-  -13687, -13631, -13567, -13511,
-  -13447, -13391, -13327, -13271,
-  -13207, -13151, -13087, -13031,
-  -12967, -12911, -12847, -12791,
-  -12727, -12671, -12607, -12551,
-  -12487, -12431, -12367, -12311,
-  -12247, -12191, -12127, -12071,
-  -12007, -11951, -11887, -11831,
-  -11767, -11711, -11647, -11591,
-  -11527, -11471, -11407, -11351,
-  -11287, -11231, -11167, -11111,
-  -11047, -10991, -10927, -10871,
-  -10807, -10751, -10687, -10631,
-  -10567, -10511, -10447, -10391,
-  -10327, -10271, -10207, -10151,
-  -10087, -10031,  -9967,  -9911,
-   -9847,  -9791,  -9727,  -9671,
-   -9607,  -9551,  -9487,  -9431,
-   -9367,  -9311,  -9247,  -9191,
-   -9127,  -9071,  -9007,  -8951,
-   -8887,  -8831,  -8767,  -8711,
-   -8647,  -8591,  -8527,  -8471,
-   -8407,  -8351,  -8287,  -8231,
-   -8167,  -8111,  -8047,  -7991,
-   -7927,  -7871,  -7807,  -7751,
-   -7687,  -7631,  -7567,  -7511,
-   -7447,  -7391,  -7327,  -7271,
-   -7207,  -7151,  -7087,  -7031,
-   -6967,  -6911,  -6847,  -6791,
-   -6727,  -6671,  -6607,  -6551,
-   -6487,  -6431,  -6367,  -6311,
-   -6247,  -6191,  -6127,  -6071,
-   -6007,  -5951,  -5887,  -5831,
-   -5767,  -5711,  -5647,  -5591,
-   -5527,  -5471,  -5407,  -5351,
-   -5287,  -5231,  -5167,  -5111,
-   -5047,  -4991,  -4927,  -4871,
-   -4807,  -4751,  -4687,  -4631,
-   -4567,  -4511,  -4447,  -4391,
-   -4327,  -4271,  -4207,  -4151,
-   -4087,  -4031,  -3967,  -3911,
-   -3847,  -3791,  -3727,  -3671,
-   -3607,  -3551,  -3487,  -3431,
-   -3367,  -3311,  -3247,  -3191,
-   -3127,  -3071,  -3007,  -2951,
-   -2887,  -2831,  -2767,  -2711,
-   -2647,  -2591,  -2527,  -2471,
-   -2407,  -2351,  -2287,  -2231,
-   -2167,  -2111,  -2047,  -1991,
-   -1927,  -1871,  -1807,  -1751,
-   -1687,  -1631,  -1567,  -1503,
-   -1447,  -1383,  -1327,  -1263,
-   -1207,  -1143,  -1087,  -1023,
-    -967,   -903,   -847,   -783,
-    -727,   -663,   -607,   -543,
-    -487,   -423,   -367,   -303,
-    -247,   -183,   -127,    -63,
-      -7,     57,    113,    177,
-     233,    297,    353,    417,
-     473,    537,    593,    657,
-     713,    777,    833,    897,
-     953,   1017,   1073,   1137,
-    1193,   1257,   1313,   1377,
-    1433,   1497,   1553,   1617,
-    1673,   1737,   1793,   1857,
-    1913,   1977,   2033,   2097,
-    2153,   2217,   2273,   2337,
-    2393,   2457,   2513,   2577,
-    2633,   2697,   2753,   2817,
-    2873,   2937,   2993,   3057,
-    3113,   3177,   3233,   3297,
-    3353,   3417,   3473,   3537,
-    3593,   3657,   3713,   3777,
-    3833,   3897,   3953,   4017,
-    4073,   4137,   4193,   4257,
-    4313,   4377,   4433,   4497,
-    4553,   4617,   4673,   4737,
-    4793,   4857,   4913,   4977,
-    5033,   5097,   5153,   5217,
-    5273,   5337,   5393,   5457,
-    5513,   5577,   5633,   5697,
-    5753,   5817,   5873,   5937,
-    5993,   6057,   6113,   6177,
-    6233,   6297,   6353,   6417,
-    6473,   6537,   6593,   6657,
-    6713,   6777,   6833,   6897,
-    6953,   7017,   7073,   7137,
-    7193,   7257,   7313,   7377,
-    7433,   7497,   7553,   7617,
-    7673,   7737,   7793,   7857,
-    7913,   7977,   8033,   8097,
-    8153,   8217,   8273,   8337,
-    8393,   8457,   8513,   8577,
-    8633,   8697,   8753,   8817,
-    8873,   8937,   8993,   9057,
-    9113,   9177,   9233,   9297,
-    9353,   9417,   9473,   9537,
-    9593,   9657,   9713,   9777,
-    9833,   9897,   9953,  10017,
-   10073,  10137,  10193,  10257,
-   10313,  10377,  10433,  10497,
-   10553,  10617,  10673,  10737,
-   10793,  10857,  10913,  10977,
-   11033,  11097,  11153,  11217,
-   11273,  11337,  11393,  11457,
-   11513,  11577,  11633,  11697,
-   11753,  11817,  11873,  11937,
-   11993,  12057,  12113,  12177,
-   12233,  12297,  12353,  12417,
-   12473,  12537,  12593,  12657,
-   12713,  12777,  12833,  12897,
-   12953,  13017,  13073,  13137,
-   13193,  13257,  13313,  13377,
-   13433,  13497,  13561,  13617,
-   13681,  13737,  13801,  13857,
-   13921,  13977,  14041,  14097,
-   14161,  14217,  14281,  14337,
-   14401,  14457,  14521,  14577,
-   14641,  14697,  14753,  14817,
-   14873,  14937,  14993,  15057,
-   15113,  15177,  15233,  15297,
-   15353,  15417,  15473,  15529,
-   15593,  15649,  15713,  15769,
-   15833,  15889,  15953,  16009,
-   16073,  16129,  16193,  16249,
-   16305,  16369,  16425,  16489,
-   16545,  16609,  16665,  16729,
-   16793,  16849,  16913,  16969,
-   17033,  17089,  17153,  17217,
-   17273,  17337,  17393,  17457,
-   17521,  17577,  17641,  17705,
-   17761,  17825,  17889,  17945,
-   18009,  18073,  18129,  18193,
-   18257,  18313,  18377,  18441,
-   18497,  18561,  18617,  18681,
-   18745,  18801,  18865,  18921,
-   18985,  19041,  19105,  19161,
-   19225,  19281,  19337,  19393,
-   19457,  19513,  19569,  19625,
-   19681,  19745,  19801,  19857,
-   19913,  19969,  20025,  20081,
-   20137,  20185,  20241,  20297,
-   20353,  20409,  20465,  20521,
-   20577,  20625,  20681,  20737,
-   20793,  20849,  20913,  20969,
-   21025,  21081,  21137,  21201,
-   21257,  21321,  21385,  21441,
-   21505,  21569,  21633,  21705,
-   21769,  21833,  21905,  21977,
-   22041,  22113,  22185,  22257,
-   22337,  22409,  22481,  22561,
-   22633,  22713,  22793,  22873,
-   22945,  23025,  23105,  23185,
-   23257,  23337,  23417,  23489,
-   23561,  23641,  23713,  23785,
-   23849,  23921,  23985,  24049,
-   24105,  24169,  24225,  24273,
-   24329,  24377,  24417,  24457,
-   24497,  24529,  24561,  24593,
-   24617,  24633,  24657,  24665,
-   24681,  24689,  24697,  24697,
-   24697,  24697,  24697,  24697,
-   24689,  24681,  24681,  24673,
-   24673,  24673,  24673,  24673,
-   24681,  24689,  24705,  24729,
-   24753,  24785,  24825,  24873,
-   24929,  24993,  25065,  25145,
-   25241,  25345,  25465,  25593,
-   25729,  25881,  26041,  26217,
-   26401,  26601,  26817,  27041,
-   27273,  27513,  27769,  28025,
-   28297,  28577,  28857,  29137,
-   29425,  29721,  30009,  30289,
-   30577,  30849,  31113,  31369,
-   31609,  31841,  32049,  32233,
-   32393,  32529,  32641,  32713,
-   32753,  32761,  32721,  32641,
-   32521,  32353,  32129,  31857,
-   31529,  31145,  30713,  30209,
-   29657,  29033,  28353,  27617,
-   26809,  25945,  25017,  24025,
-   22977,  21873,  20705,  19489,
-   18217,  16897,  15529,  14113,
-   12665,  11177,   9657,   8105,
-    6537,   4945,   3337,   1721,
-      97,
-};
-
-const int16_t wav_tri10[] = {
-  -32767, -32759, -32743, -32703,
-  -32663, -32599, -32527, -32447,
-  -32359, -32263, -32151, -32039,
-  -31919, -31799, -31671, -31535,
-  -31407, -31271, -31127, -30991,
-  -30855, -30711, -30575, -30431,
-  -30295, -30159, -30015, -29879,
-  -29743, -29607, -29471, -29335,
-  -29207, -29071, -28935, -28807,
-  -28671, -28543, -28407, -28279,
-  -28151, -28015, -27887, -27759,
-  -27623, -27495, -27367, -27239,
-  -27103, -26975, -26847, -26719,
-  -26583, -26455, -26327, -26199,
-  -26063, -25935, -25807, -25679,
-  -25543, -25415, -25287, -25159,
-  -25023, -24895, -24767, -24631,
-  -24503, -24375, -24247, -24111,
-  -23983, -23855, -23719, -23591,
-  -23463, -23327, -23199, -23071,
-  -22943, -22807, -22679, -22551,
-  -22415, -22287, -22159, -22031,
-  -21895, -21767, -21639, -21503,
-  -21375, -21247, -21111, -20983,
-  -20855, -20727, -20591, -20463,
-  -20335, -20199, -20071, -19943,
-  -19815, -19679, -19551, -19423,
-  -19287, -19159, -19031, -18903,
-  -18767, -18639, -18511, -18375,
-  -18247, -18119, -17983, -17855,
-  -17727, -17599, -17463, -17335,
-  -17207, -17071, -16943, -16815,
-  -16687, -16551, -16423, -16295,
-  -16159, -16031, -15903, -15775,
-  -15639, -15511, -15383, -15247,
-  -15119, -14991, -14855, -14727,
-  -14599, -14471, -14335, -14207,
-  -14079, -13943, -13815, -13687,
-  -13559, -13423, -13295, -13167,
-  -13031, -12903, -12775, -12647,
-  -12511, -12383, -12255, -12119,
-  -11991, -11863, -11727, -11599,
-  -11471, -11343, -11207, -11079,
-  -10951, -10815, -10687, -10559,
-  -10431, -10295, -10167, -10039,
-   -9903,  -9775,  -9647,  -9519,
-   -9383,  -9255,  -9127,  -8991,
-   -8863,  -8735,  -8599,  -8471,
-   -8343,  -8215,  -8079,  -7951,
-   -7823,  -7687,  -7559,  -7431,
-   -7303,  -7167,  -7039,  -6911,
-   -6775,  -6647,  -6519,  -6391,
-   -6255,  -6127,  -5999,  -5863,
-   -5735,  -5607,  -5471,  -5343,
-   -5215,  -5087,  -4951,  -4823,
-   -4695,  -4559,  -4431,  -4303,
-   -4175,  -4039,  -3911,  -3783,
-   -3647,  -3519,  -3391,  -3263,
-   -3127,  -2999,  -2871,  -2735,
-   -2607,  -2479,  -2343,  -2215,
-   -2087,  -1959,  -1823,  -1695,
-   -1567,  -1431,  -1303,  -1175,
-   -1047,   -911,   -783,   -655,
-    -519,   -391,   -263,   -135,
-       1,    129,    257,    393,
-     521,    649,    785,    913,
-    1041,   1169,   1305,   1433,
-    1561,   1697,   1825,   1953,
-    2081,   2217,   2345,   2473,
-    2609,   2737,   2865,   2993,
-    3129,   3257,   3385,   3521,
-    3649,   3777,   3913,   4041,
-    4169,   4297,   4433,   4561,
-    4689,   4825,   4953,   5081,
-    5209,   5345,   5473,   5601,
-    5737,   5865,   5993,   6121,
-    6257,   6385,   6513,   6649,
-    6777,   6905,   7041,   7169,
-    7297,   7425,   7561,   7689,
-    7817,   7953,   8081,   8209,
-    8337,   8473,   8601,   8729,
-    8865,   8993,   9121,   9249,
-    9385,   9513,   9641,   9777,
-    9905,  10033,  10161,  10297,
-   10425,  10553,  10689,  10817,
-   10945,  11081,  11209,  11337,
-   11465,  11601,  11729,  11857,
-   11993,  12121,  12249,  12377,
-   12513,  12641,  12769,  12905,
-   13033,  13161,  13289,  13425,
-   13553,  13681,  13817,  13945,
-   14073,  14209,  14337,  14465,
-   14593,  14729,  14857,  14985,
-   15121,  15249,  15377,  15505,
-   15641,  15769,  15897,  16033,
-   16161,  16289,  16417,  16553,
-   16681,  16809,  16945,  17073,
-   17201,  17337,  17465,  17593,
-   17721,  17857,  17985,  18113,
-   18249,  18377,  18505,  18633,
-   18769,  18897,  19025,  19161,
-   19289,  19417,  19545,  19681,
-   19809,  19937,  20073,  20201,
-   20329,  20465,  20593,  20721,
-   20849,  20985,  21113,  21241,
-   21377,  21505,  21633,  21761,
-   21897,  22025,  22153,  22289,
-   22417,  22545,  22681,  22809,
-   22937,  23065,  23201,  23329,
-   23457,  23593,  23721,  23849,
-   23977,  24113,  24241,  24369,
-   24505,  24633,  24761,  24889,
-   25025,  25153,  25281,  25417,
-   25545,  25673,  25801,  25937,
-   26065,  26193,  26321,  26457,
-   26585,  26713,  26841,  26977,
-   27105,  27233,  27361,  27497,
-   27625,  27753,  27881,  28017,
-   28145,  28273,  28409,  28537,
-   28673,  28801,  28937,  29065,
-   29201,  29337,  29473,  29609,
-   29745,  29881,  30017,  30153,
-   30289,  30433,  30569,  30713,
-   30849,  30993,  31129,  31265,
-   31401,  31537,  31665,  31793,
-   31921,  32041,  32153,  32257,
-   32353,  32449,  32529,  32593,
-   32657,  32705,  32737,  32753,
-   32761,  32753,  32737,  32697,
-   32657,  32593,  32521,  32441,
-   32353,  32257,  32145,  32033,
-   31913,  31793,  31665,  31529,
-   31401,  31265,  31121,  30985,
-   30849,  30705,  30569,  30425,
-   30289,  30153,  30009,  29873,
-   29737,  29601,  29465,  29329,
-   29201,  29065,  28929,  28801,
-   28665,  28537,  28401,  28273,
-   28145,  28009,  27881,  27753,
-   27617,  27489,  27361,  27233,
-   27097,  26969,  26841,  26713,
-   26577,  26449,  26321,  26193,
-   26057,  25929,  25801,  25673,
-   25537,  25409,  25281,  25153,
-   25017,  24889,  24761,  24625,
-   24497,  24369,  24241,  24105,
-   23977,  23849,  23713,  23585,
-   23457,  23321,  23193,  23065,
-   22937,  22801,  22673,  22545,
-   22409,  22281,  22153,  22025,
-   21889,  21761,  21633,  21497,
-   21369,  21241,  21105,  20977,
-   20849,  20721,  20585,  20457,
-   20329,  20193,  20065,  19937,
-   19809,  19673,  19545,  19417,
-   19281,  19153,  19025,  18897,
-   18761,  18633,  18505,  18369,
-   18241,  18113,  17977,  17849,
-   17721,  17593,  17457,  17329,
-   17201,  17065,  16937,  16809,
-   16681,  16545,  16417,  16289,
-   16153,  16025,  15897,  15769,
-   15633,  15505,  15377,  15241,
-   15113,  14985,  14849,  14721,
-   14593,  14465,  14329,  14201,
-   14073,  13937,  13809,  13681,
-   13553,  13417,  13289,  13161,
-   13025,  12897,  12769,  12641,
-   12505,  12377,  12249,  12113,
-   11985,  11857,  11721,  11593,
-   11465,  11337,  11201,  11073,
-   10945,  10809,  10681,  10553,
-   10425,  10289,  10161,  10033,
-    9897,   9769,   9641,   9513,
-    9377,   9249,   9121,   8985,
-    8857,   8729,   8593,   8465,
-    8337,   8209,   8073,   7945,
-    7817,   7681,   7553,   7425,
-    7297,   7161,   7033,   6905,
-    6769,   6641,   6513,   6385,
-    6249,   6121,   5993,   5857,
-    5729,   5601,   5465,   5337,
-    5209,   5081,   4945,   4817,
-    4689,   4553,   4425,   4297,
-    4169,   4033,   3905,   3777,
-    3641,   3513,   3385,   3257,
-    3121,   2993,   2865,   2729,
-    2601,   2473,   2337,   2209,
-    2081,   1953,   1817,   1689,
-    1561,   1425,   1297,   1169,
-    1041,    905,    777,    649,
-     513,    385,    257,    129,
-      -7,   -135,   -263,   -399,
-    -527,   -655,   -791,   -919,
-   -1047,  -1175,  -1311,  -1439,
-   -1567,  -1703,  -1831,  -1959,
-   -2087,  -2223,  -2351,  -2479,
-   -2615,  -2743,  -2871,  -2999,
-   -3135,  -3263,  -3391,  -3527,
-   -3655,  -3783,  -3919,  -4047,
-   -4175,  -4303,  -4439,  -4567,
-   -4695,  -4831,  -4959,  -5087,
-   -5215,  -5351,  -5479,  -5607,
-   -5743,  -5871,  -5999,  -6127,
-   -6263,  -6391,  -6519,  -6655,
-   -6783,  -6911,  -7047,  -7175,
-   -7303,  -7431,  -7567,  -7695,
-   -7823,  -7959,  -8087,  -8215,
-   -8343,  -8479,  -8607,  -8735,
-   -8871,  -8999,  -9127,  -9255,
-   -9391,  -9519,  -9647,  -9783,
-   -9911, -10039, -10167, -10303,
-  -10431, -10559, -10695, -10823,
-  -10951, -11087, -11215, -11343,
-  -11471, -11607, -11735, -11863,
-  -11999, -12127, -12255, -12383,
-  -12519, -12647, -12775, -12911,
-  -13039, -13167, -13295, -13431,
-  -13559, -13687, -13823, -13951,
-  -14079, -14215, -14343, -14471,
-  -14599, -14735, -14863, -14991,
-  -15127, -15255, -15383, -15511,
-  -15647, -15775, -15903, -16039,
-  -16167, -16295, -16423, -16559,
-  -16687, -16815, -16951, -17079,
-  -17207, -17343, -17471, -17599,
-  -17727, -17863, -17991, -18119,
-  -18255, -18383, -18511, -18639,
-  -18775, -18903, -19031, -19167,
-  -19295, -19423, -19551, -19687,
-  -19815, -19943, -20079, -20207,
-  -20335, -20471, -20599, -20727,
-  -20855, -20991, -21119, -21247,
-  -21383, -21511, -21639, -21767,
-  -21903, -22031, -22159, -22295,
-  -22423, -22551, -22687, -22815,
-  -22943, -23071, -23207, -23335,
-  -23463, -23599, -23727, -23855,
-  -23983, -24119, -24247, -24375,
-  -24511, -24639, -24767, -24895,
-  -25031, -25159, -25287, -25423,
-  -25551, -25679, -25807, -25943,
-  -26071, -26199, -26327, -26463,
-  -26591, -26719, -26847, -26983,
-  -27111, -27239, -27367, -27503,
-  -27631, -27759, -27887, -28023,
-  -28151, -28279, -28415, -28543,
-  -28679, -28807, -28943, -29071,
-  -29207, -29343, -29479, -29615,
-  -29751, -29887, -30023, -30159,
-  -30295, -30439, -30575, -30719,
-  -30855, -30999, -31135, -31271,
-  -31407, -31543, -31671, -31799,
-  -31927, -32047, -32159, -32263,
-  -32359, -32455, -32535, -32599,
-  -32663, -32711, -32743, -32759,
-  -32767,
-};
-
-const int16_t wav_tri100[] = {
-  -32767, -32767, -32759, -32751,
-  -32735, -32719, -32703, -32679,
-  -32655, -32623, -32591, -32551,
-  -32511, -32471, -32423, -32367,
-  -32319, -32255, -32199, -32135,
-  -32071, -31999, -31927, -31855,
-  -31775, -31695, -31607, -31527,
-  -31439, -31343, -31247, -31151,
-  -31055, -30951, -30855, -30743,
-  -30639, -30527, -30415, -30303,
-  -30191, -30071, -29951, -29831,
-  -29711, -29583, -29463, -29335,
-  -29207, -29079, -28951, -28815,
-  -28687, -28551, -28415, -28279,
-  -28143, -28007, -27863, -27727,
-  -27583, -27447, -27303, -27159,
-  -27015, -26871, -26727, -26583,
-  -26439, -26295, -26151, -26007,
-  -25855, -25711, -25567, -25415,
-  -25271, -25127, -24975, -24831,
-  -24679, -24535, -24383, -24239,
-  -24087, -23943, -23791, -23647,
-  -23503, -23351, -23207, -23055,
-  -22911, -22759, -22615, -22463,
-  -22319, -22175, -22023, -21879,
-  -21735, -21583, -21439, -21295,
-  -21151, -20999, -20855, -20711,
-  -20567, -20423, -20279, -20127,
-  -19983, -19839, -19695, -19551,
-  -19407, -19263, -19119, -18983,
-  -18839, -18695, -18551, -18407,
-  -18263, -18127, -17983, -17839,
-  -17695, -17559, -17415, -17271,
-  -17135, -16991, -16847, -16711,
-  -16567, -16431, -16287, -16143,
-  -16007, -15863, -15727, -15583,
-  -15447, -15311, -15167, -15031,
-  -14887, -14751, -14615, -14471,
-  -14335, -14191, -14055, -13919,
-  -13775, -13639, -13503, -13359,
-  -13223, -13087, -12951, -12807,
-  -12671, -12535, -12391, -12255,
-  -12119, -11983, -11839, -11703,
-  -11567, -11431, -11295, -11151,
-  -11015, -10879, -10743, -10599,
-  -10463, -10327, -10191, -10055,
-   -9911,  -9775,  -9639,  -9503,
-   -9367,  -9223,  -9087,  -8951,
-   -8815,  -8679,  -8535,  -8399,
-   -8263,  -8127,  -7991,  -7847,
-   -7711,  -7575,  -7439,  -7303,
-   -7159,  -7023,  -6887,  -6751,
-   -6615,  -6471,  -6335,  -6199,
-   -6063,  -5927,  -5783,  -5647,
-   -5511,  -5375,  -5239,  -5095,
-   -4959,  -4823,  -4687,  -4551,
-   -4407,  -4271,  -4135,  -3999,
-   -3855,  -3719,  -3583,  -3447,
-   -3311,  -3167,  -3031,  -2895,
-   -2759,  -2623,  -2479,  -2343,
-   -2207,  -2071,  -1927,  -1791,
-   -1655,  -1519,  -1383,  -1239,
-   -1103,   -967,   -831,   -687,
-    -551,   -415,   -279,   -135,
-       1,    137,    273,    409,
-     553,    689,    825,    961,
-    1105,   1241,   1377,   1513,
-    1649,   1793,   1929,   2065,
-    2201,   2345,   2481,   2617,
-    2753,   2897,   3033,   3169,
-    3305,   3441,   3585,   3721,
-    3857,   3993,   4129,   4273,
-    4409,   4545,   4681,   4825,
-    4961,   5097,   5233,   5369,
-    5513,   5649,   5785,   5921,
-    6057,   6201,   6337,   6473,
-    6609,   6745,   6889,   7025,
-    7161,   7297,   7433,   7577,
-    7713,   7849,   7985,   8121,
-    8265,   8401,   8537,   8673,
-    8809,   8953,   9089,   9225,
-    9361,   9497,   9641,   9777,
-    9913,  10049,  10185,  10329,
-   10465,  10601,  10737,  10873,
-   11017,  11153,  11289,  11425,
-   11569,  11705,  11841,  11977,
-   12113,  12257,  12393,  12529,
-   12673,  12809,  12945,  13081,
-   13225,  13361,  13497,  13641,
-   13777,  13913,  14057,  14193,
-   14329,  14473,  14609,  14745,
-   14889,  15025,  15169,  15305,
-   15449,  15585,  15729,  15865,
-   16009,  16145,  16289,  16425,
-   16569,  16705,  16849,  16985,
-   17129,  17273,  17409,  17553,
-   17697,  17841,  17977,  18121,
-   18265,  18409,  18545,  18689,
-   18833,  18977,  19121,  19265,
-   19409,  19553,  19697,  19841,
-   19985,  20129,  20273,  20417,
-   20561,  20713,  20857,  21001,
-   21145,  21289,  21441,  21585,
-   21729,  21881,  22025,  22169,
-   22321,  22465,  22609,  22761,
-   22905,  23057,  23201,  23353,
-   23497,  23649,  23793,  23945,
-   24089,  24241,  24385,  24529,
-   24681,  24825,  24977,  25121,
-   25273,  25417,  25561,  25713,
-   25857,  26001,  26153,  26297,
-   26441,  26585,  26729,  26873,
-   27017,  27161,  27305,  27441,
-   27585,  27721,  27865,  28001,
-   28137,  28273,  28409,  28545,
-   28681,  28817,  28945,  29073,
-   29209,  29337,  29457,  29585,
-   29705,  29833,  29953,  30073,
-   30185,  30305,  30417,  30529,
-   30633,  30745,  30849,  30953,
-   31049,  31153,  31249,  31345,
-   31433,  31521,  31609,  31689,
-   31769,  31849,  31921,  31993,
-   32065,  32129,  32193,  32257,
-   32313,  32369,  32417,  32465,
-   32505,  32545,  32585,  32617,
-   32649,  32673,  32697,  32713,
-   32729,  32745,  32753,  32761,
-   32761,  32761,  32753,  32745,
-   32729,  32713,  32697,  32673,
-   32649,  32617,  32585,  32545,
-   32505,  32465,  32417,  32361,
-   32313,  32249,  32193,  32129,
-   32065,  31993,  31921,  31849,
-   31769,  31689,  31601,  31521,
-   31433,  31337,  31241,  31145,
-   31049,  30945,  30849,  30737,
-   30633,  30521,  30409,  30297,
-   30185,  30065,  29945,  29825,
-   29705,  29577,  29457,  29329,
-   29201,  29073,  28945,  28809,
-   28681,  28545,  28409,  28273,
-   28137,  28001,  27857,  27721,
-   27577,  27441,  27297,  27153,
-   27009,  26865,  26721,  26577,
-   26433,  26289,  26145,  26001,
-   25849,  25705,  25561,  25409,
-   25265,  25121,  24969,  24825,
-   24673,  24529,  24377,  24233,
-   24081,  23937,  23785,  23641,
-   23497,  23345,  23201,  23049,
-   22905,  22753,  22609,  22457,
-   22313,  22169,  22017,  21873,
-   21729,  21577,  21433,  21289,
-   21145,  20993,  20849,  20705,
-   20561,  20417,  20273,  20121,
-   19977,  19833,  19689,  19545,
-   19401,  19257,  19113,  18977,
-   18833,  18689,  18545,  18401,
-   18257,  18121,  17977,  17833,
-   17689,  17553,  17409,  17265,
-   17129,  16985,  16841,  16705,
-   16561,  16425,  16281,  16137,
-   16001,  15857,  15721,  15577,
-   15441,  15305,  15161,  15025,
-   14881,  14745,  14609,  14465,
-   14329,  14185,  14049,  13913,
-   13769,  13633,  13497,  13353,
-   13217,  13081,  12945,  12801,
-   12665,  12529,  12385,  12249,
-   12113,  11977,  11833,  11697,
-   11561,  11425,  11289,  11145,
-   11009,  10873,  10737,  10593,
-   10457,  10321,  10185,  10049,
-    9905,   9769,   9633,   9497,
-    9361,   9217,   9081,   8945,
-    8809,   8673,   8529,   8393,
-    8257,   8121,   7985,   7841,
-    7705,   7569,   7433,   7297,
-    7153,   7017,   6881,   6745,
-    6609,   6465,   6329,   6193,
-    6057,   5921,   5777,   5641,
-    5505,   5369,   5233,   5089,
-    4953,   4817,   4681,   4545,
-    4401,   4265,   4129,   3993,
-    3849,   3713,   3577,   3441,
-    3305,   3161,   3025,   2889,
-    2753,   2617,   2473,   2337,
-    2201,   2065,   1921,   1785,
-    1649,   1513,   1377,   1233,
-    1097,    961,    825,    681,
-     545,    409,    273,    129,
-      -7,   -143,   -279,   -415,
-    -559,   -695,   -831,   -967,
-   -1111,  -1247,  -1383,  -1519,
-   -1655,  -1799,  -1935,  -2071,
-   -2207,  -2351,  -2487,  -2623,
-   -2759,  -2903,  -3039,  -3175,
-   -3311,  -3447,  -3591,  -3727,
-   -3863,  -3999,  -4135,  -4279,
-   -4415,  -4551,  -4687,  -4831,
-   -4967,  -5103,  -5239,  -5375,
-   -5519,  -5655,  -5791,  -5927,
-   -6063,  -6207,  -6343,  -6479,
-   -6615,  -6751,  -6895,  -7031,
-   -7167,  -7303,  -7439,  -7583,
-   -7719,  -7855,  -7991,  -8127,
-   -8271,  -8407,  -8543,  -8679,
-   -8815,  -8959,  -9095,  -9231,
-   -9367,  -9503,  -9647,  -9783,
-   -9919, -10055, -10191, -10335,
-  -10471, -10607, -10743, -10879,
-  -11023, -11159, -11295, -11431,
-  -11575, -11711, -11847, -11983,
-  -12119, -12263, -12399, -12535,
-  -12679, -12815, -12951, -13087,
-  -13231, -13367, -13503, -13647,
-  -13783, -13919, -14063, -14199,
-  -14335, -14479, -14615, -14751,
-  -14895, -15031, -15175, -15311,
-  -15455, -15591, -15735, -15871,
-  -16015, -16151, -16295, -16431,
-  -16575, -16711, -16855, -16991,
-  -17135, -17279, -17415, -17559,
-  -17703, -17847, -17983, -18127,
-  -18271, -18415, -18551, -18695,
-  -18839, -18983, -19127, -19271,
-  -19415, -19559, -19703, -19847,
-  -19991, -20135, -20279, -20423,
-  -20567, -20719, -20863, -21007,
-  -21151, -21295, -21447, -21591,
-  -21735, -21887, -22031, -22175,
-  -22327, -22471, -22615, -22767,
-  -22911, -23063, -23207, -23359,
-  -23503, -23655, -23799, -23951,
-  -24095, -24247, -24391, -24535,
-  -24687, -24831, -24983, -25127,
-  -25279, -25423, -25567, -25719,
-  -25863, -26007, -26159, -26303,
-  -26447, -26591, -26735, -26879,
-  -27023, -27167, -27311, -27447,
-  -27591, -27727, -27871, -28007,
-  -28143, -28279, -28415, -28551,
-  -28687, -28823, -28951, -29079,
-  -29215, -29343, -29463, -29591,
-  -29711, -29839, -29959, -30079,
-  -30191, -30311, -30423, -30535,
-  -30639, -30751, -30855, -30959,
-  -31055, -31159, -31255, -31351,
-  -31439, -31527, -31615, -31695,
-  -31775, -31855, -31927, -31999,
-  -32071, -32135, -32199, -32263,
-  -32319, -32375, -32423, -32471,
-  -32511, -32551, -32591, -32623,
-  -32655, -32679, -32703, -32719,
-  -32735, -32751, -32759, -32767,
-  -32767,
-};
-
-const int16_t wav_trap10[] = {
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32639, -32639, -32639, -32639,
-  -32639, -32639, -32639, -32639,
-  -32639, -32639, -32639, -32647,
-  -32647, -32655, -32671, -32679,
-  -32695, -32711, -32735, -32751,
-  -32759, -32767, -32759, -32735,
-  -32679, -32591, -32463, -32287,
-  -32055, -31775, -31439, -31055,
-  -30631, -30175, -29687, -29183,
-  -28671, -28143, -27615, -27087,
-  -26559, -26039, -25511, -24991,
-  -24479, -23959, -23447, -22935,
-  -22423, -21911, -21407, -20895,
-  -20383, -19879, -19367, -18855,
-  -18351, -17839, -17327, -16823,
-  -16311, -15799, -15287, -14783,
-  -14271, -13759, -13247, -12735,
-  -12231, -11719, -11207, -10695,
-  -10191,  -9679,  -9167,  -8655,
-   -8151,  -7639,  -7127,  -6615,
-   -6111,  -5599,  -5087,  -4575,
-   -4071,  -3559,  -3047,  -2535,
-   -2031,  -1519,  -1007,   -495,
-       9,    521,   1033,   1545,
-    2057,   2561,   3073,   3585,
-    4097,   4601,   5113,   5625,
-    6137,   6641,   7153,   7665,
-    8177,   8681,   9193,   9705,
-   10217,  10721,  11233,  11745,
-   12257,  12761,  13273,  13785,
-   14297,  14809,  15313,  15825,
-   16337,  16849,  17353,  17865,
-   18377,  18881,  19393,  19905,
-   20409,  20921,  21433,  21937,
-   22449,  22961,  23473,  23985,
-   24505,  25025,  25545,  26065,
-   26593,  27113,  27641,  28169,
-   28697,  29209,  29713,  30193,
-   30649,  31073,  31457,  31785,
-   32065,  32297,  32465,  32593,
-   32681,  32729,  32753,  32761,
-   32753,  32745,  32721,  32705,
-   32689,  32673,  32665,  32649,
-   32641,  32641,  32633,  32633,
-   32633,  32633,  32633,  32633,
-   32633,  32633,  32633,  32633,
-   32633,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32641,  32641,  32641,  32641,
-   32633,  32633,  32633,  32633,
-   32633,  32633,  32633,  32633,
-   32633,  32633,  32633,  32641,
-   32641,  32649,  32665,  32673,
-   32689,  32705,  32729,  32745,
-   32753,  32761,  32753,  32729,
-   32673,  32585,  32457,  32281,
-   32049,  31769,  31433,  31049,
-   30625,  30169,  29681,  29177,
-   28665,  28137,  27609,  27081,
-   26553,  26033,  25505,  24985,
-   24473,  23953,  23441,  22929,
-   22417,  21905,  21401,  20889,
-   20377,  19873,  19361,  18849,
-   18345,  17833,  17321,  16817,
-   16305,  15793,  15281,  14777,
-   14265,  13753,  13241,  12729,
-   12225,  11713,  11201,  10689,
-   10185,   9673,   9161,   8649,
-    8145,   7633,   7121,   6609,
-    6105,   5593,   5081,   4569,
-    4065,   3553,   3041,   2529,
-    2025,   1513,   1001,    489,
-     -15,   -527,  -1039,  -1551,
-   -2063,  -2567,  -3079,  -3591,
-   -4103,  -4607,  -5119,  -5631,
-   -6143,  -6647,  -7159,  -7671,
-   -8183,  -8687,  -9199,  -9711,
-  -10223, -10727, -11239, -11751,
-  -12263, -12767, -13279, -13791,
-  -14303, -14815, -15319, -15831,
-  -16343, -16855, -17359, -17871,
-  -18383, -18887, -19399, -19911,
-  -20415, -20927, -21439, -21943,
-  -22455, -22967, -23479, -23991,
-  -24511, -25031, -25551, -26071,
-  -26599, -27119, -27647, -28175,
-  -28703, -29215, -29719, -30199,
-  -30655, -31079, -31463, -31791,
-  -32071, -32303, -32471, -32599,
-  -32687, -32735, -32759, -32767,
-  -32759, -32751, -32727, -32711,
-  -32695, -32679, -32671, -32655,
-  -32647, -32647, -32639, -32639,
-  -32639, -32639, -32639, -32639,
-  -32639, -32639, -32639, -32639,
-  -32639, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647, -32647, -32647, -32647,
-  -32647,
-};
-
-const int16_t wav_trap100[] = {
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32263, -32263,
-  -32263, -32263, -32263, -32263,
-  -32263, -32263, -32263, -32263,
-  -32263, -32263, -32263, -32263,
-  -32263, -32255, -32255, -32255,
-  -32255, -32255, -32255, -32255,
-  -32255, -32255, -32255, -32255,
-  -32247, -32247, -32247, -32247,
-  -32247, -32247, -32247, -32247,
-  -32247, -32247, -32247, -32247,
-  -32247, -32247, -32247, -32255,
-  -32255, -32255, -32255, -32263,
-  -32263, -32263, -32271, -32271,
-  -32279, -32287, -32287, -32295,
-  -32303, -32311, -32319, -32327,
-  -32335, -32343, -32351, -32367,
-  -32375, -32391, -32399, -32415,
-  -32431, -32447, -32455, -32471,
-  -32487, -32511, -32527, -32543,
-  -32559, -32575, -32599, -32615,
-  -32631, -32647, -32663, -32687,
-  -32695, -32711, -32727, -32735,
-  -32751, -32759, -32767, -32767,
-  -32767, -32767, -32759, -32743,
-  -32735, -32711, -32687, -32655,
-  -32623, -32575, -32527, -32471,
-  -32399, -32327, -32247, -32151,
-  -32047, -31935, -31815, -31679,
-  -31535, -31375, -31207, -31031,
-  -30831, -30631, -30407, -30175,
-  -29927, -29671, -29399, -29111,
-  -28815, -28503, -28183, -27847,
-  -27503, -27143, -26767, -26391,
-  -25999, -25599, -25183, -24759,
-  -24335, -23895, -23447, -22991,
-  -22535, -22063, -21591, -21111,
-  -20631, -20143, -19647, -19151,
-  -18647, -18143, -17639, -17127,
-  -16615, -16103, -15591, -15071,
-  -14551, -14031, -13511, -12991,
-  -12471, -11951, -11431, -10903,
-  -10383,  -9863,  -9343,  -8815,
-   -8295,  -7775,  -7255,  -6735,
-   -6215,  -5695,  -5175,  -4655,
-   -4135,  -3615,  -3095,  -2575,
-   -2055,  -1543,  -1023,   -503,
-      17,    529,   1049,   1569,
-    2089,   2601,   3121,   3641,
-    4161,   4681,   5201,   5721,
-    6241,   6761,   7281,   7801,
-    8321,   8841,   9369,   9889,
-   10409,  10929,  11457,  11977,
-   12497,  13017,  13537,  14057,
-   14577,  15097,  15617,  16129,
-   16641,  17153,  17665,  18169,
-   18673,  19177,  19673,  20169,
-   20657,  21137,  21617,  22089,
-   22553,  23017,  23473,  23913,
-   24353,  24785,  25201,  25617,
-   26017,  26409,  26785,  27161,
-   27513,  27865,  28193,  28521,
-   28825,  29129,  29409,  29681,
-   29937,  30185,  30417,  30633,
-   30841,  31033,  31217,  31385,
-   31537,  31681,  31817,  31937,
-   32049,  32153,  32241,  32329,
-   32401,  32465,  32521,  32577,
-   32617,  32649,  32681,  32705,
-   32729,  32745,  32753,  32761,
-   32761,  32761,  32753,  32753,
-   32745,  32729,  32721,  32705,
-   32689,  32673,  32657,  32641,
-   32625,  32609,  32593,  32569,
-   32553,  32537,  32521,  32497,
-   32481,  32465,  32449,  32433,
-   32425,  32409,  32393,  32385,
-   32369,  32361,  32345,  32337,
-   32329,  32321,  32313,  32305,
-   32297,  32289,  32281,  32281,
-   32273,  32265,  32265,  32257,
-   32257,  32257,  32249,  32249,
-   32249,  32249,  32241,  32241,
-   32241,  32241,  32241,  32241,
-   32241,  32241,  32241,  32241,
-   32241,  32241,  32241,  32241,
-   32241,  32249,  32249,  32249,
-   32249,  32249,  32249,  32249,
-   32249,  32249,  32249,  32249,
-   32257,  32257,  32257,  32257,
-   32257,  32257,  32257,  32257,
-   32257,  32257,  32257,  32257,
-   32257,  32257,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32265,  32265,
-   32265,  32265,  32257,  32257,
-   32257,  32257,  32257,  32257,
-   32257,  32257,  32257,  32257,
-   32257,  32257,  32257,  32257,
-   32257,  32249,  32249,  32249,
-   32249,  32249,  32249,  32249,
-   32249,  32249,  32249,  32249,
-   32241,  32241,  32241,  32241,
-   32241,  32241,  32241,  32241,
-   32241,  32241,  32241,  32241,
-   32241,  32241,  32241,  32249,
-   32249,  32249,  32249,  32257,
-   32257,  32257,  32265,  32265,
-   32273,  32281,  32281,  32289,
-   32297,  32305,  32313,  32321,
-   32329,  32337,  32345,  32361,
-   32369,  32385,  32393,  32409,
-   32425,  32441,  32449,  32465,
-   32481,  32505,  32521,  32537,
-   32553,  32569,  32593,  32609,
-   32625,  32641,  32657,  32681,
-   32689,  32705,  32721,  32729,
-   32745,  32753,  32761,  32761,
-   32761,  32761,  32753,  32737,
-   32729,  32705,  32681,  32649,
-   32617,  32569,  32521,  32465,
-   32393,  32321,  32241,  32145,
-   32041,  31929,  31809,  31673,
-   31529,  31369,  31201,  31025,
-   30825,  30625,  30401,  30169,
-   29921,  29665,  29393,  29105,
-   28809,  28497,  28177,  27841,
-   27497,  27137,  26761,  26385,
-   25993,  25593,  25177,  24753,
-   24329,  23889,  23441,  22985,
-   22529,  22057,  21585,  21105,
-   20625,  20137,  19641,  19145,
-   18641,  18137,  17633,  17121,
-   16609,  16097,  15585,  15065,
-   14545,  14025,  13505,  12985,
-   12465,  11945,  11425,  10897,
-   10377,   9857,   9337,   8809,
-    8289,   7769,   7249,   6729,
-    6209,   5689,   5169,   4649,
-    4129,   3609,   3089,   2569,
-    2049,   1537,   1017,    497,
-     -23,   -535,  -1055,  -1575,
-   -2095,  -2607,  -3127,  -3647,
-   -4167,  -4687,  -5207,  -5727,
-   -6247,  -6767,  -7287,  -7807,
-   -8327,  -8847,  -9375,  -9895,
-  -10415, -10935, -11463, -11983,
-  -12503, -13023, -13543, -14063,
-  -14583, -15103, -15623, -16135,
-  -16647, -17159, -17671, -18175,
-  -18679, -19183, -19679, -20175,
-  -20663, -21143, -21623, -22095,
-  -22559, -23023, -23479, -23919,
-  -24359, -24791, -25207, -25623,
-  -26023, -26415, -26791, -27167,
-  -27519, -27871, -28199, -28527,
-  -28831, -29135, -29415, -29687,
-  -29943, -30191, -30423, -30639,
-  -30847, -31039, -31223, -31391,
-  -31543, -31687, -31823, -31943,
-  -32055, -32159, -32247, -32335,
-  -32407, -32471, -32527, -32583,
-  -32623, -32655, -32687, -32711,
-  -32735, -32751, -32759, -32767,
-  -32767, -32767, -32759, -32759,
-  -32751, -32735, -32727, -32711,
-  -32695, -32679, -32663, -32647,
-  -32631, -32615, -32599, -32575,
-  -32559, -32543, -32527, -32503,
-  -32487, -32471, -32455, -32439,
-  -32431, -32415, -32399, -32391,
-  -32375, -32367, -32351, -32343,
-  -32335, -32327, -32319, -32311,
-  -32303, -32295, -32287, -32287,
-  -32279, -32271, -32271, -32263,
-  -32263, -32263, -32255, -32255,
-  -32255, -32255, -32247, -32247,
-  -32247, -32247, -32247, -32247,
-  -32247, -32247, -32247, -32247,
-  -32247, -32247, -32247, -32247,
-  -32247, -32255, -32255, -32255,
-  -32255, -32255, -32255, -32255,
-  -32255, -32255, -32255, -32255,
-  -32263, -32263, -32263, -32263,
-  -32263, -32263, -32263, -32263,
-  -32263, -32263, -32263, -32263,
-  -32263, -32263, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271, -32271, -32271, -32271,
-  -32271,
-};
-
-const int16_t wav_bl_step0[] = {
-   29892,  29116,  31655,  30029,
-   14701,   -291,  -1558,    903,
-};
-
-const int16_t wav_bl_step1[] = {
-   29854,  29139,  31746,  29754,
-   14105,   -536,  -1459,    917,
-};
-
-const int16_t wav_bl_step2[] = {
-   29814,  29168,  31835,  29461,
-   13510,   -764,  -1358,    928,
-};
-
-const int16_t wav_bl_step3[] = {
-   29774,  29200,  31920,  29152,
-   12917,   -976,  -1255,    934,
-};
-
-const int16_t wav_bl_step4[] = {
-   29733,  29238,  31998,  28827,
-   12326,  -1172,  -1151,    936,
-};
-
-const int16_t wav_bl_step5[] = {
-   29692,  29280,  32070,  28485,
-   11740,  -1352,  -1045,    934,
-};
-
-const int16_t wav_bl_step6[] = {
-   29651,  29327,  32138,  28128,
-   11158,  -1517,   -939,    928,
-};
-
-const int16_t wav_bl_step7[] = {
-   29609,  29379,  32198,  27756,
-   10581,  -1666,   -834,    919,
-};
-
-const int16_t wav_bl_step8[] = {
-   29568,  29434,  32250,  27368,
-   10010,  -1800,   -728,    906,
-};
-
-const int16_t wav_bl_step9[] = {
-   29527,  29495,  32295,  26965,
-    9446,  -1919,   -624,    890,
-};
-
-const int16_t wav_bl_step10[] = {
-   29486,  29560,  32331,  26547,
-    8889,  -2024,   -520,    871,
-};
-
-const int16_t wav_bl_step11[] = {
-   29446,  29629,  32361,  26115,
-    8341,  -2114,   -419,    849,
-};
-
-const int16_t wav_bl_step12[] = {
-   29407,  29703,  32378,  25669,
-    7802,  -2191,   -319,    825,
-};
-
-const int16_t wav_bl_step13[] = {
-   29369,  29781,  32384,  25210,
-    7272,  -2254,   -222,    797,
-};
-
-const int16_t wav_bl_step14[] = {
-   29332,  29862,  32381,  24737,
-    6753,  -2305,   -127,    768,
-};
-
-const int16_t wav_bl_step15[] = {
-   29297,  29947,  32370,  24252,
-    6244,  -2342,    -36,    736,
-};
-
-const int16_t wav_bl_step16[] = {
-   29263,  30036,  32343,  23755,
-    5747,  -2368,     52,    702,
-};
-
-const int16_t wav_bl_step17[] = {
-   29232,  30129,  32304,  23246,
-    5262,  -2382,    137,    667,
-};
-
-const int16_t wav_bl_step18[] = {
-   29202,  30222,  32255,  22727,
-    4789,  -2385,    219,    630,
-};
-
-const int16_t wav_bl_step19[] = {
-   29175,  30320,  32193,  22197,
-    4330,  -2377,    296,    592,
-};
-
-const int16_t wav_bl_step20[] = {
-   29150,  30420,  32115,  21658,
-    3884,  -2359,    370,    553,
-};
-
-const int16_t wav_bl_step21[] = {
-   29128,  30522,  32024,  21110,
-    3452,  -2332,    439,    513,
-};
-
-const int16_t wav_bl_step22[] = {
-   29109,  30623,  31920,  20553,
-    3034,  -2295,    504,    472,
-};
-
-const int16_t wav_bl_step23[] = {
-   29093,  30729,  31800,  19989,
-    2631,  -2251,    565,    431,
-};
-
-const int16_t wav_bl_step24[] = {
-   29080,  30834,  31665,  19418,
-    2243,  -2198,    621,    390,
-};
-
-const int16_t wav_bl_step25[] = {
-   29070,  30939,  31518,  18841,
-    1871,  -2138,    672,    348,
-};
-
-const int16_t wav_bl_step26[] = {
-   29065,  31046,  31352,  18259,
-    1514,  -2071,    719,    307,
-};
-
-const int16_t wav_bl_step27[] = {
-   29063,  31152,  31172,  17673,
-    1173,  -1998,    761,    266,
+   32767,
 };
 
-const int16_t wav_bl_step28[] = {
-   29065,  31257,  30975,  17082,
-     847,  -1919,    799,    225,
+const int16_t wav_saw_mipmap[] = {
+       0,  -9413, -17849, -24559,
+  -29182, -31781, -32766, -32730,
+  -32260, -31792, -31542, -31527,
+  -31640, -31744, -31753, -31653,
+  -31491, -31336, -31236, -31200,
+  -31199, -31193, -31151, -31067,
+  -30960, -30857, -30780, -30733,
+  -30702, -30667, -30612, -30536,
+  -30447, -30363, -30293, -30241,
+  -30197, -30150, -30091, -30018,
+  -29939, -29862, -29796, -29740,
+  -29690, -29637, -29576, -29506,
+  -29431, -29359, -29294, -29236,
+  -29183, -29126, -29064, -28995,
+  -28923, -28854, -28790, -28731,
+  -28675, -28617, -28554, -28486,
+  -28416, -28348, -28284, -28225,
+  -28167, -28108, -28044, -27977,
+  -27909, -27842, -27779, -27719,
+  -27660, -27599, -27536, -27469,
+  -27401, -27335, -27272, -27212,
+  -27152, -27091, -27027, -26961,
+  -26894, -26829, -26766, -26705,
+  -26644, -26583, -26519, -26453,
+  -26387, -26322, -26259, -26198,
+  -26137, -26075, -26011, -25945,
+  -25879, -25815, -25752, -25690,
+  -25629, -25567, -25503, -25438,
+  -25372, -25308, -25245, -25183,
+  -25122, -25059, -24995, -24930,
+  -24865, -24800, -24738, -24676,
+  -24614, -24551, -24487, -24422,
+  -24357, -24293, -24230, -24168,
+  -24106, -24044, -23980, -23915,
+  -23850, -23786, -23723, -23661,
+  -23599, -23536, -23472, -23407,
+  -23342, -23279, -23216, -23154,
+  -23091, -23028, -22964, -22900,
+  -22835, -22771, -22709, -22646,
+  -22584, -22521, -22457, -22392,
+  -22328, -22264, -22201, -22139,
+  -22076, -22013, -21949, -21884,
+  -21820, -21757, -21694, -21631,
+  -21569, -21505, -21441, -21377,
+  -21313, -21249, -21186, -21124,
+  -21061, -20998, -20934, -20869,
+  -20805, -20742, -20679, -20616,
+  -20554, -20490, -20426, -20362,
+  -20298, -20235, -20172, -20109,
+  -20046, -19983, -19919, -19854,
+  -19791, -19727, -19664, -19601,
+  -19538, -19475, -19411, -19347,
+  -19283, -19220, -19157, -19094,
+  -19031, -18967, -18904, -18839,
+  -18776, -18712, -18649, -18587,
+  -18523, -18460, -18396, -18332,
+  -18268, -18205, -18142, -18079,
+  -18016, -17952, -17888, -17824,
+  -17761, -17697, -17634, -17572,
+  -17508, -17445, -17381, -17317,
+  -17253, -17190, -17127, -17064,
+  -17001, -16937, -16873, -16809,
+  -16746, -16683, -16620, -16557,
+  -16493, -16430, -16366, -16302,
+  -16238, -16175, -16112, -16049,
+  -15986, -15922, -15858, -15795,
+  -15731, -15668, -15605, -15542,
+  -15478, -15415, -15351, -15287,
+  -15223, -15160, -15097, -15034,
+  -14971, -14907, -14843, -14780,
+  -14716, -14653, -14590, -14527,
+  -14463, -14400, -14336, -14272,
+  -14209, -14145, -14082, -14019,
+  -13956, -13892, -13828, -13765,
+  -13701, -13638, -13575, -13512,
+  -13448, -13385, -13321, -13257,
+  -13194, -13130, -13067, -13004,
+  -12941, -12877, -12813, -12750,
+  -12686, -12623, -12560, -12497,
+  -12433, -12370, -12306, -12242,
+  -12179, -12116, -12052, -11989,
+  -11926, -11862, -11798, -11735,
+  -11671, -11608, -11545, -11482,
+  -11418, -11355, -11291, -11227,
+  -11164, -11101, -11037, -10974,
+  -10911, -10847, -10783, -10720,
+  -10656, -10593, -10530, -10467,
+  -10403, -10340, -10276, -10212,
+  -10149, -10086, -10023,  -9959,
+   -9896,  -9832,  -9768,  -9705,
+   -9641,  -9578,  -9515,  -9452,
+   -9388,  -9325,  -9261,  -9197,
+   -9134,  -9071,  -9008,  -8944,
+   -8881,  -8817,  -8753,  -8690,
+   -8626,  -8563,  -8500,  -8437,
+   -8373,  -8310,  -8246,  -8182,
+   -8119,  -8056,  -7993,  -7929,
+   -7866,  -7802,  -7738,  -7675,
+   -7612,  -7548,  -7485,  -7422,
+   -7358,  -7295,  -7231,  -7167,
+   -7104,  -7041,  -6978,  -6914,
+   -6851,  -6787,  -6723,  -6660,
+   -6597,  -6533,  -6470,  -6407,
+   -6343,  -6280,  -6216,  -6152,
+   -6089,  -6026,  -5963,  -5899,
+   -5836,  -5772,  -5708,  -5645,
+   -5582,  -5518,  -5455,  -5392,
+   -5328,  -5265,  -5201,  -5137,
+   -5074,  -5011,  -4948,  -4884,
+   -4821,  -4757,  -4693,  -4630,
+   -4567,  -4504,  -4440,  -4377,
+   -4313,  -4250,  -4186,  -4123,
+   -4059,  -3996,  -3933,  -3869,
+   -3806,  -3742,  -3678,  -3615,
+   -3552,  -3489,  -3425,  -3362,
+   -3298,  -3235,  -3171,  -3108,
+   -3044,  -2981,  -2918,  -2854,
+   -2791,  -2727,  -2663,  -2600,
+   -2537,  -2474,  -2410,  -2347,
+   -2283,  -2220,  -2156,  -2093,
+   -2029,  -1966,  -1903,  -1839,
+   -1776,  -1712,  -1649,  -1585,
+   -1522,  -1459,  -1395,  -1332,
+   -1268,  -1205,  -1141,  -1078,
+   -1014,   -951,   -888,   -824,
+    -761,   -697,   -634,   -570,
+    -507,   -444,   -380,   -317,
+    -253,   -190,   -126,    -63,
+       0,      0,  -9525, -18040,
+  -24775, -29364, -31883, -32766,
+  -32631, -32078, -31547, -31248,
+  -31185, -31241, -31277, -31210,
+  -31034, -30803, -30586, -30430,
+  -30337, -30275, -30201, -30086,
+  -29931, -29757, -29592, -29456,
+  -29350, -29256, -29153, -29028,
+  -28882, -28728, -28581, -28451,
+  -28338, -28230, -28116, -27988,
+  -27847, -27702, -27562, -27435,
+  -27318, -27203, -27083, -26954,
+  -26816, -26676, -26541, -26414,
+  -26295, -26176, -26053, -25923,
+  -25787, -25650, -25518, -25392,
+  -25270, -25149, -25024, -24894,
+  -24759, -24625, -24494, -24368,
+  -24245, -24122, -23996, -23866,
+  -23732, -23599, -23469, -23343,
+  -23220, -23096, -22969, -22838,
+  -22705, -22573, -22444, -22318,
+  -22194, -22069, -21941, -21811,
+  -21679, -21547, -21419, -21293,
+  -21168, -21042, -20914, -20784,
+  -20652, -20522, -20393, -20267,
+  -20142, -20015, -19887, -19757,
+  -19626, -19496, -19368, -19241,
+  -19116, -18989, -18860, -18730,
+  -18599, -18470, -18342, -18215,
+  -18089, -17962, -17833, -17703,
+  -17573, -17444, -17316, -17189,
+  -17063, -16936, -16807, -16677,
+  -16547, -16418, -16290, -16163,
+  -16037, -15909, -15780, -15650,
+  -15520, -15391, -15264, -15137,
+  -15011, -14883, -14754, -14624,
+  -14494, -14365, -14238, -14111,
+  -13984, -13856, -13727, -13597,
+  -13468, -13339, -13212, -13085,
+  -12958, -12830, -12701, -12571,
+  -12442, -12313, -12186, -12059,
+  -11932, -11803, -11674, -11544,
+  -11415, -11287, -11160, -11033,
+  -10905, -10777, -10648, -10518,
+  -10389, -10261, -10134, -10007,
+   -9879,  -9750,  -9621,  -9492,
+   -9363,  -9235,  -9108,  -8980,
+   -8853,  -8724,  -8595,  -8465,
+   -8337,  -8209,  -8081,  -7954,
+   -7826,  -7698,  -7568,  -7439,
+   -7310,  -7183,  -7055,  -6928,
+   -6800,  -6671,  -6542,  -6413,
+   -6284,  -6156,  -6029,  -5902,
+   -5774,  -5645,  -5515,  -5386,
+   -5258,  -5130,  -5003,  -4876,
+   -4747,  -4618,  -4489,  -4360,
+   -4232,  -4104,  -3977,  -3849,
+   -3721,  -3592,  -3463,  -3334,
+   -3206,  -3078,  -2951,  -2823,
+   -2695,  -2566,  -2436,  -2307,
+   -2179,  -2052,  -1924,  -1797,
+   -1668,  -1539,  -1410,  -1281,
+   -1153,  -1026,   -898,   -770,
+    -642,   -513,   -384,   -255,
+    -127,      0,      0,  -9758,
+  -18438, -25222, -29739, -32092,
+  -32766, -32427, -31707, -31050,
+  -30650, -30485, -30421, -30314,
+  -30089, -29758, -29384, -29043,
+  -28770, -28559, -28367, -28150,
+  -27887, -27585, -27274, -26984,
+  -26727, -26495, -26268, -26023,
+  -25753, -25465, -25177, -24903,
+  -24649, -24407, -24165, -23910,
+  -23638, -23358, -23080, -22813,
+  -22560, -22313, -22062, -21802,
+  -21531, -21255, -20983, -20720,
+  -20466, -20215, -19960, -19697,
+  -19426, -19154, -18886, -18625,
+  -18370, -18116, -17858, -17593,
+  -17324, -17054, -16788, -16528,
+  -16272, -16017, -15757, -15491,
+  -15222, -14954, -14690, -14431,
+  -14174, -13917, -13655, -13389,
+  -13121, -12854, -12591, -12333,
+  -12076, -11817, -11554, -11288,
+  -11020, -10755, -10493, -10235,
+   -9977,  -9717,  -9453,  -9187,
+   -8920,  -8655,  -8394,  -8136,
+   -7878,  -7617,  -7352,  -7086,
+   -6819,  -6556,  -6296,  -6037,
+   -5778,  -5516,  -5251,  -4985,
+   -4719,  -4457,  -4197,  -3939,
+   -3679,  -3416,  -3151,  -2884,
+   -2619,  -2358,  -2098,  -1840,
+   -1579,  -1316,  -1050,   -784,
+    -520,   -258,      0,      0,
+  -10263, -19296, -26184, -30541,
+  -32537, -32767, -32001, -30936,
+  -30019, -29403, -29014, -28679,
+  -28255, -27691, -27032, -26366,
+  -25764, -25243, -24770, -24288,
+  -23757, -23173, -22565, -21972,
+  -21418, -20900, -20392, -19868,
+  -19312, -18731, -18147, -17581,
+  -17042, -16518, -15993, -15450,
+  -14885, -14310, -13740, -13188,
+  -12653, -12124, -11587, -11034,
+  -10467,  -9897,  -9337,  -8793,
+   -8259,  -7725,  -7179,  -6619,
+   -6052,  -5488,  -4936,  -4396,
+   -3862,  -3322,  -2770,  -2206,
+   -1640,  -1081,   -536,      0,
+       0,  -5699, -11192, -16287,
+  -20822, -24674, -27769, -30083,
+  -31638, -32500, -32767, -32558,
+  -32002, -31224, -30336, -29429,
+  -28568, -27792, -27116, -26533,
+  -26020, -25549, -25088, -24610,
+  -24095, -23533, -22924, -22277,
+  -21605, -20926, -20255, -19606,
+  -18985, -18394, -17829, -17282,
+  -16741, -16195, -15635, -15055,
+  -14452, -13830, -13194, -12552,
+  -11913, -11284, -10671, -10076,
+   -9498,  -8932,  -8371,  -7809,
+   -7238,  -6654,  -6055,  -5441,
+   -4815,  -4184,  -3553,  -2929,
+   -2317,  -1720,  -1137,   -565,
+       0,      0,  -3367,  -6693,
+   -9939, -13066, -16039, -18826,
+  -21399, -23735, -25815, -27626,
+  -29160, -30414, -31392, -32102,
+  -32554, -32766, -32758, -32551,
+  -32169, -31638, -30983, -30231,
+  -29406, -28531, -27627, -26713,
+  -25804, -24915, -24054, -23228,
+  -22442, -21696, -20989, -20318,
+  -19679, -19063, -18466, -17878,
+  -17294, -16705, -16106, -15493,
+  -14859, -14205, -13527, -12827,
+  -12106, -11366, -10612,  -9847,
+   -9077,  -8305,  -7537,  -6777,
+   -6029,  -5296,  -4580,  -3882,
+   -3202,  -2538,  -1890,  -1253,
+    -624,      0,      0,  -2190,
+   -4369,  -6528,  -8656, -10742,
+  -12776, -14750, -16655, -18481,
+  -20221, -21868, -23415, -24856,
+  -26185, -27399, -28493, -29465,
+  -30312, -31033, -31629, -32098,
+  -32443, -32665, -32767, -32751,
+  -32623, -32386, -32046, -31608,
+  -31079, -30464, -29770, -29005,
+  -28175, -27287, -26350, -25369,
+  -24353, -23308, -22241, -21158,
+  -20066, -18971, -17877, -16789,
+  -15713, -14651, -13608, -12585,
+  -11586, -10612,  -9663,  -8741,
+   -7845,  -6975,  -6129,  -5307,
+   -4507,  -3725,  -2959,  -2207,
+   -1466,   -731,      0,      0,
+   -1607,  -3211,  -4807,  -6392,
+   -7961,  -9511, -11038, -12539,
+  -14009, -15446, -16845, -18204,
+  -19519, -20787, -22004, -23169,
+  -24278, -25329, -26318, -27244,
+  -28105, -28897, -29621, -30272,
+  -30851, -31356, -31785, -32137,
+  -32412, -32609, -32727, -32767,
+  -32727, -32609, -32412, -32137,
+  -31785, -31356, -30851, -30272,
+  -29621, -28897, -28105, -27244,
+  -26318, -25329, -24278, -23169,
+  -22004, -20787, -19519, -18204,
+  -16845, -15446, -14009, -12539,
+  -11038,  -9511,  -7961,  -6392,
+   -4807,  -3211,  -1607,      0,
 };
 
-const int16_t wav_bl_step29[] = {
-   29071,  31358,  30765,  16489,
-     538,  -1835,    831,    185,
+const int16_t wav_tri_mipmap[] = {
+       0,    128,    257,    386,
+     515,    644,    773,    902,
+    1031,   1160,   1289,   1418,
+    1547,   1676,   1805,   1934,
+    2063,   2192,   2321,   2450,
+    2579,   2708,   2837,   2966,
+    3095,   3224,   3353,   3482,
+    3611,   3740,   3869,   3998,
+    4127,   4256,   4385,   4514,
+    4643,   4771,   4900,   5029,
+    5158,   5287,   5416,   5545,
+    5674,   5803,   5932,   6061,
+    6190,   6319,   6448,   6577,
+    6706,   6835,   6964,   7093,
+    7222,   7351,   7480,   7609,
+    7738,   7867,   7996,   8125,
+    8254,   8383,   8512,   8641,
+    8770,   8899,   9028,   9157,
+    9285,   9414,   9543,   9672,
+    9801,   9930,  10059,  10188,
+   10317,  10446,  10575,  10704,
+   10833,  10962,  11091,  11220,
+   11349,  11478,  11607,  11736,
+   11865,  11994,  12123,  12252,
+   12381,  12510,  12639,  12768,
+   12897,  13026,  13155,  13284,
+   13413,  13542,  13671,  13800,
+   13929,  14057,  14186,  14315,
+   14444,  14573,  14702,  14831,
+   14960,  15089,  15218,  15347,
+   15476,  15605,  15734,  15863,
+   15992,  16121,  16250,  16379,
+   16508,  16637,  16766,  16895,
+   17024,  17153,  17282,  17411,
+   17540,  17669,  17798,  17927,
+   18056,  18185,  18314,  18443,
+   18571,  18700,  18829,  18958,
+   19087,  19216,  19345,  19474,
+   19603,  19732,  19861,  19990,
+   20119,  20248,  20377,  20506,
+   20635,  20764,  20893,  21022,
+   21151,  21280,  21409,  21538,
+   21667,  21796,  21925,  22054,
+   22183,  22312,  22441,  22570,
+   22699,  22828,  22957,  23086,
+   23215,  23344,  23472,  23601,
+   23730,  23859,  23988,  24117,
+   24246,  24375,  24504,  24633,
+   24762,  24891,  25020,  25149,
+   25278,  25407,  25536,  25665,
+   25794,  25923,  26052,  26181,
+   26310,  26439,  26568,  26697,
+   26826,  26955,  27084,  27213,
+   27342,  27471,  27600,  27728,
+   27857,  27986,  28115,  28245,
+   28374,  28502,  28631,  28760,
+   28889,  29018,  29147,  29276,
+   29405,  29534,  29663,  29792,
+   29921,  30050,  30179,  30308,
+   30437,  30566,  30695,  30823,
+   30952,  31082,  31211,  31341,
+   31470,  31598,  31726,  31854,
+   31983,  32114,  32246,  32376,
+   32499,  32607,  32693,  32748,
+   32767,      0,    259,    519,
+     779,   1039,   1299,   1559,
+    1819,   2079,   2339,   2598,
+    2858,   3118,   3378,   3638,
+    3898,   4158,   4418,   4678,
+    4937,   5197,   5457,   5717,
+    5977,   6237,   6497,   6757,
+    7017,   7277,   7537,   7796,
+    8056,   8316,   8576,   8836,
+    9096,   9356,   9616,   9876,
+   10135,  10395,  10655,  10915,
+   11175,  11435,  11695,  11955,
+   12215,  12474,  12734,  12994,
+   13254,  13514,  13774,  14034,
+   14294,  14554,  14813,  15073,
+   15333,  15593,  15853,  16113,
+   16373,  16633,  16893,  17153,
+   17413,  17673,  17932,  18192,
+   18452,  18712,  18972,  19232,
+   19492,  19752,  20012,  20271,
+   20531,  20791,  21051,  21311,
+   21571,  21831,  22091,  22351,
+   22610,  22870,  23130,  23390,
+   23650,  23910,  24170,  24430,
+   24689,  24949,  25209,  25469,
+   25729,  25990,  26249,  26509,
+   26768,  27028,  27288,  27549,
+   27809,  28069,  28329,  28588,
+   28847,  29107,  29367,  29628,
+   29889,  30149,  30408,  30666,
+   30924,  31184,  31448,  31713,
+   31976,  32224,  32443,  32616,
+   32728,  32766,      0,    527,
+    1054,   1582,   2110,   2638,
+    3165,   3693,   4220,   4748,
+    5275,   5803,   6331,   6859,
+    7386,   7914,   8441,   8968,
+    9496,  10024,  10552,  11080,
+   11607,  12134,  12661,  13189,
+   13717,  14245,  14773,  15300,
+   15828,  16355,  16882,  17409,
+   17937,  18466,  18994,  19521,
+   20049,  20575,  21102,  21630,
+   22158,  22687,  23215,  23743,
+   24269,  24795,  25322,  25850,
+   26380,  26910,  27439,  27964,
+   28487,  29010,  29538,  30073,
+   30612,  31146,  31653,  32102,
+   32458,  32687,  32767,      0,
+    1084,   2169,   3257,   4346,
+    5434,   6521,   7605,   8689,
+    9774,  10861,  11950,  13039,
+   14127,  15212,  16294,  17377,
+   18463,  19553,  20645,  21736,
+   22821,  23899,  24974,  26057,
+   27155,  28265,  29369,  30424,
+   31364,  32113,  32598,  32766,
+       0,   1140,   2282,   3427,
+    4577,   5730,   6886,   8045,
+    9203,  10359,  11511,  12658,
+   13799,  14936,  16071,  17206,
+   18346,  19493,  20650,  21817,
+   22993,  24171,  25344,  26498,
+   27616,  28680,  29666,  30553,
+   31316,  31936,  32392,  32672,
+   32767,      0,   1245,   2492,
+    3743,   5001,   6267,   7541,
+    8825,  10118,  11420,  12729,
+   14042,  15358,  16671,  17978,
+   19272,  20549,  21802,  23023,
+   24206,  25342,  26425,  27445,
+   28396,  29270,  30059,  30758,
+   31360,  31860,  32254,  32538,
+   32709,  32767,      0,   1607,
+    3211,   4807,   6392,   7961,
+    9511,  11038,  12539,  14009,
+   15446,  16845,  18204,  19519,
+   20787,  22004,  23169,  24278,
+   25329,  26318,  27244,  28105,
+   28897,  29621,  30272,  30851,
+   31356,  31785,  32137,  32412,
+   32609,  32727,  32767,      0,
+    1607,   3211,   4807,   6392,
+    7961,   9511,  11038,  12539,
+   14009,  15446,  16845,  18204,
+   19519,  20787,  22004,  23169,
+   24278,  25329,  26318,  27244,
+   28105,  28897,  29621,  30272,
+   30851,  31356,  31785,  32137,
+   32412,  32609,  32727,  32767,
 };
 
-const int16_t wav_bl_step30[] = {
-   29082,  31461,  30537,  15894,
-     245,  -1746,    860,    145,
+const int16_t wav_trap_mipmap[] = {
+       0,    255,    511,    767,
+    1023,   1279,   1535,   1791,
+    2047,   2303,   2559,   2815,
+    3071,   3327,   3583,   3839,
+    4095,   4351,   4607,   4863,
+    5119,   5375,   5631,   5887,
+    6142,   6398,   6654,   6910,
+    7166,   7422,   7678,   7934,
+    8190,   8446,   8702,   8958,
+    9214,   9470,   9726,   9982,
+   10238,  10494,  10750,  11006,
+   11262,  11518,  11774,  12030,
+   12285,  12541,  12797,  13053,
+   13309,  13565,  13821,  14077,
+   14333,  14589,  14845,  15101,
+   15357,  15613,  15869,  16125,
+   16381,  16637,  16893,  17149,
+   17405,  17661,  17917,  18172,
+   18428,  18684,  18940,  19196,
+   19452,  19708,  19964,  20220,
+   20476,  20732,  20988,  21244,
+   21500,  21756,  22012,  22268,
+   22524,  22780,  23036,  23292,
+   23548,  23804,  24060,  24315,
+   24571,  24827,  25083,  25339,
+   25595,  25851,  26107,  26363,
+   26619,  26875,  27131,  27387,
+   27643,  27899,  28155,  28410,
+   28666,  28922,  29179,  29436,
+   29692,  29947,  30202,  30457,
+   30713,  30971,  31230,  31487,
+   31737,  31972,  32185,  32367,
+   32514,  32623,  32697,  32740,
+   32760,  32766,  32765,  32763,
+   32761,  32760,  32761,  32762,
+   32763,  32763,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,  32762,  32762,  32762,
+   32762,      0,    511,   1023,
+    1535,   2047,   2559,   3071,
+    3582,   4094,   4606,   5118,
+    5630,   6142,   6654,   7165,
+    7677,   8189,   8701,   9213,
+    9725,  10237,  10748,  11260,
+   11772,  12284,  12795,  13307,
+   13819,  14331,  14843,  15355,
+   15867,  16378,  16890,  17402,
+   17914,  18426,  18938,  19450,
+   19961,  20473,  20985,  21497,
+   22009,  22521,  23033,  23544,
+   24055,  24567,  25079,  25592,
+   26105,  26617,  27128,  27638,
+   28147,  28660,  29175,  29693,
+   30207,  30708,  31179,  31606,
+   31972,  32266,  32483,  32630,
+   32715,  32755,  32766,  32764,
+   32758,  32754,  32754,  32756,
+   32758,  32760,  32759,  32758,
+   32757,  32756,  32757,  32757,
+   32758,  32758,  32758,  32758,
+   32757,  32757,  32757,  32758,
+   32758,  32758,  32758,  32758,
+   32757,  32757,  32757,  32758,
+   32758,  32758,  32758,  32758,
+   32757,  32757,  32757,  32758,
+   32758,  32758,  32758,  32758,
+   32757,  32757,  32757,  32758,
+   32758,  32758,  32758,  32758,
+   32757,  32757,  32758,  32758,
+   32758,  32758,  32758,  32758,
+   32758,  32757,      0,   1022,
+    2045,   3069,   4093,   5117,
+    6141,   7163,   8186,   9209,
+   10233,  11257,  12282,  13305,
+   14328,  15349,  16372,  17395,
+   18421,  19447,  20471,  21493,
+   22512,  23531,  24554,  25584,
+   26619,  27649,  28652,  29600,
+   30457,  31191,  31779,  32214,
+   32503,  32669,  32746,  32767,
+   32761,  32749,  32742,  32741,
+   32746,  32750,  32752,  32752,
+   32749,  32747,  32746,  32746,
+   32748,  32750,  32750,  32750,
+   32748,  32747,  32747,  32747,
+   32748,  32749,  32750,  32749,
+   32748,  32748,  32747,      0,
+    2041,   4087,   6136,   8187,
+   10234,  12274,  14310,  16351,
+   18404,  20471,  22534,  24551,
+   26461,  28190,  29669,  30848,
+   31711,  32276,  32595,  32735,
+   32766,  32750,  32725,  32712,
+   32714,  32725,  32735,  32740,
+   32737,  32730,  32723,  32720,
+       0,   2033,   4071,   6117,
+    8173,  10235,  12297,  14347,
+   16369,  18344,  20251,  22068,
+   23772,  25344,  26768,  28032,
+   29130,  30060,  30826,  31439,
+   31910,  32256,  32496,  32649,
+   32733,  32767,  32765,  32742,
+   32709,  32675,  32646,  32627,
+   32620,      0,   2016,   4022,
+    6007,   7960,   9872,  11732,
+   13534,  15268,  16928,  18509,
+   20005,  21413,  22730,  23954,
+   25085,  26123,  27070,  27928,
+   28700,  29389,  29999,  30535,
+   31001,  31403,  31744,  32029,
+   32263,  32449,  32590,  32689,
+   32747,  32767,      0,   1607,
+    3211,   4807,   6392,   7961,
+    9511,  11038,  12539,  14009,
+   15446,  16845,  18204,  19519,
+   20787,  22004,  23169,  24278,
+   25329,  26318,  27244,  28105,
+   28897,  29621,  30272,  30851,
+   31356,  31785,  32137,  32412,
+   32609,  32727,  32767,      0,
+    1607,   3211,   4807,   6392,
+    7961,   9511,  11038,  12539,
+   14009,  15446,  16845,  18204,
+   19519,  20787,  22004,  23169,
+   24278,  25329,  26318,  27244,
+   28105,  28897,  29621,  30272,
+   30851,  31356,  31785,  32137,
+   32412,  32609,  32727,  32767,
 };
 
-const int16_t wav_bl_step31[] = {
-   29097,  31560,  30291,  15298,
-     -31,  -1654,    883,    107,
+const int16_t wav_bl_step[] = {
+   16325,  16304,  16282,  16260,
+   16238,  16216,  16193,  16170,
+   16148,  16125,  16103,  16081,
+   16060,  16039,  16019,  16000,
+   15981,  15964,  15948,  15933,
+   15919,  15907,  15897,  15888,
+   15881,  15876,  15873,  15872,
+   15873,  15877,  15882,  15890,
+   15901,  15914,  15929,  15947,
+   15968,  15991,  16016,  16044,
+   16075,  16108,  16143,  16181,
+   16221,  16264,  16308,  16355,
+   16403,  16454,  16505,  16559,
+   16613,  16669,  16724,  16782,
+   16839,  16896,  16955,  17013,
+   17070,  17126,  17181,  17235,
+   17288,  17337,  17386,  17432,
+   17475,  17514,  17552,  17584,
+   17612,  17637,  17657,  17673,
+   17683,  17686,  17684,  17678,
+   17663,  17642,  17616,  17581,
+   17539,  17489,  17432,  17367,
+   17293,  17213,  17122,  17024,
+   16916,  16801,  16677,  16542,
+   16400,  16249,  16089,  15920,
+   15743,  15556,  15361,  15158,
+   14946,  14726,  14498,  14262,
+   14018,  13768,  13509,  13244,
+   12973,  12695,  12412,  12122,
+   11828,  11528,  11225,  10916,
+   10605,  10290,   9972,   9651,
+    9329,   9005,   8680,   8355,
+    8028,   7703,   7378,   7054,
+    6732,   6411,   6093,   5778,
+    5467,   5158,   4855,   4555,
+    4261,   3971,   3688,   3410,
+    3139,   2874,   2615,   2365,
+    2121,   1885,   1657,   1437,
+    1225,   1022,    826,    640,
+     462,    294,    134,    -17,
+    -159,   -292,   -417,   -533,
+    -640,   -738,   -828,   -910,
+    -983,  -1048,  -1105,  -1155,
+   -1196,  -1231,  -1258,  -1279,
+   -1293,  -1301,  -1302,  -1298,
+   -1288,  -1273,  -1253,  -1229,
+   -1200,  -1167,  -1131,  -1091,
+   -1048,  -1002,   -954,   -903,
+    -851,   -797,   -741,   -685,
+    -628,   -571,   -513,   -455,
+    -397,   -340,   -284,   -229,
+    -174,   -121,    -69,    -19,
+      28,     75,    119,    161,
+     202,    240,    275,    308,
+     339,    367,    392,    415,
+     436,    454,    469,    482,
+     493,    501,    506,    510,
+     511,    510,    507,    502,
+     495,    486,    476,    464,
+     450,    435,    419,    402,
+     383,    364,    344,    323,
+     302,    280,    258,    235,
+     213,    190,    167,    145,
+     123,    101,     79,     58,
 };
 
 
 
 const int16_t* waveform_table[] = {
   wav_sine,
-  wav_saw10,
-  wav_saw100,
-  wav_tri10,
-  wav_tri100,
-  wav_trap10,
-  wav_trap100,
-  wav_bl_step0,
-  wav_bl_step1,
-  wav_bl_step2,
-  wav_bl_step3,
-  wav_bl_step4,
-  wav_bl_step5,
-  wav_bl_step6,
-  wav_bl_step7,
-  wav_bl_step8,
-  wav_bl_step9,
-  wav_bl_step10,
-  wav_bl_step11,
-  wav_bl_step12,
-  wav_bl_step13,
-  wav_bl_step14,
-  wav_bl_step15,
-  wav_bl_step16,
-  wav_bl_step17,
-  wav_bl_step18,
-  wav_bl_step19,
-  wav_bl_step20,
-  wav_bl_step21,
-  wav_bl_step22,
-  wav_bl_step23,
-  wav_bl_step24,
-  wav_bl_step25,
-  wav_bl_step26,
-  wav_bl_step27,
-  wav_bl_step28,
-  wav_bl_step29,
-  wav_bl_step30,
-  wav_bl_step31,
+  wav_saw_mipmap,
+  wav_tri_mipmap,
+  wav_trap_mipmap,
+  wav_bl_step,
 };
 
 
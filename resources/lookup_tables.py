@@ -29,29 +29,69 @@
 # -----------------------------------------------------------------------------
 #
 # Lookup table definitions.
+#
+# Only the standard library is used; the helpers below reproduce the
+# rounding of numpy.round and the interpolation of scipy's interp1d.
 
-import numpy
+import bisect
+import math
 import os
 
 sample_rate = int(os.environ["SAMPLE_RATE"])
 
+# rounds half to even
+def round_int(x):
+    r = math.floor(x)
+    if x - r > 0.5 or (x - r == 0.5 and r % 2):
+        r += 1
+    return int(r)
+
+# scipy.interpolate.interp1d(xp, yp, kind) evaluated at every point of x
+def interpolate(xp, yp, x, kind='linear'):
+    y = []
+    if kind == 'nearest':
+        bounds = [(a / 2.0) + (b / 2.0) for a, b in zip(xp[1:], xp[:-1])]
+        for v in x:
+            y.append(yp[min(bisect.bisect_left(bounds, v), len(xp) - 1)])
+    else:
+        for v in x:
+            i = min(max(bisect.bisect_left(xp, v), 1), len(xp) - 1)
+            slope = (yp[i] - yp[i - 1]) / float(xp[i] - xp[i - 1])
+            y.append(slope * (v - xp[i - 1]) + yp[i - 1])
+    return y
+
 """----------------------------------------------------------------------------
 Pitch increments
 ----------------------------------------------------------------------------"""
 
 lookup_tables = []
+lookup_tables_signed = []
 lookup_tables_32 = []
 
 excursion = float(1 << 32)
 
 a4_midi = 69
 a4_pitch = 440.0
-notes = numpy.arange(0 * 128.0, 12 * 128.0 + 16, 16) / 128.0
-pitches = a4_pitch * 2 ** ((notes - a4_midi) / 12)
-increments = excursion / sample_rate * pitches
+
+# pitches are in 1/2048 semitone; the increments of the octave above
+# MIDI note 0 are read in two steps: every 256th pitch, then the ratio
+# between a pitch and the one below it in the same step, minus 1, in Q23
+pitch_resolution = 128 * 16
+num_pitch_fractions = 256
+octave = 12 * pitch_resolution
+
+notes = [n / float(pitch_resolution)
+         for n in xrange(0, octave, num_pitch_fractions)]
+pitches = [a4_pitch * 2 ** ((note - a4_midi) / 12) for note in notes]
+increments = [excursion / sample_rate * pitch for pitch in pitches]
 
 lookup_tables_32.append(
-    ('increments', increments.astype(int)))
+    ('pitch_increments', map(round_int, increments)))
+
+fractions = [2 ** (n / float(octave)) - 1
+             for n in xrange(num_pitch_fractions)]
+lookup_tables.append(
+    ('pitch_fractions', [round_int(f * (1 << 23)) for f in fractions]))
 
 
 """----------------------------------------------------------------------------
@@ -62,10 +102,7 @@ Rough fader scaler (from hand-taken measurements)
 fader_scale6 = [0, 6637, 23378, 40134, 57125, 65520]
 fader_scale5 = [0, 9972, 31880, 52396, 65520]
 
-import math
-from scipy import interpolate
-
-x = numpy.arange(0, 65535, 255)
+x = range(0, 65535, 255)
 
 # scaler for frequency selection
 def freq_to_midi(freq):
@@ -73,16 +110,26 @@ def freq_to_midi(freq):
 
 scale_pitch = map(freq_to_midi, [0.01, 0.05, 0.5, 2.5, 15, 106])
 scale_pitch = [(z * 128) + 32768 for z in scale_pitch]
-scale_pitch_fun = interpolate.interp1d(fader_scale6, scale_pitch, kind='linear')
-lookup_tables.append(('scale_pitch', scale_pitch_fun(x)))
+lookup_tables.append(
+    ('scale_pitch', interpolate(fader_scale6, scale_pitch, x)))
 
 # scaler for phase selection
 step = 65536 / 4
 scale_phase = [(step*0), (step*1)-1, (step*2)-1, (step*3)-1, (step*4)-1]
-scale_phase_fun = interpolate.interp1d(fader_scale5, scale_phase, kind='linear')
-lookup_tables.append(('scale_phase', scale_phase_fun(x)))
+lookup_tables.append(
+    ('scale_phase', interpolate(fader_scale5, scale_phase, x)))
 
 # scaler for divider
 scale_divide = [32, 16, 8, 4, 3, 2]
-scale_divide_fun = interpolate.interp1d(fader_scale6, scale_divide, kind='nearest')
-lookup_tables.append(('scale_divide', scale_divide_fun(x)))
+lookup_tables.append(
+    ('scale_divide', interpolate(fader_scale6, scale_divide, x, 'nearest')))
+
+# scaler for divider and multiplier, from hand-set ranges of the pot
+# (in steps of 256): dividers are positive, multipliers negative
+scale_divide_multiply_ranges = [
+    (32, 14), (16, 18), (8, 20), (4, 20), (3, 20), (2, 20), (1, 32),
+    (-2, 20), (-3, 20), (-4, 20), (-8, 20), (-16, 18), (-32, 15)]
+scale_divide_multiply = []
+for value, length in scale_divide_multiply_ranges:
+    scale_divide_multiply.extend([value] * length)
+lookup_tables_signed.append(('scale_divide_multiply', scale_divide_multiply))
@@ -28,4218 +28,88 @@
 #
 # Waveform definitions.
 
-import numpy
+import math
 
 WAVETABLE_SIZE = 1024
 
 waveforms = []
 
+# Symmetric waveforms are stored as a fraction of their period, and
+# mirrored back by the accessors in wavetable.h:
+#  - quarter-wave tables (WAVETABLE_SIZE / 4 + 1 entries) hold the
+#    first quarter of a sine-like shape;
+#  - half-wave tables (WAVETABLE_SIZE / 2 + 1 entries) hold the first
+#    half of a shape which is odd around the middle of its period.
+
+def quarter_wave(x, size=WAVETABLE_SIZE):
+  return x[:size / 4 + 1]
+
+def half_wave(x, size=WAVETABLE_SIZE):
+  return x[:size / 2 + 1]
+
 """----------------------------------------------------------------------------
 Sine wave
 ----------------------------------------------------------------------------"""
 
-x = numpy.arange(0, WAVETABLE_SIZE + 1) / float(WAVETABLE_SIZE)
-x[-1] = x[0]
-sine = numpy.sin(2 * numpy.pi * x)
-waveforms.append(('sine', (32767 * sine).astype(int)))
+x = [i / float(WAVETABLE_SIZE) for i in xrange(WAVETABLE_SIZE + 1)]
+sine = [math.sin(2 * math.pi * t) for t in x]
+waveforms.append(('sine', quarter_wave([int(32767 * s) for s in sine])))
 
 
 """----------------------------------------------------------------------------
 Bandlimited waves
 ----------------------------------------------------------------------------"""
 
-saw10 = [
-    4118, 4073, 4027, 3982, 3937, 3891, 3846, 3801, 3755, 3710, 3665,
-    3621, 3576, 3531, 3487, 3442, 3398, 3354, 3310, 3266, 3223, 3179,
-    3136, 3093, 3051, 3008, 2966, 2924, 2882, 2840, 2799, 2758, 2717,
-    2677, 2636, 2596, 2557, 2517, 2478, 2439, 2401, 2363, 2325, 2287,
-    2250, 2213, 2176, 2139, 2103, 2068, 2032, 1997, 1962, 1928, 1894,
-    1860, 1827, 1794, 1761, 1728, 1696, 1665, 1633, 1602, 1572, 1541,
-    1511, 1482, 1452, 1423, 1395, 1366, 1338, 1311, 1284, 1257, 1230,
-    1204, 1178, 1153, 1127, 1103, 1078, 1054, 1030, 1007, 983, 961, 938,
-    916, 894, 873, 852, 831, 810, 790, 770, 751, 731, 712, 694, 675, 657,
-    640, 622, 605, 588, 572, 556, 540, 524, 509, 494, 479, 465, 450, 437,
-    423, 410, 396, 384, 371, 359, 347, 335, 323, 312, 301, 290, 280, 270,
-    259, 250, 240, 231, 222, 213, 204, 196, 187, 179, 172, 164, 157, 149,
-    143, 136, 129, 123, 117, 111, 105, 99, 94, 89, 84, 79, 74, 69, 65, 61,
-    57, 53, 49, 46, 42, 39, 36, 33, 30, 27, 25, 22, 20, 18, 16, 14, 12,
-    11, 9, 8, 7, 5, 4, 4, 3, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2,
-    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 14, 16, 17, 19, 20, 22, 24, 25, 27,
-    29, 31, 33, 35, 37, 39, 41, 44, 46, 48, 50, 53, 55, 58, 60, 63, 65,
-    68, 70, 73, 75, 78, 81, 83, 86, 89, 92, 94, 97, 100, 103, 106, 108,
-    111, 114, 117, 120, 123, 126, 129, 132, 135, 138, 141, 144, 147, 150,
-    153, 155, 158, 161, 164, 167, 170, 173, 176, 179, 182, 185, 188, 191,
-    194, 197, 200, 203, 206, 209, 212, 215, 218, 221, 224, 227, 230, 232,
-    235, 238, 241, 244, 247, 250, 252, 255, 258, 261, 264, 266, 269, 272,
-    275, 277, 280, 283, 285, 288, 291, 293, 296, 299, 301, 304, 306, 309,
-    311, 314, 316, 319, 321, 324, 326, 329, 331, 334, 336, 338, 341, 343,
-    345, 348, 350, 352, 355, 357, 359, 361, 363, 366, 368, 370, 372, 374,
-    376, 379, 381, 383, 385, 387, 389, 391, 393, 395, 397, 399, 401, 403,
-    405, 407, 408, 410, 412, 414, 416, 418, 420, 421, 423, 425, 427, 428,
-    430, 432, 434, 435, 437, 439, 440, 442, 444, 445, 447, 448, 450, 452,
-    453, 455, 456, 458, 459, 461, 462, 464, 465, 467, 468, 470, 471, 473,
-    474, 475, 477, 478, 480, 481, 482, 484, 485, 486, 488, 489, 490, 492,
-    493, 494, 495, 497, 498, 499, 500, 502, 503, 504, 505, 506, 508, 509,
-    510, 511, 512, 514, 515, 516, 517, 518, 519, 520, 522, 523, 524, 525,
-    526, 527, 528, 529, 530, 531, 532, 533, 535, 536, 537, 538, 539, 540,
-    541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
-    555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 564, 565, 566, 567,
-    568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 579, 580,
-    581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 590, 591, 592, 593,
-    594, 595, 596, 597, 598, 599, 599, 600, 601, 602, 603, 604, 605, 606,
-    607, 608, 608, 609, 610, 611, 612, 613, 614, 615, 616, 616, 617, 618,
-    619, 620, 621, 622, 623, 624, 625, 625, 626, 627, 628, 629, 630, 631,
-    632, 633, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 642, 643,
-    644, 645, 646, 647, 648, 649, 650, 651, 652, 652, 653, 654, 655, 656,
-    657, 658, 659, 660, 661, 662, 662, 663, 664, 665, 666, 667, 668, 669,
-    670, 671, 672, 673, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682,
-    683, 684, 685, 686, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695,
-    696, 697, 698, 699, 700, 700, 701, 702, 703, 704, 705, 706, 707, 708,
-    709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 718, 719, 720, 721,
-    722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735,
-    736, 737, 738, 739, 740, 740, 741, 742, 743, 744, 745, 746, 747, 748,
-    749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762,
-    763, 764, 765, 766, 767, 768, 769, 770, 771, 771, 772, 773, 774, 775,
-    776, 777, 778, 779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789,
-    790, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800, 801, 802, 803,
-    804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 816,
-    817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830,
-    831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844,
-    845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858,
-    859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872,
-    873, 874, 875, 876, 877, 878, 879, 880, 880, 881, 882, 883, 884, 885,
-    886, 887, 888, 889, 890, 891, 892, 893, 894, 895, 896, 897, 898, 899,
-    900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 910, 911, 912, 913,
-    914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927,
-    928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941,
-    942, 943, 944, 944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954,
-    955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968,
-    969, 970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980, 981, 982,
-    983, 984, 985, 986, 987, 988, 989, 990, 991, 992, 993, 994, 995, 996,
-    997, 998, 999, 1000, 1001, 1002, 1002, 1003, 1004, 1005, 1006, 1007,
-    1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018,
-    1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029,
-    1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040,
-    1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051,
-    1052, 1053, 1054, 1055, 1056, 1056, 1057, 1058, 1059, 1060, 1061,
-    1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072,
-    1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083,
-    1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094,
-    1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105,
-    1106, 1107, 1108, 1109, 1109, 1110, 1111, 1112, 1113, 1114, 1115,
-    1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126,
-    1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137,
-    1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148,
-    1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159,
-    1160, 1161, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169,
-    1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180,
-    1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191,
-    1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202,
-    1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213,
-    1214, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
-    1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234,
-    1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245,
-    1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256,
-    1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1266,
-    1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277,
-    1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288,
-    1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299,
-    1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310,
-    1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1319, 1320,
-    1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331,
-    1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342,
-    1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353,
-    1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364,
-    1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1372, 1373, 1374,
-    1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385,
-    1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396,
-    1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407,
-    1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418,
-    1419, 1420, 1421, 1422, 1423, 1424, 1425, 1425, 1426, 1427, 1428,
-    1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439,
-    1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450,
-    1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461,
-    1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472,
-    1473, 1474, 1475, 1476, 1477, 1478, 1478, 1479, 1480, 1481, 1482,
-    1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493,
-    1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504,
-    1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515,
-    1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526,
-    1527, 1528, 1529, 1530, 1531, 1531, 1532, 1533, 1534, 1535, 1536,
-    1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547,
-    1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558,
-    1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569,
-    1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580,
-    1581, 1582, 1583, 1584, 1584, 1585, 1586, 1587, 1588, 1589, 1590,
-    1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601,
-    1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612,
-    1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623,
-    1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634,
-    1635, 1636, 1637, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644,
-    1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655,
-    1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666,
-    1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677,
-    1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688,
-    1689, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698,
-    1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709,
-    1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720,
-    1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731,
-    1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742,
-    1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752,
-    1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763,
-    1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774,
-    1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785,
-    1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1795,
-    1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806,
-    1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817,
-    1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828,
-    1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839,
-    1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1848, 1849,
-    1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860,
-    1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871,
-    1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882,
-    1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893,
-    1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1901, 1902, 1903,
-    1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914,
-    1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925,
-    1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936,
-    1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947,
-    1948, 1949, 1950, 1951, 1952, 1953, 1954, 1954, 1955, 1956, 1957,
-    1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968,
-    1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979,
-    1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990,
-    1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001,
-    2002, 2003, 2004, 2005, 2006, 2007, 2007, 2008, 2009, 2010, 2011,
-    2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022,
-    2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033,
-    2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044,
-    2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055,
-    2056, 2057, 2058, 2059, 2060, 2060, 2061, 2062, 2063, 2064, 2065,
-    2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076,
-    2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087,
-    2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098,
-    2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109,
-    2110, 2111, 2112, 2113, 2113, 2114, 2115, 2116, 2117, 2118, 2119,
-    2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130,
-    2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141,
-    2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152,
-    2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163,
-    2164, 2165, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173,
-    2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184,
-    2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195,
-    2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205, 2206,
-    2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217,
-    2218, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225, 2226, 2227,
-    2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238,
-    2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249,
-    2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260,
-    2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271,
-    2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281,
-    2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292,
-    2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300, 2301, 2302, 2303,
-    2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314,
-    2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2324, 2324,
-    2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335,
-    2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346,
-    2347, 2348, 2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357,
-    2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367, 2368,
-    2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2377, 2378,
-    2379, 2380, 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389,
-    2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397, 2398, 2399, 2400,
-    2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411,
-    2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422,
-    2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 2430, 2431, 2432,
-    2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443,
-    2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454,
-    2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465,
-    2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 2474, 2475, 2476,
-    2477, 2478, 2479, 2480, 2481, 2482, 2483, 2483, 2484, 2485, 2486,
-    2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497,
-    2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508,
-    2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519,
-    2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530,
-    2531, 2532, 2533, 2534, 2535, 2536, 2536, 2537, 2538, 2539, 2540,
-    2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551,
-    2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562,
-    2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573,
-    2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584,
-    2585, 2586, 2587, 2588, 2588, 2589, 2590, 2591, 2592, 2593, 2594,
-    2595, 2596, 2597, 2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605,
-    2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616,
-    2617, 2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625, 2626, 2627,
-    2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638,
-    2639, 2640, 2641, 2641, 2642, 2643, 2644, 2645, 2646, 2647, 2648,
-    2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659,
-    2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670,
-    2671, 2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681,
-    2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692,
-    2693, 2694, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702,
-    2703, 2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713,
-    2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721, 2722, 2723, 2724,
-    2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733, 2734, 2735,
-    2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746,
-    2747, 2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755, 2756,
-    2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765, 2766, 2767,
-    2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778,
-    2779, 2780, 2781, 2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789,
-    2790, 2791, 2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800,
-    2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810,
-    2811, 2812, 2813, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821,
-    2822, 2823, 2824, 2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832,
-    2833, 2834, 2835, 2836, 2837, 2838, 2839, 2840, 2841, 2842, 2843,
-    2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 2853,
-    2854, 2855, 2856, 2857, 2858, 2859, 2860, 2861, 2862, 2863, 2864,
-    2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2874, 2875,
-    2876, 2877, 2878, 2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886,
-    2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895, 2896, 2897,
-    2898, 2899, 2900, 2901, 2902, 2903, 2904, 2905, 2906, 2906, 2907,
-    2908, 2909, 2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917, 2918,
-    2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926, 2927, 2928, 2929,
-    2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940,
-    2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948, 2949, 2950, 2951,
-    2952, 2953, 2954, 2955, 2956, 2957, 2958, 2959, 2959, 2960, 2961,
-    2962, 2963, 2964, 2965, 2966, 2967, 2968, 2969, 2970, 2971, 2972,
-    2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983,
-    2984, 2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994,
-    2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004, 3005,
-    3006, 3007, 3008, 3009, 3010, 3011, 3011, 3012, 3013, 3014, 3015,
-    3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026,
-    3027, 3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036, 3037,
-    3038, 3039, 3040, 3041, 3042, 3043, 3044, 3045, 3046, 3047, 3048,
-    3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058, 3059,
-    3060, 3061, 3062, 3063, 3064, 3064, 3065, 3066, 3067, 3068, 3069,
-    3070, 3071, 3072, 3073, 3074, 3075, 3076, 3077, 3078, 3079, 3080,
-    3081, 3082, 3083, 3084, 3085, 3086, 3087, 3088, 3089, 3090, 3091,
-    3092, 3093, 3094, 3095, 3096, 3097, 3098, 3099, 3100, 3101, 3102,
-    3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112, 3113,
-    3114, 3115, 3116, 3117, 3117, 3118, 3119, 3120, 3121, 3122, 3123,
-    3124, 3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 3133, 3134,
-    3135, 3136, 3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145,
-    3146, 3147, 3148, 3149, 3150, 3151, 3152, 3153, 3154, 3155, 3156,
-    3157, 3158, 3159, 3160, 3161, 3162, 3163, 3164, 3165, 3166, 3167,
-    3168, 3169, 3170, 3170, 3171, 3172, 3173, 3174, 3175, 3176, 3177,
-    3178, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186, 3187, 3188,
-    3189, 3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199,
-    3200, 3201, 3202, 3203, 3204, 3205, 3206, 3207, 3208, 3209, 3210,
-    3211, 3212, 3213, 3214, 3215, 3216, 3217, 3218, 3219, 3220, 3221,
-    3222, 3223, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231,
-    3232, 3233, 3234, 3235, 3236, 3237, 3238, 3239, 3240, 3241, 3242,
-    3243, 3244, 3245, 3246, 3247, 3248, 3249, 3250, 3251, 3252, 3253,
-    3254, 3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263, 3264,
-    3265, 3266, 3267, 3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275,
-    3276, 3276, 3277, 3278, 3279, 3280, 3281, 3282, 3283, 3284, 3285,
-    3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 3294, 3295, 3296,
-    3297, 3298, 3299, 3300, 3301, 3302, 3303, 3304, 3305, 3306, 3307,
-    3308, 3309, 3310, 3311, 3312, 3313, 3314, 3315, 3316, 3317, 3318,
-    3319, 3320, 3321, 3322, 3323, 3324, 3325, 3326, 3327, 3328, 3329,
-    3329, 3330, 3331, 3332, 3333, 3334, 3335, 3336, 3337, 3338, 3339,
-    3340, 3341, 3342, 3343, 3344, 3345, 3346, 3347, 3348, 3349, 3350,
-    3351, 3352, 3353, 3354, 3355, 3356, 3357, 3358, 3359, 3360, 3361,
-    3362, 3363, 3364, 3365, 3366, 3367, 3368, 3369, 3370, 3371, 3372,
-    3373, 3374, 3375, 3376, 3377, 3378, 3379, 3380, 3381, 3382, 3382,
-    3383, 3384, 3385, 3386, 3387, 3388, 3389, 3390, 3391, 3392, 3393,
-    3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404,
-    3405, 3406, 3407, 3408, 3409, 3410, 3411, 3412, 3413, 3414, 3415,
-    3416, 3417, 3418, 3419, 3420, 3421, 3422, 3423, 3424, 3425, 3426,
-    3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3435, 3436,
-    3437, 3438, 3439, 3440, 3441, 3442, 3443, 3444, 3445, 3446, 3447,
-    3448, 3449, 3450, 3451, 3452, 3453, 3454, 3455, 3456, 3457, 3458,
-    3459, 3460, 3461, 3462, 3463, 3464, 3465, 3466, 3467, 3468, 3469,
-    3470, 3471, 3472, 3473, 3474, 3475, 3476, 3477, 3478, 3479, 3480,
-    3481, 3482, 3483, 3484, 3485, 3486, 3487, 3487, 3488, 3489, 3490,
-    3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498, 3499, 3500, 3501,
-    3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512,
-    3513, 3514, 3515, 3516, 3517, 3518, 3519, 3520, 3521, 3522, 3523,
-    3524, 3525, 3526, 3527, 3528, 3529, 3530, 3531, 3532, 3533, 3534,
-    3535, 3536, 3537, 3538, 3539, 3540, 3540, 3541, 3542, 3543, 3544,
-    3545, 3546, 3547, 3548, 3549, 3550, 3551, 3552, 3553, 3554, 3555,
-    3556, 3557, 3558, 3559, 3560, 3561, 3562, 3563, 3564, 3565, 3566,
-    3567, 3568, 3569, 3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577,
-    3578, 3579, 3580, 3581, 3582, 3583, 3584, 3585, 3586, 3587, 3588,
-    3589, 3590, 3591, 3592, 3593, 3593, 3594, 3595, 3596, 3597, 3598,
-    3599, 3600, 3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609,
-    3610, 3611, 3612, 3613, 3614, 3615, 3616, 3617, 3618, 3619, 3620,
-    3621, 3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631,
-    3632, 3633, 3634, 3635, 3636, 3637, 3638, 3639, 3640, 3641, 3642,
-    3643, 3644, 3645, 3646, 3646, 3647, 3648, 3649, 3650, 3651, 3652,
-    3653, 3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663,
-    3664, 3665, 3666, 3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674,
-    3675, 3676, 3677, 3678, 3679, 3680, 3681, 3682, 3683, 3684, 3685,
-    3686, 3687, 3688, 3689, 3690, 3691, 3692, 3693, 3694, 3695, 3696,
-    3697, 3698, 3699, 3699, 3700, 3701, 3702, 3703, 3704, 3705, 3706,
-    3707, 3708, 3709, 3710, 3711, 3712, 3713, 3714, 3715, 3716, 3717,
-    3718, 3719, 3720, 3721, 3722, 3723, 3724, 3725, 3726, 3727, 3728,
-    3729, 3730, 3731, 3732, 3733, 3734, 3735, 3736, 3737, 3738, 3739,
-    3740, 3741, 3742, 3743, 3744, 3745, 3746, 3747, 3748, 3749, 3750,
-    3751, 3752, 3752, 3753, 3754, 3755, 3756, 3757, 3758, 3759, 3760,
-    3761, 3762, 3763, 3764, 3765, 3766, 3767, 3768, 3769, 3770, 3771,
-    3772, 3773, 3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781, 3782,
-    3783, 3784, 3785, 3786, 3787, 3788, 3789, 3790, 3791, 3792, 3793,
-    3794, 3795, 3796, 3797, 3798, 3799, 3800, 3801, 3802, 3803, 3804,
-    3805, 3805, 3806, 3807, 3808, 3809, 3810, 3811, 3812, 3813, 3814,
-    3815, 3816, 3817, 3818, 3819, 3820, 3821, 3822, 3823, 3824, 3825,
-    3826, 3827, 3828, 3829, 3830, 3831, 3832, 3833, 3834, 3835, 3836,
-    3837, 3838, 3839, 3840, 3841, 3842, 3843, 3844, 3845, 3846, 3847,
-    3848, 3849, 3850, 3851, 3852, 3853, 3854, 3855, 3856, 3857, 3858,
-    3858, 3859, 3860, 3861, 3862, 3863, 3864, 3865, 3866, 3867, 3868,
-    3869, 3870, 3871, 3872, 3873, 3874, 3875, 3876, 3877, 3878, 3879,
-    3880, 3881, 3882, 3883, 3884, 3885, 3886, 3887, 3888, 3889, 3890,
-    3891, 3892, 3893, 3894, 3895, 3896, 3897, 3898, 3899, 3900, 3901,
-    3902, 3903, 3904, 3905, 3906, 3907, 3908, 3909, 3910, 3910, 3911,
-    3912, 3913, 3914, 3915, 3916, 3917, 3918, 3919, 3920, 3921, 3922,
-    3923, 3924, 3925, 3926, 3927, 3928, 3929, 3930, 3931, 3932, 3933,
-    3934, 3935, 3936, 3937, 3938, 3939, 3940, 3941, 3942, 3943, 3944,
-    3945, 3946, 3947, 3948, 3949, 3950, 3951, 3952, 3953, 3954, 3955,
-    3956, 3957, 3958, 3959, 3960, 3961, 3962, 3963, 3963, 3964, 3965,
-    3966, 3967, 3968, 3969, 3970, 3971, 3972, 3973, 3974, 3975, 3976,
-    3977, 3978, 3979, 3980, 3981, 3982, 3983, 3984, 3985, 3986, 3987,
-    3988, 3989, 3990, 3991, 3992, 3993, 3994, 3995, 3996, 3997, 3998,
-    3999, 4000, 4001, 4002, 4003, 4004, 4005, 4006, 4007, 4008, 4009,
-    4010, 4011, 4012, 4013, 4014, 4015, 4016, 4016, 4017, 4018, 4019,
-    4020, 4021, 4022, 4023, 4024, 4025, 4026, 4027, 4028, 4029, 4030,
-    4031, 4032, 4033, 4034, 4035, 4036, 4037, 4038, 4039, 4040, 4041,
-    4042, 4043, 4044, 4045, 4046, 4047, 4048, 4049, 4050, 4051, 4052,
-    4053, 4054, 4055, 4056, 4057, 4058, 4059, 4060, 4061, 4062, 4063,
-    4064, 4065, 4066, 4067, 4068, 4069, 4069, 4070, 4071, 4072, 4073,
-    4074, 4075, 4076, 4077, 4078, 4079, 4080, 4081, 4082, 4083, 4084,
-    4085, 4086, 4087, 4088, 4089, 4090, 4091, 4092, 4093, 4094, 4095,
-    4096, 4097, 4098, 4099, 4100, 4101, 4102, 4103, 4104, 4105, 4106,
-    4107, 4108, 4109, 4110, 4111, 4112, 4113, 4114, 4115, 4116, 4117,
-    4118, 4119, 4120, 4121, 4122, 4122, 4123, 4124, 4125, 4126, 4127,
-    4128, 4129, 4130, 4131, 4132, 4133, 4134, 4135, 4136, 4137, 4138,
-    4139, 4140, 4141, 4142, 4143, 4144, 4145, 4146, 4147, 4148, 4149,
-    4150, 4151, 4152, 4153, 4154, 4155, 4156, 4157, 4158, 4159, 4160,
-    4161, 4162, 4163, 4164, 4165, 4166, 4167, 4168, 4169, 4170, 4171,
-    4172, 4173, 4174, 4175, 4175, 4176, 4177, 4178, 4179, 4180, 4181,
-    4182, 4183, 4184, 4185, 4186, 4187, 4188, 4189, 4190, 4191, 4192,
-    4193, 4194, 4195, 4196, 4197, 4198, 4199, 4200, 4201, 4202, 4203,
-    4204, 4205, 4206, 4207, 4208, 4209, 4210, 4211, 4212, 4213, 4214,
-    4215, 4216, 4217, 4218, 4219, 4220, 4221, 4222, 4223, 4224, 4225,
-    4226, 4227, 4228, 4228, 4229, 4230, 4231, 4232, 4233, 4234, 4235,
-    4236, 4237, 4238, 4239, 4240, 4241, 4242, 4243, 4244, 4245, 4246,
-    4247, 4248, 4249, 4250, 4251, 4252, 4253, 4254, 4255, 4256, 4257,
-    4258, 4259, 4260, 4261, 4262, 4263, 4264, 4265, 4266, 4267, 4268,
-    4269, 4270, 4271, 4272, 4273, 4274, 4275, 4276, 4277, 4278, 4279,
-    4280, 4281, 4281, 4282, 4283, 4284, 4285, 4286, 4287, 4288, 4289,
-    4290, 4291, 4292, 4293, 4294, 4295, 4296, 4297, 4298, 4299, 4300,
-    4301, 4302, 4303, 4304, 4305, 4306, 4307, 4308, 4309, 4310, 4311,
-    4312, 4313, 4314, 4315, 4316, 4317, 4318, 4319, 4320, 4321, 4322,
-    4323, 4324, 4325, 4326, 4327, 4328, 4329, 4330, 4331, 4332, 4333,
-    4333, 4334, 4335, 4336, 4337, 4338, 4339, 4340, 4341, 4342, 4343,
-    4344, 4345, 4346, 4347, 4348, 4349, 4350, 4351, 4352, 4353, 4354,
-    4355, 4356, 4357, 4358, 4359, 4360, 4361, 4362, 4363, 4364, 4365,
-    4366, 4367, 4368, 4369, 4370, 4371, 4372, 4373, 4374, 4375, 4376,
-    4377, 4378, 4379, 4380, 4381, 4382, 4383, 4384, 4385, 4386, 4386,
-    4387, 4388, 4389, 4390, 4391, 4392, 4393, 4394, 4395, 4396, 4397,
-    4398, 4399, 4400, 4401, 4402, 4403, 4404, 4405, 4406, 4407, 4408,
-    4409, 4410, 4411, 4412, 4413, 4414, 4415, 4416, 4417, 4418, 4419,
-    4420, 4421, 4422, 4423, 4424, 4425, 4426, 4427, 4428, 4429, 4430,
-    4431, 4432, 4433, 4434, 4435, 4436, 4437, 4438, 4439, 4439, 4440,
-    4441, 4442, 4443, 4444, 4445, 4446, 4447, 4448, 4449, 4450, 4451,
-    4452, 4453, 4454, 4455, 4456, 4457, 4458, 4459, 4460, 4461, 4462,
-    4463, 4464, 4465, 4466, 4467, 4468, 4469, 4470, 4471, 4472, 4473,
-    4474, 4475, 4476, 4477, 4478, 4479, 4480, 4481, 4482, 4483, 4484,
-    4485, 4486, 4487, 4488, 4489, 4490, 4491, 4492, 4492, 4493, 4494,
-    4495, 4496, 4497, 4498, 4499, 4500, 4501, 4502, 4503, 4504, 4505,
-    4506, 4507, 4508, 4509, 4510, 4511, 4512, 4513, 4514, 4515, 4516,
-    4517, 4518, 4519, 4520, 4521, 4522, 4523, 4524, 4525, 4526, 4527,
-    4528, 4529, 4530, 4531, 4532, 4533, 4534, 4535, 4536, 4537, 4538,
-    4539, 4540, 4541, 4542, 4543, 4544, 4545, 4545, 4546, 4547, 4548,
-    4549, 4550, 4551, 4552, 4553, 4554, 4555, 4556, 4557, 4558, 4559,
-    4560, 4561, 4562, 4563, 4564, 4565, 4566, 4567, 4568, 4569, 4570,
-    4571, 4572, 4573, 4574, 4575, 4576, 4577, 4578, 4579, 4580, 4581,
-    4582, 4583, 4584, 4585, 4586, 4587, 4588, 4589, 4590, 4591, 4592,
-    4593, 4594, 4595, 4596, 4597, 4598, 4598, 4599, 4600, 4601, 4602,
-    4603, 4604, 4605, 4606, 4607, 4608, 4609, 4610, 4611, 4612, 4613,
-    4614, 4615, 4616, 4617, 4618, 4619, 4620, 4621, 4622, 4623, 4624,
-    4625, 4626, 4627, 4628, 4629, 4630, 4631, 4632, 4633, 4634, 4635,
-    4636, 4637, 4638, 4639, 4640, 4641, 4642, 4643, 4644, 4645, 4646,
-    4647, 4648, 4649, 4650, 4651, 4651, 4652, 4653, 4654, 4655, 4656,
-    4657, 4658, 4659, 4660, 4661, 4662, 4663, 4664, 4665, 4666, 4667,
-    4668, 4669, 4670, 4671, 4672, 4673, 4674, 4675, 4676, 4677, 4678,
-    4679, 4680, 4681, 4682, 4683, 4684, 4685, 4686, 4687, 4688, 4689,
-    4690, 4691, 4692, 4693, 4694, 4695, 4696, 4697, 4698, 4699, 4700,
-    4701, 4702, 4703, 4704, 4704, 4705, 4706, 4707, 4708, 4709, 4710,
-    4711, 4712, 4713, 4714, 4715, 4716, 4717, 4718, 4719, 4720, 4721,
-    4722, 4723, 4724, 4725, 4726, 4727, 4728, 4729, 4730, 4731, 4732,
-    4733, 4734, 4735, 4736, 4737, 4738, 4739, 4740, 4741, 4742, 4743,
-    4744, 4745, 4746, 4747, 4748, 4749, 4750, 4751, 4752, 4753, 4754,
-    4755, 4756, 4756, 4757, 4758, 4759, 4760, 4761, 4762, 4763, 4764,
-    4765, 4766, 4767, 4768, 4769, 4770, 4771, 4772, 4773, 4774, 4775,
-    4776, 4777, 4778, 4779, 4780, 4781, 4782, 4783, 4784, 4785, 4786,
-    4787, 4788, 4789, 4790, 4791, 4792, 4793, 4794, 4795, 4796, 4797,
-    4798, 4799, 4800, 4801, 4802, 4803, 4804, 4805, 4806, 4807, 4808,
-    4809, 4809, 4810, 4811, 4812, 4813, 4814, 4815, 4816, 4817, 4818,
-    4819, 4820, 4821, 4822, 4823, 4824, 4825, 4826, 4827, 4828, 4829,
-    4830, 4831, 4832, 4833, 4834, 4835, 4836, 4837, 4838, 4839, 4840,
-    4841, 4842, 4843, 4844, 4845, 4846, 4847, 4848, 4849, 4850, 4851,
-    4852, 4853, 4854, 4855, 4856, 4857, 4858, 4859, 4860, 4861, 4862,
-    4862, 4863, 4864, 4865, 4866, 4867, 4868, 4869, 4870, 4871, 4872,
-    4873, 4874, 4875, 4876, 4877, 4878, 4879, 4880, 4881, 4882, 4883,
-    4884, 4885, 4886, 4887, 4888, 4889, 4890, 4891, 4892, 4893, 4894,
-    4895, 4896, 4897, 4898, 4899, 4900, 4901, 4902, 4903, 4904, 4905,
-    4906, 4907, 4908, 4909, 4910, 4911, 4912, 4913, 4914, 4915, 4915,
-    4916, 4917, 4918, 4919, 4920, 4921, 4922, 4923, 4924, 4925, 4926,
-    4927, 4928, 4929, 4930, 4931, 4932, 4933, 4934, 4935, 4936, 4937,
-    4938, 4939, 4940, 4941, 4942, 4943, 4944, 4945, 4946, 4947, 4948,
-    4949, 4950, 4951, 4952, 4953, 4954, 4955, 4956, 4957, 4958, 4959,
-    4960, 4961, 4962, 4963, 4964, 4965, 4966, 4967, 4968, 4968, 4969,
-    4970, 4971, 4972, 4973, 4974, 4975, 4976, 4977, 4978, 4979, 4980,
-    4981, 4982, 4983, 4984, 4985, 4986, 4987, 4988, 4989, 4990, 4991,
-    4992, 4993, 4994, 4995, 4996, 4997, 4998, 4999, 5000, 5001, 5002,
-    5003, 5004, 5005, 5006, 5007, 5008, 5009, 5010, 5011, 5012, 5013,
-    5014, 5015, 5016, 5017, 5018, 5019, 5020, 5021, 5021, 5022, 5023,
-    5024, 5025, 5026, 5027, 5028, 5029, 5030, 5031, 5032, 5033, 5034,
-    5035, 5036, 5037, 5038, 5039, 5040, 5041, 5042, 5043, 5044, 5045,
-    5046, 5047, 5048, 5049, 5050, 5051, 5052, 5053, 5054, 5055, 5056,
-    5057, 5058, 5059, 5060, 5061, 5062, 5063, 5064, 5065, 5066, 5067,
-    5068, 5069, 5070, 5071, 5072, 5073, 5074, 5074, 5075, 5076, 5077,
-    5078, 5079, 5080, 5081, 5082, 5083, 5084, 5085, 5086, 5087, 5088,
-    5089, 5090, 5091, 5092, 5093, 5094, 5095, 5096, 5097, 5098, 5099,
-    5100, 5101, 5102, 5103, 5104, 5105, 5106, 5107, 5108, 5109, 5110,
-    5111, 5112, 5113, 5114, 5115, 5116, 5117, 5118, 5119, 5120, 5121,
-    5122, 5123, 5124, 5125, 5126, 5127, 5127, 5128, 5129, 5130, 5131,
-    5132, 5133, 5134, 5135, 5136, 5137, 5138, 5139, 5140, 5141, 5142,
-    5143, 5144, 5145, 5146, 5147, 5148, 5149, 5150, 5151, 5152, 5153,
-    5154, 5155, 5156, 5157, 5158, 5159, 5160, 5161, 5162, 5163, 5164,
-    5165, 5166, 5167, 5168, 5169, 5170, 5171, 5172, 5173, 5174, 5175,
-    5176, 5177, 5178, 5179, 5180, 5180, 5181, 5182, 5183, 5184, 5185,
-    5186, 5187, 5188, 5189, 5190, 5191, 5192, 5193, 5194, 5195, 5196,
-    5197, 5198, 5199, 5200, 5201, 5202, 5203, 5204, 5205, 5206, 5207,
-    5208, 5209, 5210, 5211, 5212, 5213, 5214, 5215, 5216, 5217, 5218,
-    5219, 5220, 5221, 5222, 5223, 5224, 5225, 5226, 5227, 5228, 5229,
-    5230, 5231, 5232, 5232, 5233, 5234, 5235, 5236, 5237, 5238, 5239,
-    5240, 5241, 5242, 5243, 5244, 5245, 5246, 5247, 5248, 5249, 5250,
-    5251, 5252, 5253, 5254, 5255, 5256, 5257, 5258, 5259, 5260, 5261,
-    5262, 5263, 5264, 5265, 5266, 5267, 5268, 5269, 5270, 5271, 5272,
-    5273, 5274, 5275, 5276, 5277, 5278, 5279, 5280, 5281, 5282, 5283,
-    5284, 5285, 5285, 5286, 5287, 5288, 5289, 5290, 5291, 5292, 5293,
-    5294, 5295, 5296, 5297, 5298, 5299, 5300, 5301, 5302, 5303, 5304,
-    5305, 5306, 5307, 5308, 5309, 5310, 5311, 5312, 5313, 5314, 5315,
-    5316, 5317, 5318, 5319, 5320, 5321, 5322, 5323, 5324, 5325, 5326,
-    5327, 5328, 5329, 5330, 5331, 5332, 5333, 5334, 5335, 5336, 5337,
-    5338, 5338, 5339, 5340, 5341, 5342, 5343, 5344, 5345, 5346, 5347,
-    5348, 5349, 5350, 5351, 5352, 5353, 5354, 5355, 5356, 5357, 5358,
-    5359, 5360, 5361, 5362, 5363, 5364, 5365, 5366, 5367, 5368, 5369,
-    5370, 5371, 5372, 5373, 5374, 5375, 5376, 5377, 5378, 5379, 5380,
-    5381, 5382, 5383, 5384, 5385, 5386, 5387, 5388, 5389, 5390, 5391,
-    5391, 5392, 5393, 5394, 5395, 5396, 5397, 5398, 5399, 5400, 5401,
-    5402, 5403, 5404, 5405, 5406, 5407, 5408, 5409, 5410, 5411, 5412,
-    5413, 5414, 5415, 5416, 5417, 5418, 5419, 5420, 5421, 5422, 5423,
-    5424, 5425, 5426, 5427, 5428, 5429, 5430, 5431, 5432, 5433, 5434,
-    5435, 5436, 5437, 5438, 5439, 5440, 5441, 5442, 5443, 5444, 5444,
-    5445, 5446, 5447, 5448, 5449, 5450, 5451, 5452, 5453, 5454, 5455,
-    5456, 5457, 5458, 5459, 5460, 5461, 5462, 5463, 5464, 5465, 5466,
-    5467, 5468, 5469, 5470, 5471, 5472, 5473, 5474, 5475, 5476, 5477,
-    5478, 5479, 5480, 5481, 5482, 5483, 5484, 5485, 5486, 5487, 5488,
-    5489, 5490, 5491, 5492, 5493, 5494, 5495, 5496, 5497, 5497, 5498,
-    5499, 5500, 5501, 5502, 5503, 5504, 5505, 5506, 5507, 5508, 5509,
-    5510, 5511, 5512, 5513, 5514, 5515, 5516, 5517, 5518, 5519, 5520,
-    5521, 5522, 5523, 5524, 5525, 5526, 5527, 5528, 5529, 5530, 5531,
-    5532, 5533, 5534, 5535, 5536, 5537, 5538, 5539, 5540, 5541, 5542,
-    5543, 5544, 5545, 5546, 5547, 5548, 5549, 5550, 5550, 5551, 5552,
-    5553, 5554, 5555, 5556, 5557, 5558, 5559, 5560, 5561, 5562, 5563,
-    5564, 5565, 5566, 5567, 5568, 5569, 5570, 5571, 5572, 5573, 5574,
-    5575, 5576, 5577, 5578, 5579, 5580, 5581, 5582, 5583, 5584, 5585,
-    5586, 5587, 5588, 5589, 5590, 5591, 5592, 5593, 5594, 5595, 5596,
-    5597, 5598, 5599, 5600, 5601, 5602, 5603, 5603, 5604, 5605, 5606,
-    5607, 5608, 5609, 5610, 5611, 5612, 5613, 5614, 5615, 5616, 5617,
-    5618, 5619, 5620, 5621, 5622, 5623, 5624, 5625, 5626, 5627, 5628,
-    5629, 5630, 5631, 5632, 5633, 5634, 5635, 5636, 5637, 5638, 5639,
-    5640, 5641, 5642, 5643, 5644, 5645, 5646, 5647, 5648, 5649, 5650,
-    5651, 5652, 5653, 5654, 5655, 5655, 5656, 5657, 5658, 5659, 5660,
-    5661, 5662, 5663, 5664, 5665, 5666, 5667, 5668, 5669, 5670, 5671,
-    5672, 5673, 5674, 5675, 5676, 5677, 5678, 5679, 5680, 5681, 5682,
-    5683, 5684, 5685, 5686, 5687, 5688, 5689, 5690, 5691, 5692, 5693,
-    5694, 5695, 5696, 5697, 5698, 5699, 5700, 5701, 5702, 5703, 5704,
-    5705, 5706, 5707, 5708, 5708, 5709, 5710, 5711, 5712, 5713, 5714,
-    5715, 5716, 5717, 5718, 5719, 5720, 5721, 5722, 5723, 5724, 5725,
-    5726, 5727, 5728, 5729, 5730, 5731, 5732, 5733, 5734, 5735, 5736,
-    5737, 5738, 5739, 5740, 5741, 5742, 5743, 5744, 5745, 5746, 5747,
-    5748, 5749, 5750, 5751, 5752, 5753, 5754, 5755, 5756, 5757, 5758,
-    5759, 5760, 5761, 5761, 5762, 5763, 5764, 5765, 5766, 5767, 5768,
-    5769, 5770, 5771, 5772, 5773, 5774, 5775, 5776, 5777, 5778, 5779,
-    5780, 5781, 5782, 5783, 5784, 5785, 5786, 5787, 5788, 5789, 5790,
-    5791, 5792, 5793, 5794, 5795, 5796, 5797, 5798, 5799, 5800, 5801,
-    5802, 5803, 5804, 5805, 5806, 5807, 5808, 5809, 5810, 5811, 5812,
-    5813, 5814, 5814, 5815, 5816, 5817, 5818, 5819, 5820, 5821, 5822,
-    5823, 5824, 5825, 5826, 5827, 5828, 5829, 5830, 5831, 5832, 5833,
-    5834, 5835, 5836, 5837, 5838, 5839, 5840, 5841, 5842, 5843, 5844,
-    5845, 5846, 5847, 5848, 5849, 5850, 5851, 5852, 5853, 5854, 5855,
-    5856, 5857, 5858, 5859, 5860, 5861, 5862, 5863, 5864, 5865, 5866,
-    5867, 5867, 5868, 5869, 5870, 5871, 5872, 5873, 5874, 5875, 5876,
-    5877, 5878, 5879, 5880, 5881, 5882, 5883, 5884, 5885, 5886, 5887,
-    5888, 5889, 5890, 5891, 5892, 5893, 5894, 5895, 5896, 5897, 5898,
-    5899, 5900, 5901, 5902, 5903, 5904, 5905, 5906, 5907, 5908, 5909,
-    5910, 5911, 5912, 5913, 5914, 5915, 5916, 5917, 5918, 5919, 5920,
-    5920, 5921, 5922, 5923, 5924, 5925, 5926, 5927, 5928, 5929, 5930,
-    5931, 5932, 5933, 5934, 5935, 5936, 5937, 5938, 5939, 5940, 5941,
-    5942, 5943, 5944, 5945, 5946, 5947, 5948, 5949, 5950, 5951, 5952,
-    5953, 5954, 5955, 5956, 5957, 5958, 5959, 5960, 5961, 5962, 5963,
-    5964, 5965, 5966, 5967, 5968, 5969, 5970, 5971, 5972, 5973, 5973,
-    5974, 5975, 5976, 5977, 5978, 5979, 5980, 5981, 5982, 5983, 5984,
-    5985, 5986, 5987, 5988, 5989, 5990, 5991, 5992, 5993, 5994, 5995,
-    5996, 5997, 5998, 5999, 6000, 6001, 6002, 6003, 6004, 6005, 6006,
-    6007, 6008, 6009, 6010, 6011, 6012, 6013, 6014, 6015, 6016, 6017,
-    6018, 6019, 6020, 6021, 6022, 6023, 6024, 6025, 6026, 6026, 6027,
-    6028, 6029, 6030, 6031, 6032, 6033, 6034, 6035, 6036, 6037, 6038,
-    6039, 6040, 6041, 6042, 6043, 6044, 6045, 6046, 6047, 6048, 6049,
-    6050, 6051, 6052, 6053, 6054, 6055, 6056, 6057, 6058, 6059, 6060,
-    6061, 6062, 6063, 6064, 6065, 6066, 6067, 6068, 6069, 6070, 6071,
-    6072, 6073, 6074, 6075, 6076, 6077, 6078, 6078, 6079, 6080, 6081,
-    6082, 6083, 6084, 6085, 6086, 6087, 6088, 6089, 6090, 6091, 6092,
-    6093, 6094, 6095, 6096, 6097, 6098, 6099, 6100, 6101, 6102, 6103,
-    6104, 6105, 6106, 6107, 6108, 6109, 6110, 6111, 6112, 6113, 6114,
-    6115, 6116, 6117, 6118, 6119, 6120, 6121, 6122, 6123, 6124, 6125,
-    6126, 6127, 6128, 6129, 6130, 6131, 6131, 6132, 6133, 6134, 6135,
-    6136, 6137, 6138, 6139, 6140, 6141, 6142, 6143, 6144, 6145, 6146,
-    6147, 6148, 6149, 6150, 6151, 6152, 6153, 6154, 6155, 6156, 6157,
-    6158, 6159, 6160, 6161, 6162, 6163, 6164, 6165, 6166, 6167, 6168,
-    6169, 6170, 6171, 6172, 6173, 6174, 6175, 6176, 6177, 6178, 6179,
-    6180, 6181, 6182, 6183, 6184, 6184, 6185, 6186, 6187, 6188, 6189,
-    6190, 6191, 6192, 6193, 6194, 6195, 6196, 6197, 6198, 6199, 6200,
-    6201, 6202, 6203, 6204, 6205, 6206, 6207, 6208, 6209, 6210, 6211,
-    6212, 6213, 6214, 6215, 6216, 6217, 6218, 6219, 6220, 6221, 6222,
-    6223, 6224, 6225, 6226, 6227, 6228, 6229, 6230, 6231, 6232, 6233,
-    6234, 6235, 6236, 6237, 6237, 6238, 6239, 6240, 6241, 6242, 6243,
-    6244, 6245, 6246, 6247, 6248, 6249, 6250, 6251, 6252, 6253, 6254,
-    6255, 6256, 6257, 6258, 6259, 6260, 6261, 6262, 6263, 6264, 6265,
-    6266, 6267, 6268, 6269, 6270, 6271, 6272, 6273, 6274, 6275, 6276,
-    6277, 6278, 6279, 6280, 6281, 6282, 6283, 6284, 6285, 6286, 6287,
-    6288, 6289, 6290, 6290, 6291, 6292, 6293, 6294, 6295, 6296, 6297,
-    6298, 6299, 6300, 6301, 6302, 6303, 6304, 6305, 6306, 6307, 6308,
-    6309, 6310, 6311, 6312, 6313, 6314, 6315, 6316, 6317, 6318, 6319,
-    6320, 6321, 6322, 6323, 6324, 6325, 6326, 6327, 6328, 6329, 6330,
-    6331, 6332, 6333, 6334, 6335, 6336, 6337, 6338, 6339, 6340, 6341,
-    6342, 6343, 6343, 6344, 6345, 6346, 6347, 6348, 6349, 6350, 6351,
-    6352, 6353, 6354, 6355, 6356, 6357, 6358, 6359, 6360, 6361, 6362,
-    6363, 6364, 6365, 6366, 6367, 6368, 6369, 6370, 6371, 6372, 6373,
-    6374, 6375, 6376, 6377, 6378, 6379, 6380, 6381, 6382, 6383, 6384,
-    6385, 6386, 6387, 6388, 6389, 6390, 6391, 6392, 6393, 6394, 6395,
-    6396, 6396, 6397, 6398, 6399, 6400, 6401, 6402, 6403, 6404, 6405,
-    6406, 6407, 6408, 6409, 6410, 6411, 6412, 6413, 6414, 6415, 6416,
-    6417, 6418, 6419, 6420, 6421, 6422, 6423, 6424, 6425, 6426, 6427,
-    6428, 6429, 6430, 6431, 6432, 6433, 6434, 6435, 6436, 6437, 6438,
-    6439, 6440, 6441, 6442, 6443, 6444, 6445, 6446, 6447, 6448, 6449,
-    6449, 6450, 6451, 6452, 6453, 6454, 6455, 6456, 6457, 6458, 6459,
-    6460, 6461, 6462, 6463, 6464, 6465, 6466, 6467, 6468, 6469, 6470,
-    6471, 6472, 6473, 6474, 6475, 6476, 6477, 6478, 6479, 6480, 6481,
-    6482, 6483, 6484, 6485, 6486, 6487, 6488, 6489, 6490, 6491, 6492,
-    6493, 6494, 6495, 6496, 6497, 6498, 6499, 6500, 6501, 6502, 6502,
-    6503, 6504, 6505, 6506, 6507, 6508, 6509, 6510, 6511, 6512, 6513,
-    6514, 6515, 6516, 6517, 6518, 6519, 6520, 6521, 6522, 6523, 6524,
-    6525, 6526, 6527, 6528, 6529, 6530, 6531, 6532, 6533, 6534, 6535,
-    6536, 6537, 6538, 6539, 6540, 6541, 6542, 6543, 6544, 6545, 6546,
-    6547, 6548, 6549, 6550, 6551, 6552, 6553, 6554, 6554, 6555, 6556,
-    6557, 6558, 6559, 6560, 6561, 6562, 6563, 6564, 6565, 6566, 6567,
-    6568, 6569, 6570, 6571, 6572, 6573, 6574, 6575, 6576, 6577, 6578,
-    6579, 6580, 6581, 6582, 6583, 6584, 6585, 6586, 6587, 6588, 6589,
-    6590, 6591, 6592, 6593, 6594, 6595, 6596, 6597, 6598, 6599, 6600,
-    6601, 6602, 6603, 6604, 6605, 6606, 6607, 6607, 6608, 6609, 6610,
-    6611, 6612, 6613, 6614, 6615, 6616, 6617, 6618, 6619, 6620, 6621,
-    6622, 6623, 6624, 6625, 6626, 6627, 6628, 6629, 6630, 6631, 6632,
-    6633, 6634, 6635, 6636, 6637, 6638, 6639, 6640, 6641, 6642, 6643,
-    6644, 6645, 6646, 6647, 6648, 6649, 6650, 6651, 6652, 6653, 6654,
-    6655, 6656, 6657, 6658, 6659, 6660, 6660, 6661, 6662, 6663, 6664,
-    6665, 6666, 6667, 6668, 6669, 6670, 6671, 6672, 6673, 6674, 6675,
-    6676, 6677, 6678, 6679, 6680, 6681, 6682, 6683, 6684, 6685, 6686,
-    6687, 6688, 6689, 6690, 6691, 6692, 6693, 6694, 6695, 6696, 6697,
-    6698, 6699, 6700, 6701, 6702, 6703, 6704, 6705, 6706, 6707, 6708,
-    6709, 6710, 6711, 6712, 6713, 6713, 6714, 6715, 6716, 6717, 6718,
-    6719, 6720, 6721, 6722, 6723, 6724, 6725, 6726, 6727, 6728, 6729,
-    6730, 6731, 6732, 6733, 6734, 6735, 6736, 6737, 6738, 6739, 6740,
-    6741, 6742, 6743, 6744, 6745, 6746, 6747, 6748, 6749, 6750, 6751,
-    6752, 6753, 6754, 6755, 6756, 6757, 6758, 6759, 6760, 6761, 6762,
-    6763, 6764, 6765, 6766, 6766, 6767, 6768, 6769, 6770, 6771, 6772,
-    6773, 6774, 6775, 6776, 6777, 6778, 6779, 6780, 6781, 6782, 6783,
-    6784, 6785, 6786, 6787, 6788, 6789, 6790, 6791, 6792, 6793, 6794,
-    6795, 6796, 6797, 6798, 6799, 6800, 6801, 6802, 6803, 6804, 6805,
-    6806, 6807, 6808, 6809, 6810, 6811, 6812, 6813, 6814, 6815, 6816,
-    6817, 6818, 6819, 6819, 6820, 6821, 6822, 6823, 6824, 6825, 6826,
-    6827, 6828, 6829, 6830, 6831, 6832, 6833, 6834, 6835, 6836, 6837,
-    6838, 6839, 6840, 6841, 6842, 6843, 6844, 6845, 6846, 6847, 6848,
-    6849, 6850, 6851, 6852, 6853, 6854, 6855, 6856, 6857, 6858, 6859,
-    6860, 6861, 6862, 6863, 6864, 6865, 6866, 6867, 6868, 6869, 6870,
-    6871, 6872, 6872, 6873, 6874, 6875, 6876, 6877, 6878, 6879, 6880,
-    6881, 6882, 6883, 6884, 6885, 6886, 6887, 6888, 6889, 6890, 6891,
-    6892, 6893, 6894, 6895, 6896, 6897, 6898, 6899, 6900, 6901, 6902,
-    6903, 6904, 6905, 6906, 6907, 6908, 6909, 6910, 6911, 6912, 6913,
-    6914, 6915, 6916, 6917, 6918, 6919, 6920, 6921, 6922, 6923, 6924,
-    6925, 6925, 6926, 6927, 6928, 6929, 6930, 6931, 6932, 6933, 6934,
-    6935, 6936, 6937, 6938, 6939, 6940, 6941, 6942, 6943, 6944, 6945,
-    6946, 6947, 6948, 6949, 6950, 6951, 6952, 6953, 6954, 6955, 6956,
-    6957, 6958, 6959, 6960, 6961, 6962, 6963, 6964, 6965, 6966, 6967,
-    6968, 6969, 6970, 6971, 6972, 6973, 6974, 6975, 6976, 6977, 6977,
-    6978, 6979, 6980, 6981, 6982, 6983, 6984, 6985, 6986, 6987, 6988,
-    6989, 6990, 6991, 6992, 6993, 6994, 6995, 6996, 6997, 6998, 6999,
-    7000, 7001, 7002, 7003, 7004, 7005, 7006, 7007, 7008, 7009, 7010,
-    7011, 7012, 7013, 7014, 7015, 7016, 7017, 7018, 7019, 7020, 7021,
-    7022, 7023, 7024, 7025, 7026, 7027, 7028, 7029, 7030, 7030, 7031,
-    7032, 7033, 7034, 7035, 7036, 7037, 7038, 7039, 7040, 7041, 7042,
-    7043, 7044, 7045, 7046, 7047, 7048, 7049, 7050, 7051, 7052, 7053,
-    7054, 7055, 7056, 7057, 7058, 7059, 7060, 7061, 7062, 7063, 7064,
-    7065, 7066, 7067, 7068, 7069, 7070, 7071, 7072, 7073, 7074, 7075,
-    7076, 7077, 7078, 7079, 7080, 7081, 7082, 7082, 7083, 7084, 7085,
-    7086, 7087, 7088, 7089, 7090, 7091, 7092, 7093, 7094, 7095, 7096,
-    7097, 7098, 7099, 7100, 7101, 7102, 7103, 7104, 7105, 7106, 7107,
-    7108, 7109, 7110, 7111, 7112, 7113, 7114, 7115, 7116, 7117, 7118,
-    7119, 7120, 7121, 7122, 7123, 7124, 7125, 7126, 7127, 7128, 7129,
-    7130, 7131, 7132, 7133, 7134, 7135, 7135, 7136, 7137, 7138, 7139,
-    7140, 7141, 7142, 7143, 7144, 7145, 7146, 7147, 7148, 7149, 7150,
-    7151, 7152, 7153, 7154, 7155, 7156, 7157, 7158, 7159, 7160, 7161,
-    7162, 7163, 7164, 7165, 7166, 7167, 7168, 7169, 7170, 7171, 7172,
-    7173, 7174, 7175, 7176, 7177, 7178, 7179, 7180, 7181, 7182, 7183,
-    7184, 7185, 7186, 7187, 7188, 7189, 7189, 7190, 7191, 7192, 7193,
-    7194, 7195, 7196, 7197, 7198, 7199, 7200, 7201, 7202, 7203, 7204,
-    7205, 7206, 7207, 7208, 7209, 7210, 7211, 7212, 7213, 7214, 7215,
-    7216, 7217, 7218, 7219, 7220, 7221, 7222, 7223, 7224, 7225, 7226,
-    7227, 7228, 7229, 7230, 7231, 7232, 7233, 7234, 7235, 7236, 7237,
-    7238, 7239, 7240, 7241, 7242, 7243, 7244, 7245, 7246, 7247, 7247,
-    7248, 7249, 7250, 7251, 7252, 7253, 7254, 7255, 7256, 7257, 7258,
-    7259, 7260, 7261, 7262, 7263, 7264, 7265, 7266, 7267, 7268, 7269,
-    7270, 7271, 7272, 7273, 7274, 7275, 7276, 7277, 7278, 7279, 7280,
-    7281, 7282, 7283, 7284, 7285, 7286, 7287, 7288, 7289, 7290, 7291,
-    7292, 7293, 7294, 7295, 7296, 7297, 7298, 7299, 7300, 7301, 7302,
-    7303, 7304, 7305, 7306, 7307, 7308, 7309, 7310, 7311, 7311, 7312,
-    7313, 7314, 7315, 7316, 7317, 7318, 7319, 7320, 7321, 7322, 7323,
-    7324, 7325, 7326, 7327, 7328, 7329, 7330, 7331, 7332, 7333, 7334,
-    7335, 7336, 7337, 7338, 7339, 7340, 7341, 7342, 7343, 7344, 7345,
-    7346, 7347, 7348, 7349, 7350, 7351, 7352, 7353, 7354, 7355, 7356,
-    7357, 7358, 7359, 7360, 7361, 7362, 7363, 7364, 7365, 7366, 7367,
-    7368, 7369, 7370, 7371, 7372, 7373, 7374, 7375, 7375, 7376, 7377,
-    7378, 7379, 7380, 7381, 7382, 7383, 7384, 7385, 7386, 7387, 7388,
-    7389, 7390, 7391, 7392, 7393, 7394, 7395, 7396, 7397, 7398, 7399,
-    7400, 7401, 7402, 7403, 7404, 7405, 7406, 7407, 7408, 7409, 7410,
-    7411, 7412, 7413, 7414, 7415, 7416, 7417, 7418, 7419, 7420, 7420,
-    7421, 7422, 7423, 7424, 7425, 7426, 7427, 7428, 7429, 7430, 7431,
-    7432, 7433, 7434, 7435, 7436, 7437, 7438, 7439, 7440, 7441, 7442,
-    7443, 7444, 7445, 7446, 7447, 7448, 7449, 7450, 7451, 7451, 7452,
-    7453, 7454, 7455, 7456, 7457, 7458, 7459, 7460, 7461, 7462, 7463,
-    7464, 7465, 7466, 7467, 7468, 7469, 7470, 7471, 7472, 7473, 7473,
-    7474, 7475, 7476, 7477, 7478, 7479, 7480, 7481, 7482, 7483, 7484,
-    7485, 7486, 7487, 7488, 7489, 7490, 7491, 7491, 7492, 7493, 7494,
-    7495, 7496, 7497, 7498, 7499, 7500, 7501, 7502, 7503, 7504, 7505,
-    7505, 7506, 7507, 7508, 7509, 7510, 7511, 7512, 7513, 7514, 7515,
-    7516, 7517, 7518, 7518, 7519, 7520, 7521, 7522, 7523, 7524, 7525,
-    7526, 7527, 7528, 7529, 7529, 7530, 7531, 7532, 7533, 7534, 7535,
-    7536, 7537, 7538, 7539, 7539, 7540, 7541, 7542, 7543, 7544, 7545,
-    7546, 7547, 7548, 7549, 7549, 7550, 7551, 7552, 7553, 7554, 7555,
-    7556, 7557, 7558, 7558, 7559, 7560, 7561, 7562, 7563, 7564, 7565,
-    7566, 7566, 7567, 7568, 7569, 7570, 7571, 7572, 7573, 7574, 7575,
-    7575, 7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7583, 7584,
-    7585, 7586, 7587, 7588, 7589, 7590, 7591, 7592, 7592, 7593, 7594,
-    7595, 7596, 7597, 7598, 7599, 7600, 7601, 7601, 7602, 7603, 7604,
-    7605, 7606, 7607, 7608, 7609, 7610, 7611, 7612, 7612, 7613, 7614,
-    7615, 7616, 7617, 7618, 7619, 7620, 7621, 7622, 7623, 7624, 7625,
-    7626, 7627, 7627, 7628, 7629, 7630, 7631, 7632, 7633, 7634, 7635,
-    7636, 7637, 7638, 7639, 7640, 7641, 7642, 7643, 7644, 7645, 7646,
-    7647, 7648, 7649, 7650, 7651, 7652, 7653, 7654, 7655, 7656, 7658,
-    7659, 7660, 7661, 7662, 7663, 7664, 7665, 7666, 7667, 7668, 7669,
-    7671, 7672, 7673, 7674, 7675, 7676, 7677, 7679, 7680, 7681, 7682,
-    7683, 7685, 7686, 7687, 7688, 7689, 7691, 7692, 7693, 7694, 7696,
-    7697, 7698, 7699, 7701, 7702, 7703, 7705, 7706, 7707, 7709, 7710,
-    7711, 7713, 7714, 7716, 7717, 7718, 7720, 7721, 7723, 7724, 7726,
-    7727, 7729, 7730, 7732, 7733, 7735, 7736, 7738, 7739, 7741, 7743,
-    7744, 7746, 7747, 7749, 7751, 7752, 7754, 7756, 7757, 7759, 7761,
-    7763, 7764, 7766, 7768, 7770, 7771, 7773, 7775, 7777, 7779, 7781,
-    7783, 7784, 7786, 7788, 7790, 7792, 7794, 7796, 7798, 7800, 7802,
-    7804, 7806, 7808, 7810, 7812, 7815, 7817, 7819, 7821, 7823, 7825,
-    7828, 7830, 7832, 7834, 7836, 7839, 7841, 7843, 7846, 7848, 7850,
-    7853, 7855, 7857, 7860, 7862, 7865, 7867, 7870, 7872, 7875, 7877,
-    7880, 7882, 7885, 7887, 7890, 7892, 7895, 7898, 7900, 7903, 7906,
-    7908, 7911, 7914, 7916, 7919, 7922, 7925, 7927, 7930, 7933, 7936,
-    7939, 7941, 7944, 7947, 7950, 7953, 7956, 7959, 7961, 7964, 7967,
-    7970, 7973, 7976, 7979, 7982, 7985, 7988, 7991, 7994, 7997, 8000,
-    8003, 8006, 8009, 8012, 8015, 8018, 8021, 8024, 8027, 8030, 8033,
-    8036, 8038, 8041, 8044, 8047, 8050, 8053, 8056, 8059, 8062, 8065,
-    8068, 8071, 8074, 8077, 8080, 8083, 8085, 8088, 8091, 8094, 8097,
-    8099, 8102, 8105, 8108, 8110, 8113, 8116, 8118, 8121, 8123, 8126,
-    8128, 8131, 8133, 8136, 8138, 8141, 8143, 8145, 8147, 8150, 8152,
-    8154, 8156, 8158, 8160, 8162, 8164, 8166, 8167, 8169, 8171, 8172,
-    8174, 8175, 8177, 8178, 8180, 8181, 8182, 8183, 8184, 8185, 8186,
-    8187, 8188, 8189, 8189, 8190, 8190, 8190, 8191, 8191, 8191, 8191,
-    8191, 8191, 8190, 8190, 8190, 8189, 8188, 8187, 8187, 8186, 8184,
-    8183, 8182, 8180, 8179, 8177, 8175, 8173, 8171, 8169, 8166, 8164,
-    8161, 8158, 8155, 8152, 8149, 8145, 8142, 8138, 8134, 8130, 8126,
-    8122, 8117, 8112, 8107, 8102, 8097, 8092, 8086, 8080, 8074, 8068,
-    8062, 8055, 8048, 8042, 8034, 8027, 8019, 8012, 8004, 7995, 7987,
-    7978, 7969, 7960, 7951, 7941, 7932, 7921, 7911, 7901, 7890, 7879,
-    7868, 7856, 7844, 7832, 7820, 7807, 7795, 7781, 7768, 7754, 7741,
-    7726, 7712, 7697, 7682, 7667, 7651, 7635, 7619, 7603, 7586, 7569,
-    7551, 7534, 7516, 7497, 7479, 7460, 7440, 7421, 7401, 7381, 7360,
-    7339, 7318, 7297, 7275, 7253, 7230, 7208, 7184, 7161, 7137, 7113,
-    7088, 7064, 7038, 7013, 6987, 6961, 6934, 6907, 6880, 6853, 6825,
-    6796, 6768, 6739, 6709, 6680, 6650, 6619, 6589, 6558, 6526, 6495,
-    6463, 6430, 6397, 6364, 6331, 6297, 6263, 6229, 6194, 6159, 6123,
-    6088, 6052, 6015, 5978, 5941, 5904, 5866, 5828, 5790, 5752, 5713,
-    5674, 5634, 5595, 5555, 5514, 5474, 5433, 5392, 5351, 5309, 5267,
-    5225, 5183, 5140, 5098, 5055, 5012, 4968, 4925, 4881, 4837, 4793,
-    4749, 4704, 4660, 4615, 4570, 4526, 4481, 4436, 4390, 4345, 4300,
-    4254, 4209, 4164    
-]
-saw100 = [
-    4108, 4083, 4057, 4032, 4007, 3981, 3956, 3931, 3905, 3880, 3855,
-    3830, 3804, 3779, 3754, 3728, 3703, 3678, 3653, 3628, 3603, 3577,
-    3552, 3527, 3502, 3477, 3452, 3427, 3402, 3377, 3353, 3328, 3303,
-    3278, 3254, 3229, 3204, 3180, 3155, 3131, 3106, 3082, 3057, 3033,
-    3009, 2985, 2960, 2936, 2912, 2888, 2864, 2840, 2816, 2793, 2769,
-    2745, 2722, 2698, 2675, 2651, 2628, 2605, 2581, 2558, 2535, 2512,
-    2489, 2466, 2444, 2421, 2398, 2376, 2353, 2331, 2308, 2286, 2264,
-    2242, 2220, 2198, 2176, 2154, 2133, 2111, 2089, 2068, 2047, 2025,
-    2004, 1983, 1962, 1941, 1921, 1900, 1879, 1859, 1838, 1818, 1798,
-    1778, 1758, 1738, 1718, 1698, 1679, 1659, 1640, 1621, 1601, 1582,
-    1563, 1544, 1526, 1507, 1488, 1470, 1452, 1433, 1415, 1397, 1379,
-    1361, 1344, 1326, 1309, 1291, 1274, 1257, 1240, 1223, 1206, 1190,
-    1173, 1157, 1140, 1124, 1108, 1092, 1076, 1060, 1045, 1029, 1014, 998,
-    983, 968, 953, 939, 924, 909, 895, 881, 866, 852, 838, 824, 811, 797,
-    784, 770, 757, 744, 731, 718, 705, 693, 680, 668, 656, 643, 631, 619,
-    608, 596, 585, 573, 562, 551, 540, 529, 518, 507, 497, 486, 476, 466,
-    456, 446, 436, 426, 416, 407, 398, 388, 379, 370, 361, 353, 344, 335,
-    327, 319, 310, 302, 294, 287, 279, 271, 264, 256, 249, 242, 235, 228,
-    221, 215, 208, 202, 195, 189, 183, 177, 171, 165, 159, 154, 148, 143,
-    138, 133, 128, 123, 118, 113, 108, 104, 100, 95, 91, 87, 83, 79, 75,
-    72, 68, 64, 61, 58, 55, 51, 48, 46, 43, 40, 37, 35, 32, 30, 28, 26,
-    24, 22, 20, 18, 16, 15, 13, 12, 10, 9, 8, 7, 6, 5, 4, 3, 3, 2, 1, 1,
-    1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 4, 4, 5, 6, 7, 8, 9, 10, 11,
-    13, 14, 15, 17, 18, 20, 22, 23, 25, 27, 29, 31, 33, 35, 37, 39, 41,
-    44, 46, 48, 51, 53, 56, 58, 61, 63, 66, 69, 72, 75, 77, 80, 83, 86,
-    89, 93, 96, 99, 102, 105, 109, 112, 115, 119, 122, 126, 129, 133, 136,
-    140, 144, 147, 151, 155, 159, 162, 166, 170, 174, 178, 182, 186, 190,
-    194, 198, 202, 206, 210, 214, 218, 222, 226, 231, 235, 239, 243, 248,
-    252, 256, 260, 265, 269, 273, 278, 282, 287, 291, 295, 300, 304, 309,
-    313, 318, 322, 326, 331, 335, 340, 344, 349, 353, 358, 362, 367, 371,
-    376, 380, 385, 389, 394, 399, 403, 408, 412, 417, 421, 426, 430, 435,
-    439, 444, 448, 453, 457, 462, 466, 470, 475, 479, 484, 488, 493, 497,
-    502, 506, 510, 515, 519, 523, 528, 532, 536, 541, 545, 549, 554, 558,
-    562, 566, 571, 575, 579, 583, 587, 592, 596, 600, 604, 608, 612, 616,
-    620, 624, 628, 632, 636, 640, 644, 648, 652, 656, 660, 664, 667, 671,
-    675, 679, 683, 686, 690, 694, 697, 701, 705, 708, 712, 715, 719, 723,
-    726, 730, 733, 736, 740, 743, 747, 750, 753, 757, 760, 763, 766, 770,
-    773, 776, 779, 782, 785, 788, 791, 795, 798, 800, 803, 806, 809, 812,
-    815, 818, 821, 824, 826, 829, 832, 834, 837, 840, 842, 845, 848, 850,
-    853, 855, 858, 860, 863, 865, 867, 870, 872, 875, 877, 879, 881, 884,
-    886, 888, 890, 892, 894, 896, 899, 901, 903, 905, 907, 909, 910, 912,
-    914, 916, 918, 920, 922, 923, 925, 927, 929, 930, 932, 934, 935, 937,
-    938, 940, 941, 943, 944, 946, 947, 949, 950, 952, 953, 954, 956, 957,
-    958, 960, 961, 962, 963, 964, 966, 967, 968, 969, 970, 971, 972, 973,
-    974, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984, 984, 985, 986,
-    987, 988, 988, 989, 990, 991, 991, 992, 993, 993, 994, 995, 995, 996,
-    996, 997, 997, 998, 998, 999, 999, 1000, 1000, 1001, 1001, 1002, 1002,
-    1003, 1003, 1003, 1004, 1004, 1004, 1005, 1005, 1005, 1006, 1006,
-    1006, 1007, 1007, 1007, 1007, 1008, 1008, 1008, 1008, 1009, 1009,
-    1009, 1009, 1009, 1009, 1010, 1010, 1010, 1010, 1010, 1010, 1010,
-    1010, 1010, 1011, 1011, 1011, 1011, 1011, 1011, 1011, 1011, 1011,
-    1011, 1011, 1011, 1011, 1011, 1011, 1011, 1011, 1011, 1011, 1011,
-    1011, 1011, 1011, 1011, 1011, 1011, 1011, 1011, 1011, 1011, 1011,
-    1011, 1011, 1011, 1011, 1010, 1010, 1010, 1010, 1010, 1010, 1010,
-    1010, 1010, 1010, 1010, 1010, 1010, 1010, 1010, 1009, 1009, 1009,
-    1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009,
-    1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
-    1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
-    1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
-    1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
-    1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1010, 1010,
-    1010, 1010, 1010, 1010, 1010, 1011, 1011, 1011, 1011, 1011, 1012,
-    1012, 1012, 1012, 1012, 1013, 1013, 1013, 1013, 1014, 1014, 1014,
-    1014, 1015, 1015, 1015, 1016, 1016, 1016, 1017, 1017, 1017, 1018,
-    1018, 1018, 1019, 1019, 1019, 1020, 1020, 1021, 1021, 1021, 1022,
-    1022, 1023, 1023, 1023, 1024, 1024, 1025, 1025, 1026, 1026, 1027,
-    1027, 1028, 1028, 1029, 1029, 1030, 1030, 1031, 1031, 1032, 1032,
-    1033, 1034, 1034, 1035, 1035, 1036, 1036, 1037, 1038, 1038, 1039,
-    1040, 1040, 1041, 1041, 1042, 1043, 1043, 1044, 1045, 1046, 1046,
-    1047, 1048, 1048, 1049, 1050, 1051, 1051, 1052, 1053, 1053, 1054,
-    1055, 1056, 1057, 1057, 1058, 1059, 1060, 1061, 1061, 1062, 1063,
-    1064, 1065, 1066, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1072,
-    1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1082,
-    1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093,
-    1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104,
-    1105, 1106, 1107, 1108, 1110, 1111, 1112, 1113, 1114, 1115, 1116,
-    1117, 1118, 1119, 1120, 1121, 1122, 1124, 1125, 1126, 1127, 1128,
-    1129, 1130, 1131, 1132, 1134, 1135, 1136, 1137, 1138, 1139, 1140,
-    1142, 1143, 1144, 1145, 1146, 1147, 1148, 1150, 1151, 1152, 1153,
-    1154, 1155, 1157, 1158, 1159, 1160, 1161, 1163, 1164, 1165, 1166,
-    1167, 1168, 1170, 1171, 1172, 1173, 1174, 1176, 1177, 1178, 1179,
-    1180, 1182, 1183, 1184, 1185, 1187, 1188, 1189, 1190, 1191, 1193,
-    1194, 1195, 1196, 1197, 1199, 1200, 1201, 1202, 1204, 1205, 1206,
-    1207, 1208, 1210, 1211, 1212, 1213, 1215, 1216, 1217, 1218, 1219,
-    1221, 1222, 1223, 1224, 1226, 1227, 1228, 1229, 1230, 1232, 1233,
-    1234, 1235, 1236, 1238, 1239, 1240, 1241, 1243, 1244, 1245, 1246,
-    1247, 1249, 1250, 1251, 1252, 1253, 1255, 1256, 1257, 1258, 1260,
-    1261, 1262, 1263, 1264, 1266, 1267, 1268, 1269, 1270, 1272, 1273,
-    1274, 1275, 1276, 1278, 1279, 1280, 1281, 1282, 1283, 1285, 1286,
-    1287, 1288, 1289, 1291, 1292, 1293, 1294, 1295, 1296, 1298, 1299,
-    1300, 1301, 1302, 1303, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
-    1313, 1314, 1315, 1316, 1317, 1318, 1319, 1321, 1322, 1323, 1324,
-    1325, 1326, 1327, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336,
-    1337, 1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348,
-    1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360,
-    1361, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372,
-    1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383,
-    1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395,
-    1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406,
-    1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417,
-    1418, 1419, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427,
-    1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438,
-    1439, 1440, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448,
-    1449, 1450, 1451, 1452, 1453, 1453, 1454, 1455, 1456, 1457, 1458,
-    1459, 1460, 1461, 1462, 1463, 1464, 1464, 1465, 1466, 1467, 1468,
-    1469, 1470, 1471, 1472, 1473, 1473, 1474, 1475, 1476, 1477, 1478,
-    1479, 1480, 1481, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488,
-    1489, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1496, 1497,
-    1498, 1499, 1500, 1501, 1502, 1503, 1503, 1504, 1505, 1506, 1507,
-    1508, 1509, 1510, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517,
-    1517, 1518, 1519, 1520, 1521, 1522, 1523, 1523, 1524, 1525, 1526,
-    1527, 1528, 1529, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1535,
-    1536, 1537, 1538, 1539, 1540, 1541, 1541, 1542, 1543, 1544, 1545,
-    1546, 1547, 1548, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1554,
-    1555, 1556, 1557, 1558, 1559, 1560, 1560, 1561, 1562, 1563, 1564,
-    1565, 1566, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1572, 1573,
-    1574, 1575, 1576, 1577, 1578, 1578, 1579, 1580, 1581, 1582, 1583,
-    1584, 1585, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1591, 1592,
-    1593, 1594, 1595, 1596, 1597, 1598, 1598, 1599, 1600, 1601, 1602,
-    1603, 1604, 1605, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612,
-    1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1619, 1620, 1621,
-    1622, 1623, 1624, 1625, 1626, 1627, 1627, 1628, 1629, 1630, 1631,
-    1632, 1633, 1634, 1635, 1635, 1636, 1637, 1638, 1639, 1640, 1641,
-    1642, 1643, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651,
-    1652, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661,
-    1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671,
-    1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681,
-    1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691,
-    1692, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701,
-    1702, 1703, 1704, 1705, 1705, 1706, 1707, 1708, 1709, 1710, 1711,
-    1712, 1713, 1714, 1715, 1716, 1717, 1718, 1718, 1719, 1720, 1721,
-    1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732,
-    1733, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742,
-    1743, 1744, 1745, 1746, 1747, 1748, 1749, 1749, 1750, 1751, 1752,
-    1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763,
-    1764, 1765, 1766, 1767, 1768, 1768, 1769, 1770, 1771, 1772, 1773,
-    1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784,
-    1785, 1786, 1787, 1788, 1788, 1789, 1790, 1791, 1792, 1793, 1794,
-    1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805,
-    1806, 1807, 1808, 1809, 1810, 1810, 1811, 1812, 1813, 1814, 1815,
-    1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826,
-    1827, 1828, 1829, 1830, 1831, 1832, 1833, 1833, 1834, 1835, 1836,
-    1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847,
-    1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1857,
-    1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868,
-    1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879,
-    1880, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889,
-    1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900,
-    1901, 1902, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910,
-    1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921,
-    1922, 1923, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931,
-    1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942,
-    1943, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952,
-    1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1961, 1962,
-    1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973,
-    1974, 1975, 1976, 1977, 1978, 1979, 1979, 1980, 1981, 1982, 1983,
-    1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994,
-    1995, 1996, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004,
-    2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2012, 2013, 2014,
-    2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025,
-    2026, 2027, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035,
-    2036, 2037, 2038, 2039, 2040, 2041, 2042, 2042, 2043, 2044, 2045,
-    2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056,
-    2057, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066,
-    2067, 2068, 2069, 2070, 2071, 2071, 2072, 2073, 2074, 2075, 2076,
-    2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2085, 2086,
-    2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097,
-    2098, 2099, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107,
-    2108, 2109, 2110, 2111, 2112, 2113, 2113, 2114, 2115, 2116, 2117,
-    2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2127,
-    2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138,
-    2139, 2140, 2140, 2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148,
-    2149, 2150, 2151, 2152, 2153, 2154, 2154, 2155, 2156, 2157, 2158,
-    2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2168,
-    2169, 2170, 2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179,
-    2180, 2181, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189,
-    2190, 2191, 2192, 2193, 2194, 2195, 2195, 2196, 2197, 2198, 2199,
-    2200, 2201, 2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2209,
-    2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220,
-    2221, 2222, 2223, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230,
-    2231, 2232, 2233, 2234, 2235, 2236, 2237, 2237, 2238, 2239, 2240,
-    2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251,
-    2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261,
-    2262, 2263, 2264, 2265, 2265, 2266, 2267, 2268, 2269, 2270, 2271,
-    2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2280, 2281,
-    2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292,
-    2293, 2294, 2295, 2295, 2296, 2297, 2298, 2299, 2300, 2301, 2302,
-    2303, 2304, 2305, 2306, 2307, 2308, 2309, 2309, 2310, 2311, 2312,
-    2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323,
-    2324, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333,
-    2334, 2335, 2336, 2337, 2338, 2339, 2339, 2340, 2341, 2342, 2343,
-    2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353, 2354,
-    2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364,
-    2365, 2366, 2367, 2368, 2369, 2369, 2370, 2371, 2372, 2373, 2374,
-    2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 2383, 2384, 2385,
-    2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395,
-    2396, 2397, 2398, 2399, 2400, 2400, 2401, 2402, 2403, 2404, 2405,
-    2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415, 2416,
-    2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426,
-    2427, 2428, 2429, 2430, 2431, 2431, 2432, 2433, 2434, 2435, 2436,
-    2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445, 2446, 2447,
-    2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457,
-    2458, 2459, 2460, 2461, 2462, 2462, 2463, 2464, 2465, 2466, 2467,
-    2468, 2469, 2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477, 2477,
-    2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488,
-    2489, 2490, 2491, 2492, 2493, 2493, 2494, 2495, 2496, 2497, 2498,
-    2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2508,
-    2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519,
-    2520, 2521, 2522, 2523, 2524, 2524, 2525, 2526, 2527, 2528, 2529,
-    2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2539,
-    2540, 2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550,
-    2551, 2552, 2553, 2554, 2554, 2555, 2556, 2557, 2558, 2559, 2560,
-    2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2570,
-    2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581,
-    2582, 2583, 2584, 2585, 2585, 2586, 2587, 2588, 2589, 2590, 2591,
-    2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599, 2600, 2600, 2601,
-    2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611, 2612,
-    2613, 2614, 2615, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622,
-    2623, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2630, 2631, 2632,
-    2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643,
-    2644, 2645, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653,
-    2654, 2655, 2656, 2657, 2658, 2659, 2660, 2660, 2661, 2662, 2663,
-    2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674,
-    2675, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684,
-    2685, 2686, 2687, 2688, 2689, 2690, 2690, 2691, 2692, 2693, 2694,
-    2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703, 2704, 2705,
-    2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715,
-    2716, 2717, 2718, 2719, 2720, 2720, 2721, 2722, 2723, 2724, 2725,
-    2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733, 2734, 2735, 2735,
-    2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746,
-    2747, 2748, 2749, 2750, 2750, 2751, 2752, 2753, 2754, 2755, 2756,
-    2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765, 2765, 2766,
-    2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777,
-    2778, 2779, 2780, 2780, 2781, 2782, 2783, 2784, 2785, 2786, 2787,
-    2788, 2789, 2790, 2791, 2792, 2793, 2794, 2795, 2795, 2796, 2797,
-    2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808,
-    2809, 2810, 2810, 2811, 2812, 2813, 2814, 2815, 2816, 2817, 2818,
-    2819, 2820, 2821, 2822, 2823, 2824, 2825, 2825, 2826, 2827, 2828,
-    2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 2838, 2839,
-    2840, 2840, 2841, 2842, 2843, 2844, 2845, 2846, 2847, 2848, 2849,
-    2850, 2851, 2852, 2853, 2854, 2855, 2855, 2856, 2857, 2858, 2859,
-    2860, 2861, 2862, 2863, 2864, 2865, 2866, 2867, 2868, 2869, 2870,
-    2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879, 2880,
-    2881, 2882, 2883, 2884, 2884, 2885, 2886, 2887, 2888, 2889, 2890,
-    2891, 2892, 2893, 2894, 2895, 2896, 2897, 2898, 2899, 2900, 2900,
-    2901, 2902, 2903, 2904, 2905, 2906, 2907, 2908, 2909, 2910, 2911,
-    2912, 2913, 2914, 2915, 2915, 2916, 2917, 2918, 2919, 2920, 2921,
-    2922, 2923, 2924, 2925, 2926, 2927, 2928, 2929, 2930, 2930, 2931,
-    2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940, 2941, 2942,
-    2943, 2944, 2945, 2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952,
-    2953, 2954, 2955, 2956, 2957, 2958, 2959, 2960, 2960, 2961, 2962,
-    2963, 2964, 2965, 2966, 2967, 2968, 2969, 2970, 2971, 2972, 2973,
-    2974, 2975, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983,
-    2984, 2985, 2986, 2987, 2988, 2989, 2990, 2990, 2991, 2992, 2993,
-    2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004,
-    3005, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014,
-    3015, 3016, 3017, 3018, 3019, 3020, 3020, 3021, 3022, 3023, 3024,
-    3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035,
-    3035, 3036, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044, 3045,
-    3046, 3047, 3048, 3049, 3050, 3050, 3051, 3052, 3053, 3054, 3055,
-    3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063, 3064, 3065, 3065,
-    3066, 3067, 3068, 3069, 3070, 3071, 3072, 3073, 3074, 3075, 3076,
-    3077, 3078, 3079, 3080, 3080, 3081, 3082, 3083, 3084, 3085, 3086,
-    3087, 3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095, 3095, 3096,
-    3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107,
-    3108, 3109, 3110, 3110, 3111, 3112, 3113, 3114, 3115, 3116, 3117,
-    3118, 3119, 3120, 3121, 3122, 3123, 3124, 3125, 3125, 3126, 3127,
-    3128, 3129, 3130, 3131, 3132, 3133, 3134, 3135, 3136, 3137, 3138,
-    3139, 3140, 3140, 3141, 3142, 3143, 3144, 3145, 3146, 3147, 3148,
-    3149, 3150, 3151, 3152, 3153, 3154, 3155, 3156, 3156, 3157, 3158,
-    3159, 3160, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 3168, 3169,
-    3170, 3171, 3171, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 3179,
-    3180, 3181, 3182, 3183, 3184, 3185, 3186, 3186, 3187, 3188, 3189,
-    3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200,
-    3201, 3201, 3202, 3203, 3204, 3205, 3206, 3207, 3208, 3209, 3210,
-    3211, 3212, 3213, 3214, 3215, 3216, 3216, 3217, 3218, 3219, 3220,
-    3221, 3222, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231,
-    3231, 3232, 3233, 3234, 3235, 3236, 3237, 3238, 3239, 3240, 3241,
-    3242, 3243, 3244, 3245, 3246, 3246, 3247, 3248, 3249, 3250, 3251,
-    3252, 3253, 3254, 3255, 3256, 3257, 3258, 3259, 3260, 3261, 3261,
-    3262, 3263, 3264, 3265, 3266, 3267, 3268, 3269, 3270, 3271, 3272,
-    3273, 3274, 3275, 3276, 3276, 3277, 3278, 3279, 3280, 3281, 3282,
-    3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3291, 3292,
-    3293, 3294, 3295, 3296, 3297, 3298, 3299, 3300, 3301, 3302, 3303,
-    3304, 3305, 3306, 3306, 3307, 3308, 3309, 3310, 3311, 3312, 3313,
-    3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3321, 3322, 3323,
-    3324, 3325, 3326, 3327, 3328, 3329, 3330, 3331, 3332, 3333, 3334,
-    3335, 3336, 3336, 3337, 3338, 3339, 3340, 3341, 3342, 3343, 3344,
-    3345, 3346, 3347, 3348, 3349, 3350, 3351, 3351, 3352, 3353, 3354,
-    3355, 3356, 3357, 3358, 3359, 3360, 3361, 3362, 3363, 3364, 3365,
-    3366, 3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373, 3374, 3375,
-    3376, 3377, 3378, 3379, 3380, 3381, 3381, 3382, 3383, 3384, 3385,
-    3386, 3387, 3388, 3389, 3390, 3391, 3392, 3393, 3394, 3395, 3396,
-    3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404, 3405, 3406,
-    3407, 3408, 3409, 3410, 3411, 3411, 3412, 3413, 3414, 3415, 3416,
-    3417, 3418, 3419, 3420, 3421, 3422, 3423, 3424, 3425, 3426, 3426,
-    3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436, 3437,
-    3438, 3439, 3440, 3441, 3441, 3442, 3443, 3444, 3445, 3446, 3447,
-    3448, 3449, 3450, 3451, 3452, 3453, 3454, 3455, 3456, 3456, 3457,
-    3458, 3459, 3460, 3461, 3462, 3463, 3464, 3465, 3466, 3467, 3468,
-    3469, 3470, 3471, 3471, 3472, 3473, 3474, 3475, 3476, 3477, 3478,
-    3479, 3480, 3481, 3482, 3483, 3484, 3485, 3486, 3486, 3487, 3488,
-    3489, 3490, 3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498, 3499,
-    3500, 3501, 3501, 3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509,
-    3510, 3511, 3512, 3513, 3514, 3515, 3516, 3516, 3517, 3518, 3519,
-    3520, 3521, 3522, 3523, 3524, 3525, 3526, 3527, 3528, 3529, 3530,
-    3531, 3531, 3532, 3533, 3534, 3535, 3536, 3537, 3538, 3539, 3540,
-    3541, 3542, 3543, 3544, 3545, 3546, 3546, 3547, 3548, 3549, 3550,
-    3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558, 3559, 3560, 3561,
-    3562, 3562, 3563, 3564, 3565, 3566, 3567, 3568, 3569, 3570, 3571,
-    3572, 3573, 3574, 3575, 3576, 3577, 3577, 3578, 3579, 3580, 3581,
-    3582, 3583, 3584, 3585, 3586, 3587, 3588, 3589, 3590, 3591, 3592,
-    3592, 3593, 3594, 3595, 3596, 3597, 3598, 3599, 3600, 3601, 3602,
-    3603, 3604, 3605, 3606, 3607, 3607, 3608, 3609, 3610, 3611, 3612,
-    3613, 3614, 3615, 3616, 3617, 3618, 3619, 3620, 3621, 3622, 3622,
-    3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632, 3633,
-    3634, 3635, 3636, 3637, 3637, 3638, 3639, 3640, 3641, 3642, 3643,
-    3644, 3645, 3646, 3647, 3648, 3649, 3650, 3651, 3652, 3652, 3653,
-    3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663, 3664,
-    3665, 3666, 3667, 3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674,
-    3675, 3676, 3677, 3678, 3679, 3680, 3681, 3682, 3682, 3683, 3684,
-    3685, 3686, 3687, 3688, 3689, 3690, 3691, 3692, 3693, 3694, 3695,
-    3696, 3697, 3697, 3698, 3699, 3700, 3701, 3702, 3703, 3704, 3705,
-    3706, 3707, 3708, 3709, 3710, 3711, 3712, 3712, 3713, 3714, 3715,
-    3716, 3717, 3718, 3719, 3720, 3721, 3722, 3723, 3724, 3725, 3726,
-    3727, 3727, 3728, 3729, 3730, 3731, 3732, 3733, 3734, 3735, 3736,
-    3737, 3738, 3739, 3740, 3741, 3742, 3742, 3743, 3744, 3745, 3746,
-    3747, 3748, 3749, 3750, 3751, 3752, 3753, 3754, 3755, 3756, 3757,
-    3757, 3758, 3759, 3760, 3761, 3762, 3763, 3764, 3765, 3766, 3767,
-    3768, 3769, 3770, 3771, 3772, 3772, 3773, 3774, 3775, 3776, 3777,
-    3778, 3779, 3780, 3781, 3782, 3783, 3784, 3785, 3786, 3787, 3787,
-    3788, 3789, 3790, 3791, 3792, 3793, 3794, 3795, 3796, 3797, 3798,
-    3799, 3800, 3801, 3802, 3802, 3803, 3804, 3805, 3806, 3807, 3808,
-    3809, 3810, 3811, 3812, 3813, 3814, 3815, 3816, 3817, 3817, 3818,
-    3819, 3820, 3821, 3822, 3823, 3824, 3825, 3826, 3827, 3828, 3829,
-    3830, 3831, 3832, 3832, 3833, 3834, 3835, 3836, 3837, 3838, 3839,
-    3840, 3841, 3842, 3843, 3844, 3845, 3846, 3847, 3847, 3848, 3849,
-    3850, 3851, 3852, 3853, 3854, 3855, 3856, 3857, 3858, 3859, 3860,
-    3861, 3862, 3862, 3863, 3864, 3865, 3866, 3867, 3868, 3869, 3870,
-    3871, 3872, 3873, 3874, 3875, 3876, 3877, 3877, 3878, 3879, 3880,
-    3881, 3882, 3883, 3884, 3885, 3886, 3887, 3888, 3889, 3890, 3891,
-    3892, 3892, 3893, 3894, 3895, 3896, 3897, 3898, 3899, 3900, 3901,
-    3902, 3903, 3904, 3905, 3906, 3907, 3908, 3908, 3909, 3910, 3911,
-    3912, 3913, 3914, 3915, 3916, 3917, 3918, 3919, 3920, 3921, 3922,
-    3923, 3923, 3924, 3925, 3926, 3927, 3928, 3929, 3930, 3931, 3932,
-    3933, 3934, 3935, 3936, 3937, 3938, 3938, 3939, 3940, 3941, 3942,
-    3943, 3944, 3945, 3946, 3947, 3948, 3949, 3950, 3951, 3952, 3953,
-    3953, 3954, 3955, 3956, 3957, 3958, 3959, 3960, 3961, 3962, 3963,
-    3964, 3965, 3966, 3967, 3968, 3968, 3969, 3970, 3971, 3972, 3973,
-    3974, 3975, 3976, 3977, 3978, 3979, 3980, 3981, 3982, 3983, 3983,
-    3984, 3985, 3986, 3987, 3988, 3989, 3990, 3991, 3992, 3993, 3994,
-    3995, 3996, 3997, 3998, 3998, 3999, 4000, 4001, 4002, 4003, 4004,
-    4005, 4006, 4007, 4008, 4009, 4010, 4011, 4012, 4013, 4013, 4014,
-    4015, 4016, 4017, 4018, 4019, 4020, 4021, 4022, 4023, 4024, 4025,
-    4026, 4027, 4028, 4028, 4029, 4030, 4031, 4032, 4033, 4034, 4035,
-    4036, 4037, 4038, 4039, 4040, 4041, 4042, 4043, 4043, 4044, 4045,
-    4046, 4047, 4048, 4049, 4050, 4051, 4052, 4053, 4054, 4055, 4056,
-    4057, 4058, 4058, 4059, 4060, 4061, 4062, 4063, 4064, 4065, 4066,
-    4067, 4068, 4069, 4070, 4071, 4072, 4073, 4073, 4074, 4075, 4076,
-    4077, 4078, 4079, 4080, 4081, 4082, 4083, 4084, 4085, 4086, 4087,
-    4088, 4088, 4089, 4090, 4091, 4092, 4093, 4094, 4095, 4096, 4097,
-    4098, 4099, 4100, 4101, 4102, 4103, 4103, 4104, 4105, 4106, 4107,
-    4108, 4109, 4110, 4111, 4112, 4113, 4114, 4115, 4116, 4117, 4118,
-    4118, 4119, 4120, 4121, 4122, 4123, 4124, 4125, 4126, 4127, 4128,
-    4129, 4130, 4131, 4132, 4133, 4133, 4134, 4135, 4136, 4137, 4138,
-    4139, 4140, 4141, 4142, 4143, 4144, 4145, 4146, 4147, 4148, 4148,
-    4149, 4150, 4151, 4152, 4153, 4154, 4155, 4156, 4157, 4158, 4159,
-    4160, 4161, 4162, 4163, 4163, 4164, 4165, 4166, 4167, 4168, 4169,
-    4170, 4171, 4172, 4173, 4174, 4175, 4176, 4177, 4178, 4178, 4179,
-    4180, 4181, 4182, 4183, 4184, 4185, 4186, 4187, 4188, 4189, 4190,
-    4191, 4192, 4193, 4193, 4194, 4195, 4196, 4197, 4198, 4199, 4200,
-    4201, 4202, 4203, 4204, 4205, 4206, 4207, 4208, 4208, 4209, 4210,
-    4211, 4212, 4213, 4214, 4215, 4216, 4217, 4218, 4219, 4220, 4221,
-    4222, 4223, 4223, 4224, 4225, 4226, 4227, 4228, 4229, 4230, 4231,
-    4232, 4233, 4234, 4235, 4236, 4237, 4238, 4238, 4239, 4240, 4241,
-    4242, 4243, 4244, 4245, 4246, 4247, 4248, 4249, 4250, 4251, 4252,
-    4253, 4253, 4254, 4255, 4256, 4257, 4258, 4259, 4260, 4261, 4262,
-    4263, 4264, 4265, 4266, 4267, 4268, 4268, 4269, 4270, 4271, 4272,
-    4273, 4274, 4275, 4276, 4277, 4278, 4279, 4280, 4281, 4282, 4283,
-    4284, 4284, 4285, 4286, 4287, 4288, 4289, 4290, 4291, 4292, 4293,
-    4294, 4295, 4296, 4297, 4298, 4299, 4299, 4300, 4301, 4302, 4303,
-    4304, 4305, 4306, 4307, 4308, 4309, 4310, 4311, 4312, 4313, 4314,
-    4314, 4315, 4316, 4317, 4318, 4319, 4320, 4321, 4322, 4323, 4324,
-    4325, 4326, 4327, 4328, 4329, 4329, 4330, 4331, 4332, 4333, 4334,
-    4335, 4336, 4337, 4338, 4339, 4340, 4341, 4342, 4343, 4344, 4344,
-    4345, 4346, 4347, 4348, 4349, 4350, 4351, 4352, 4353, 4354, 4355,
-    4356, 4357, 4358, 4359, 4359, 4360, 4361, 4362, 4363, 4364, 4365,
-    4366, 4367, 4368, 4369, 4370, 4371, 4372, 4373, 4374, 4374, 4375,
-    4376, 4377, 4378, 4379, 4380, 4381, 4382, 4383, 4384, 4385, 4386,
-    4387, 4388, 4389, 4389, 4390, 4391, 4392, 4393, 4394, 4395, 4396,
-    4397, 4398, 4399, 4400, 4401, 4402, 4403, 4404, 4404, 4405, 4406,
-    4407, 4408, 4409, 4410, 4411, 4412, 4413, 4414, 4415, 4416, 4417,
-    4418, 4419, 4419, 4420, 4421, 4422, 4423, 4424, 4425, 4426, 4427,
-    4428, 4429, 4430, 4431, 4432, 4433, 4434, 4434, 4435, 4436, 4437,
-    4438, 4439, 4440, 4441, 4442, 4443, 4444, 4445, 4446, 4447, 4448,
-    4449, 4449, 4450, 4451, 4452, 4453, 4454, 4455, 4456, 4457, 4458,
-    4459, 4460, 4461, 4462, 4463, 4464, 4464, 4465, 4466, 4467, 4468,
-    4469, 4470, 4471, 4472, 4473, 4474, 4475, 4476, 4477, 4478, 4479,
-    4479, 4480, 4481, 4482, 4483, 4484, 4485, 4486, 4487, 4488, 4489,
-    4490, 4491, 4492, 4493, 4494, 4494, 4495, 4496, 4497, 4498, 4499,
-    4500, 4501, 4502, 4503, 4504, 4505, 4506, 4507, 4508, 4509, 4509,
-    4510, 4511, 4512, 4513, 4514, 4515, 4516, 4517, 4518, 4519, 4520,
-    4521, 4522, 4523, 4524, 4524, 4525, 4526, 4527, 4528, 4529, 4530,
-    4531, 4532, 4533, 4534, 4535, 4536, 4537, 4538, 4539, 4539, 4540,
-    4541, 4542, 4543, 4544, 4545, 4546, 4547, 4548, 4549, 4550, 4551,
-    4552, 4553, 4554, 4554, 4555, 4556, 4557, 4558, 4559, 4560, 4561,
-    4562, 4563, 4564, 4565, 4566, 4567, 4568, 4569, 4569, 4570, 4571,
-    4572, 4573, 4574, 4575, 4576, 4577, 4578, 4579, 4580, 4581, 4582,
-    4583, 4584, 4584, 4585, 4586, 4587, 4588, 4589, 4590, 4591, 4592,
-    4593, 4594, 4595, 4596, 4597, 4598, 4599, 4599, 4600, 4601, 4602,
-    4603, 4604, 4605, 4606, 4607, 4608, 4609, 4610, 4611, 4612, 4613,
-    4614, 4614, 4615, 4616, 4617, 4618, 4619, 4620, 4621, 4622, 4623,
-    4624, 4625, 4626, 4627, 4628, 4629, 4629, 4630, 4631, 4632, 4633,
-    4634, 4635, 4636, 4637, 4638, 4639, 4640, 4641, 4642, 4643, 4644,
-    4645, 4645, 4646, 4647, 4648, 4649, 4650, 4651, 4652, 4653, 4654,
-    4655, 4656, 4657, 4658, 4659, 4660, 4660, 4661, 4662, 4663, 4664,
-    4665, 4666, 4667, 4668, 4669, 4670, 4671, 4672, 4673, 4674, 4675,
-    4675, 4676, 4677, 4678, 4679, 4680, 4681, 4682, 4683, 4684, 4685,
-    4686, 4687, 4688, 4689, 4690, 4690, 4691, 4692, 4693, 4694, 4695,
-    4696, 4697, 4698, 4699, 4700, 4701, 4702, 4703, 4704, 4705, 4705,
-    4706, 4707, 4708, 4709, 4710, 4711, 4712, 4713, 4714, 4715, 4716,
-    4717, 4718, 4719, 4720, 4720, 4721, 4722, 4723, 4724, 4725, 4726,
-    4727, 4728, 4729, 4730, 4731, 4732, 4733, 4734, 4735, 4735, 4736,
-    4737, 4738, 4739, 4740, 4741, 4742, 4743, 4744, 4745, 4746, 4747,
-    4748, 4749, 4750, 4750, 4751, 4752, 4753, 4754, 4755, 4756, 4757,
-    4758, 4759, 4760, 4761, 4762, 4763, 4764, 4765, 4765, 4766, 4767,
-    4768, 4769, 4770, 4771, 4772, 4773, 4774, 4775, 4776, 4777, 4778,
-    4779, 4780, 4780, 4781, 4782, 4783, 4784, 4785, 4786, 4787, 4788,
-    4789, 4790, 4791, 4792, 4793, 4794, 4795, 4795, 4796, 4797, 4798,
-    4799, 4800, 4801, 4802, 4803, 4804, 4805, 4806, 4807, 4808, 4809,
-    4810, 4810, 4811, 4812, 4813, 4814, 4815, 4816, 4817, 4818, 4819,
-    4820, 4821, 4822, 4823, 4824, 4825, 4825, 4826, 4827, 4828, 4829,
-    4830, 4831, 4832, 4833, 4834, 4835, 4836, 4837, 4838, 4839, 4840,
-    4840, 4841, 4842, 4843, 4844, 4845, 4846, 4847, 4848, 4849, 4850,
-    4851, 4852, 4853, 4854, 4855, 4855, 4856, 4857, 4858, 4859, 4860,
-    4861, 4862, 4863, 4864, 4865, 4866, 4867, 4868, 4869, 4870, 4870,
-    4871, 4872, 4873, 4874, 4875, 4876, 4877, 4878, 4879, 4880, 4881,
-    4882, 4883, 4884, 4885, 4885, 4886, 4887, 4888, 4889, 4890, 4891,
-    4892, 4893, 4894, 4895, 4896, 4897, 4898, 4899, 4900, 4900, 4901,
-    4902, 4903, 4904, 4905, 4906, 4907, 4908, 4909, 4910, 4911, 4912,
-    4913, 4914, 4915, 4915, 4916, 4917, 4918, 4919, 4920, 4921, 4922,
-    4923, 4924, 4925, 4926, 4927, 4928, 4929, 4930, 4930, 4931, 4932,
-    4933, 4934, 4935, 4936, 4937, 4938, 4939, 4940, 4941, 4942, 4943,
-    4944, 4945, 4945, 4946, 4947, 4948, 4949, 4950, 4951, 4952, 4953,
-    4954, 4955, 4956, 4957, 4958, 4959, 4960, 4960, 4961, 4962, 4963,
-    4964, 4965, 4966, 4967, 4968, 4969, 4970, 4971, 4972, 4973, 4974,
-    4975, 4975, 4976, 4977, 4978, 4979, 4980, 4981, 4982, 4983, 4984,
-    4985, 4986, 4987, 4988, 4989, 4990, 4990, 4991, 4992, 4993, 4994,
-    4995, 4996, 4997, 4998, 4999, 5000, 5001, 5002, 5003, 5004, 5005,
-    5005, 5006, 5007, 5008, 5009, 5010, 5011, 5012, 5013, 5014, 5015,
-    5016, 5017, 5018, 5019, 5020, 5020, 5021, 5022, 5023, 5024, 5025,
-    5026, 5027, 5028, 5029, 5030, 5031, 5032, 5033, 5034, 5035, 5035,
-    5036, 5037, 5038, 5039, 5040, 5041, 5042, 5043, 5044, 5045, 5046,
-    5047, 5048, 5049, 5050, 5051, 5051, 5052, 5053, 5054, 5055, 5056,
-    5057, 5058, 5059, 5060, 5061, 5062, 5063, 5064, 5065, 5066, 5066,
-    5067, 5068, 5069, 5070, 5071, 5072, 5073, 5074, 5075, 5076, 5077,
-    5078, 5079, 5080, 5081, 5081, 5082, 5083, 5084, 5085, 5086, 5087,
-    5088, 5089, 5090, 5091, 5092, 5093, 5094, 5095, 5096, 5096, 5097,
-    5098, 5099, 5100, 5101, 5102, 5103, 5104, 5105, 5106, 5107, 5108,
-    5109, 5110, 5111, 5111, 5112, 5113, 5114, 5115, 5116, 5117, 5118,
-    5119, 5120, 5121, 5122, 5123, 5124, 5125, 5126, 5126, 5127, 5128,
-    5129, 5130, 5131, 5132, 5133, 5134, 5135, 5136, 5137, 5138, 5139,
-    5140, 5141, 5141, 5142, 5143, 5144, 5145, 5146, 5147, 5148, 5149,
-    5150, 5151, 5152, 5153, 5154, 5155, 5156, 5156, 5157, 5158, 5159,
-    5160, 5161, 5162, 5163, 5164, 5165, 5166, 5167, 5168, 5169, 5170,
-    5171, 5171, 5172, 5173, 5174, 5175, 5176, 5177, 5178, 5179, 5180,
-    5181, 5182, 5183, 5184, 5185, 5186, 5186, 5187, 5188, 5189, 5190,
-    5191, 5192, 5193, 5194, 5195, 5196, 5197, 5198, 5199, 5200, 5201,
-    5201, 5202, 5203, 5204, 5205, 5206, 5207, 5208, 5209, 5210, 5211,
-    5212, 5213, 5214, 5215, 5216, 5216, 5217, 5218, 5219, 5220, 5221,
-    5222, 5223, 5224, 5225, 5226, 5227, 5228, 5229, 5230, 5231, 5231,
-    5232, 5233, 5234, 5235, 5236, 5237, 5238, 5239, 5240, 5241, 5242,
-    5243, 5244, 5245, 5246, 5246, 5247, 5248, 5249, 5250, 5251, 5252,
-    5253, 5254, 5255, 5256, 5257, 5258, 5259, 5260, 5261, 5261, 5262,
-    5263, 5264, 5265, 5266, 5267, 5268, 5269, 5270, 5271, 5272, 5273,
-    5274, 5275, 5276, 5276, 5277, 5278, 5279, 5280, 5281, 5282, 5283,
-    5284, 5285, 5286, 5287, 5288, 5289, 5290, 5291, 5291, 5292, 5293,
-    5294, 5295, 5296, 5297, 5298, 5299, 5300, 5301, 5302, 5303, 5304,
-    5305, 5306, 5307, 5307, 5308, 5309, 5310, 5311, 5312, 5313, 5314,
-    5315, 5316, 5317, 5318, 5319, 5320, 5321, 5321, 5322, 5323, 5324,
-    5325, 5326, 5327, 5328, 5329, 5330, 5331, 5332, 5333, 5334, 5335,
-    5336, 5336, 5337, 5338, 5339, 5340, 5341, 5342, 5343, 5344, 5345,
-    5346, 5347, 5348, 5349, 5350, 5351, 5351, 5352, 5353, 5354, 5355,
-    5356, 5357, 5358, 5359, 5360, 5361, 5362, 5363, 5364, 5365, 5366,
-    5366, 5367, 5368, 5369, 5370, 5371, 5372, 5373, 5374, 5375, 5376,
-    5377, 5378, 5379, 5380, 5381, 5381, 5382, 5383, 5384, 5385, 5386,
-    5387, 5388, 5389, 5390, 5391, 5392, 5393, 5394, 5395, 5396, 5396,
-    5397, 5398, 5399, 5400, 5401, 5402, 5403, 5404, 5405, 5406, 5407,
-    5408, 5409, 5410, 5411, 5411, 5412, 5413, 5414, 5415, 5416, 5417,
-    5418, 5419, 5420, 5421, 5422, 5423, 5424, 5425, 5426, 5426, 5427,
-    5428, 5429, 5430, 5431, 5432, 5433, 5434, 5435, 5436, 5437, 5438,
-    5439, 5440, 5441, 5441, 5442, 5443, 5444, 5445, 5446, 5447, 5448,
-    5449, 5450, 5451, 5452, 5453, 5454, 5455, 5456, 5456, 5457, 5458,
-    5459, 5460, 5461, 5462, 5463, 5464, 5465, 5466, 5467, 5468, 5469,
-    5470, 5471, 5471, 5472, 5473, 5474, 5475, 5476, 5477, 5478, 5479,
-    5480, 5481, 5482, 5483, 5484, 5485, 5486, 5486, 5487, 5488, 5489,
-    5490, 5491, 5492, 5493, 5494, 5495, 5496, 5497, 5498, 5499, 5500,
-    5501, 5501, 5502, 5503, 5504, 5505, 5506, 5507, 5508, 5509, 5510,
-    5511, 5512, 5513, 5514, 5515, 5516, 5516, 5517, 5518, 5519, 5520,
-    5521, 5522, 5523, 5524, 5525, 5526, 5527, 5528, 5529, 5530, 5531,
-    5531, 5532, 5533, 5534, 5535, 5536, 5537, 5538, 5539, 5540, 5541,
-    5542, 5543, 5544, 5545, 5546, 5546, 5547, 5548, 5549, 5550, 5551,
-    5552, 5553, 5554, 5555, 5556, 5557, 5558, 5559, 5560, 5561, 5561,
-    5562, 5563, 5564, 5565, 5566, 5567, 5568, 5569, 5570, 5571, 5572,
-    5573, 5574, 5575, 5576, 5576, 5577, 5578, 5579, 5580, 5581, 5582,
-    5583, 5584, 5585, 5586, 5587, 5588, 5589, 5590, 5591, 5591, 5592,
-    5593, 5594, 5595, 5596, 5597, 5598, 5599, 5600, 5601, 5602, 5603,
-    5604, 5605, 5606, 5606, 5607, 5608, 5609, 5610, 5611, 5612, 5613,
-    5614, 5615, 5616, 5617, 5618, 5619, 5620, 5621, 5621, 5622, 5623,
-    5624, 5625, 5626, 5627, 5628, 5629, 5630, 5631, 5632, 5633, 5634,
-    5635, 5636, 5637, 5637, 5638, 5639, 5640, 5641, 5642, 5643, 5644,
-    5645, 5646, 5647, 5648, 5649, 5650, 5651, 5652, 5652, 5653, 5654,
-    5655, 5656, 5657, 5658, 5659, 5660, 5661, 5662, 5663, 5664, 5665,
-    5666, 5667, 5667, 5668, 5669, 5670, 5671, 5672, 5673, 5674, 5675,
-    5676, 5677, 5678, 5679, 5680, 5681, 5682, 5683, 5683, 5684, 5685,
-    5686, 5687, 5688, 5689, 5690, 5691, 5692, 5693, 5694, 5695, 5696,
-    5697, 5698, 5698, 5699, 5700, 5701, 5702, 5703, 5704, 5705, 5706,
-    5707, 5708, 5709, 5710, 5711, 5712, 5713, 5714, 5714, 5715, 5716,
-    5717, 5718, 5719, 5720, 5721, 5722, 5723, 5724, 5725, 5726, 5727,
-    5728, 5729, 5729, 5730, 5731, 5732, 5733, 5734, 5735, 5736, 5737,
-    5738, 5739, 5740, 5741, 5742, 5743, 5744, 5744, 5745, 5746, 5747,
-    5748, 5749, 5750, 5751, 5752, 5753, 5754, 5755, 5756, 5757, 5758,
-    5759, 5760, 5760, 5761, 5762, 5763, 5764, 5765, 5766, 5767, 5768,
-    5769, 5770, 5771, 5772, 5773, 5774, 5775, 5775, 5776, 5777, 5778,
-    5779, 5780, 5781, 5782, 5783, 5784, 5785, 5786, 5787, 5788, 5789,
-    5790, 5791, 5791, 5792, 5793, 5794, 5795, 5796, 5797, 5798, 5799,
-    5800, 5801, 5802, 5803, 5804, 5805, 5806, 5806, 5807, 5808, 5809,
-    5810, 5811, 5812, 5813, 5814, 5815, 5816, 5817, 5818, 5819, 5820,
-    5821, 5822, 5822, 5823, 5824, 5825, 5826, 5827, 5828, 5829, 5830,
-    5831, 5832, 5833, 5834, 5835, 5836, 5837, 5837, 5838, 5839, 5840,
-    5841, 5842, 5843, 5844, 5845, 5846, 5847, 5848, 5849, 5850, 5851,
-    5852, 5852, 5853, 5854, 5855, 5856, 5857, 5858, 5859, 5860, 5861,
-    5862, 5863, 5864, 5865, 5866, 5867, 5867, 5868, 5869, 5870, 5871,
-    5872, 5873, 5874, 5875, 5876, 5877, 5878, 5879, 5880, 5881, 5882,
-    5882, 5883, 5884, 5885, 5886, 5887, 5888, 5889, 5890, 5891, 5892,
-    5893, 5894, 5895, 5896, 5896, 5897, 5898, 5899, 5900, 5901, 5902,
-    5903, 5904, 5905, 5906, 5907, 5908, 5909, 5910, 5911, 5911, 5912,
-    5913, 5914, 5915, 5916, 5917, 5918, 5919, 5920, 5921, 5922, 5923,
-    5924, 5925, 5926, 5926, 5927, 5928, 5929, 5930, 5931, 5932, 5933,
-    5934, 5935, 5936, 5937, 5938, 5939, 5940, 5940, 5941, 5942, 5943,
-    5944, 5945, 5946, 5947, 5948, 5949, 5950, 5951, 5952, 5953, 5954,
-    5954, 5955, 5956, 5957, 5958, 5959, 5960, 5961, 5962, 5963, 5964,
-    5965, 5966, 5967, 5968, 5968, 5969, 5970, 5971, 5972, 5973, 5974,
-    5975, 5976, 5977, 5978, 5979, 5980, 5981, 5982, 5982, 5983, 5984,
-    5985, 5986, 5987, 5988, 5989, 5990, 5991, 5992, 5993, 5994, 5995,
-    5996, 5996, 5997, 5998, 5999, 6000, 6001, 6002, 6003, 6004, 6005,
-    6006, 6007, 6008, 6009, 6010, 6010, 6011, 6012, 6013, 6014, 6015,
-    6016, 6017, 6018, 6019, 6020, 6021, 6022, 6023, 6023, 6024, 6025,
-    6026, 6027, 6028, 6029, 6030, 6031, 6032, 6033, 6034, 6035, 6036,
-    6037, 6037, 6038, 6039, 6040, 6041, 6042, 6043, 6044, 6045, 6046,
-    6047, 6048, 6049, 6050, 6051, 6051, 6052, 6053, 6054, 6055, 6056,
-    6057, 6058, 6059, 6060, 6061, 6062, 6063, 6064, 6064, 6065, 6066,
-    6067, 6068, 6069, 6070, 6071, 6072, 6073, 6074, 6075, 6076, 6077,
-    6078, 6078, 6079, 6080, 6081, 6082, 6083, 6084, 6085, 6086, 6087,
-    6088, 6089, 6090, 6091, 6092, 6092, 6093, 6094, 6095, 6096, 6097,
-    6098, 6099, 6100, 6101, 6102, 6103, 6104, 6105, 6106, 6106, 6107,
-    6108, 6109, 6110, 6111, 6112, 6113, 6114, 6115, 6116, 6117, 6118,
-    6119, 6120, 6120, 6121, 6122, 6123, 6124, 6125, 6126, 6127, 6128,
-    6129, 6130, 6131, 6132, 6133, 6134, 6134, 6135, 6136, 6137, 6138,
-    6139, 6140, 6141, 6142, 6143, 6144, 6145, 6146, 6147, 6148, 6149,
-    6149, 6150, 6151, 6152, 6153, 6154, 6155, 6156, 6157, 6158, 6159,
-    6160, 6161, 6162, 6163, 6164, 6164, 6165, 6166, 6167, 6168, 6169,
-    6170, 6171, 6172, 6173, 6174, 6175, 6176, 6177, 6178, 6179, 6179,
-    6180, 6181, 6182, 6183, 6184, 6185, 6186, 6187, 6188, 6189, 6190,
-    6191, 6192, 6193, 6194, 6195, 6195, 6196, 6197, 6198, 6199, 6200,
-    6201, 6202, 6203, 6204, 6205, 6206, 6207, 6208, 6209, 6210, 6211,
-    6212, 6212, 6213, 6214, 6215, 6216, 6217, 6218, 6219, 6220, 6221,
-    6222, 6223, 6224, 6225, 6226, 6227, 6228, 6229, 6230, 6230, 6231,
-    6232, 6233, 6234, 6235, 6236, 6237, 6238, 6239, 6240, 6241, 6242,
-    6243, 6244, 6245, 6246, 6247, 6248, 6248, 6249, 6250, 6251, 6252,
-    6253, 6254, 6255, 6256, 6257, 6258, 6259, 6260, 6261, 6262, 6263,
-    6264, 6265, 6266, 6267, 6268, 6268, 6269, 6270, 6271, 6272, 6273,
-    6274, 6275, 6276, 6277, 6278, 6279, 6280, 6281, 6282, 6283, 6284,
-    6285, 6286, 6287, 6288, 6289, 6289, 6290, 6291, 6292, 6293, 6294,
-    6295, 6296, 6297, 6298, 6299, 6300, 6301, 6302, 6303, 6304, 6305,
-    6306, 6307, 6308, 6309, 6310, 6311, 6311, 6312, 6313, 6314, 6315,
-    6316, 6317, 6318, 6319, 6320, 6321, 6322, 6323, 6324, 6325, 6326,
-    6327, 6328, 6329, 6330, 6331, 6332, 6333, 6334, 6334, 6335, 6336,
-    6337, 6338, 6339, 6340, 6341, 6342, 6343, 6344, 6345, 6346, 6347,
-    6348, 6349, 6350, 6351, 6352, 6353, 6354, 6355, 6356, 6357, 6358,
-    6358, 6359, 6360, 6361, 6362, 6363, 6364, 6365, 6366, 6367, 6368,
-    6369, 6370, 6371, 6372, 6373, 6374, 6375, 6376, 6377, 6378, 6379,
-    6380, 6381, 6381, 6382, 6383, 6384, 6385, 6386, 6387, 6388, 6389,
-    6390, 6391, 6392, 6393, 6394, 6395, 6396, 6397, 6398, 6399, 6400,
-    6401, 6402, 6403, 6403, 6404, 6405, 6406, 6407, 6408, 6409, 6410,
-    6411, 6412, 6413, 6414, 6415, 6416, 6417, 6418, 6419, 6420, 6421,
-    6422, 6423, 6423, 6424, 6425, 6426, 6427, 6428, 6429, 6430, 6431,
-    6432, 6433, 6434, 6435, 6436, 6437, 6438, 6439, 6440, 6441, 6442,
-    6442, 6443, 6444, 6445, 6446, 6447, 6448, 6449, 6450, 6451, 6452,
-    6453, 6454, 6455, 6456, 6457, 6458, 6458, 6459, 6460, 6461, 6462,
-    6463, 6464, 6465, 6466, 6467, 6468, 6469, 6470, 6471, 6472, 6473,
-    6473, 6474, 6475, 6476, 6477, 6478, 6479, 6480, 6481, 6482, 6483,
-    6484, 6485, 6486, 6486, 6487, 6488, 6489, 6490, 6491, 6492, 6493,
-    6494, 6495, 6496, 6497, 6498, 6499, 6499, 6500, 6501, 6502, 6503,
-    6504, 6505, 6506, 6507, 6508, 6509, 6510, 6510, 6511, 6512, 6513,
-    6514, 6515, 6516, 6517, 6518, 6519, 6520, 6520, 6521, 6522, 6523,
-    6524, 6525, 6526, 6527, 6528, 6529, 6530, 6530, 6531, 6532, 6533,
-    6534, 6535, 6536, 6537, 6538, 6539, 6539, 6540, 6541, 6542, 6543,
-    6544, 6545, 6546, 6547, 6548, 6548, 6549, 6550, 6551, 6552, 6553,
-    6554, 6555, 6556, 6556, 6557, 6558, 6559, 6560, 6561, 6562, 6563,
-    6564, 6564, 6565, 6566, 6567, 6568, 6569, 6570, 6571, 6572, 6572,
-    6573, 6574, 6575, 6576, 6577, 6578, 6579, 6579, 6580, 6581, 6582,
-    6583, 6584, 6585, 6586, 6586, 6587, 6588, 6589, 6590, 6591, 6592,
-    6593, 6593, 6594, 6595, 6596, 6597, 6598, 6599, 6600, 6600, 6601,
-    6602, 6603, 6604, 6605, 6606, 6606, 6607, 6608, 6609, 6610, 6611,
-    6612, 6613, 6613, 6614, 6615, 6616, 6617, 6618, 6619, 6619, 6620,
-    6621, 6622, 6623, 6624, 6625, 6625, 6626, 6627, 6628, 6629, 6630,
-    6631, 6631, 6632, 6633, 6634, 6635, 6636, 6637, 6637, 6638, 6639,
-    6640, 6641, 6642, 6643, 6643, 6644, 6645, 6646, 6647, 6648, 6649,
-    6650, 6650, 6651, 6652, 6653, 6654, 6655, 6656, 6656, 6657, 6658,
-    6659, 6660, 6661, 6662, 6662, 6663, 6664, 6665, 6666, 6667, 6668,
-    6668, 6669, 6670, 6671, 6672, 6673, 6674, 6674, 6675, 6676, 6677,
-    6678, 6679, 6680, 6681, 6681, 6682, 6683, 6684, 6685, 6686, 6687,
-    6688, 6688, 6689, 6690, 6691, 6692, 6693, 6694, 6695, 6695, 6696,
-    6697, 6698, 6699, 6700, 6701, 6702, 6702, 6703, 6704, 6705, 6706,
-    6707, 6708, 6709, 6710, 6710, 6711, 6712, 6713, 6714, 6715, 6716,
-    6717, 6718, 6718, 6719, 6720, 6721, 6722, 6723, 6724, 6725, 6726,
-    6727, 6727, 6728, 6729, 6730, 6731, 6732, 6733, 6734, 6735, 6736,
-    6737, 6738, 6738, 6739, 6740, 6741, 6742, 6743, 6744, 6745, 6746,
-    6747, 6748, 6749, 6750, 6751, 6751, 6752, 6753, 6754, 6755, 6756,
-    6757, 6758, 6759, 6760, 6761, 6762, 6763, 6764, 6765, 6766, 6767,
-    6768, 6769, 6770, 6771, 6772, 6772, 6773, 6774, 6775, 6776, 6777,
-    6778, 6779, 6780, 6781, 6782, 6783, 6784, 6785, 6786, 6787, 6788,
-    6789, 6790, 6791, 6792, 6793, 6794, 6795, 6796, 6797, 6798, 6799,
-    6800, 6801, 6802, 6803, 6804, 6805, 6806, 6808, 6809, 6810, 6811,
-    6812, 6813, 6814, 6815, 6816, 6817, 6818, 6819, 6820, 6821, 6822,
-    6823, 6824, 6825, 6826, 6827, 6828, 6830, 6831, 6832, 6833, 6834,
-    6835, 6836, 6837, 6838, 6839, 6840, 6841, 6843, 6844, 6845, 6846,
-    6847, 6848, 6849, 6850, 6851, 6852, 6854, 6855, 6856, 6857, 6858,
-    6859, 6860, 6861, 6862, 6864, 6865, 6866, 6867, 6868, 6869, 6870,
-    6872, 6873, 6874, 6875, 6876, 6877, 6878, 6880, 6881, 6882, 6883,
-    6884, 6885, 6886, 6888, 6889, 6890, 6891, 6892, 6893, 6895, 6896,
-    6897, 6898, 6899, 6900, 6902, 6903, 6904, 6905, 6906, 6908, 6909,
-    6910, 6911, 6912, 6913, 6915, 6916, 6917, 6918, 6919, 6921, 6922,
-    6923, 6924, 6925, 6927, 6928, 6929, 6930, 6931, 6933, 6934, 6935,
-    6936, 6938, 6939, 6940, 6941, 6942, 6944, 6945, 6946, 6947, 6948,
-    6950, 6951, 6952, 6953, 6955, 6956, 6957, 6958, 6959, 6961, 6962,
-    6963, 6964, 6965, 6967, 6968, 6969, 6970, 6972, 6973, 6974, 6975,
-    6976, 6978, 6979, 6980, 6981, 6983, 6984, 6985, 6986, 6987, 6989,
-    6990, 6991, 6992, 6994, 6995, 6996, 6997, 6998, 7000, 7001, 7002,
-    7003, 7004, 7006, 7007, 7008, 7009, 7011, 7012, 7013, 7014, 7015,
-    7017, 7018, 7019, 7020, 7021, 7023, 7024, 7025, 7026, 7027, 7028,
-    7030, 7031, 7032, 7033, 7034, 7036, 7037, 7038, 7039, 7040, 7041,
-    7043, 7044, 7045, 7046, 7047, 7048, 7049, 7051, 7052, 7053, 7054,
-    7055, 7056, 7057, 7059, 7060, 7061, 7062, 7063, 7064, 7065, 7066,
-    7067, 7069, 7070, 7071, 7072, 7073, 7074, 7075, 7076, 7077, 7078,
-    7079, 7080, 7081, 7083, 7084, 7085, 7086, 7087, 7088, 7089, 7090,
-    7091, 7092, 7093, 7094, 7095, 7096, 7097, 7098, 7099, 7100, 7101,
-    7102, 7103, 7104, 7105, 7106, 7107, 7108, 7109, 7109, 7110, 7111,
-    7112, 7113, 7114, 7115, 7116, 7117, 7118, 7119, 7119, 7120, 7121,
-    7122, 7123, 7124, 7125, 7125, 7126, 7127, 7128, 7129, 7130, 7130,
-    7131, 7132, 7133, 7134, 7134, 7135, 7136, 7137, 7138, 7138, 7139,
-    7140, 7140, 7141, 7142, 7143, 7143, 7144, 7145, 7145, 7146, 7147,
-    7148, 7148, 7149, 7150, 7150, 7151, 7151, 7152, 7153, 7153, 7154,
-    7155, 7155, 7156, 7156, 7157, 7157, 7158, 7159, 7159, 7160, 7160,
-    7161, 7161, 7162, 7162, 7163, 7163, 7164, 7164, 7165, 7165, 7166,
-    7166, 7167, 7167, 7168, 7168, 7168, 7169, 7169, 7170, 7170, 7170,
-    7171, 7171, 7172, 7172, 7172, 7173, 7173, 7173, 7174, 7174, 7174,
-    7175, 7175, 7175, 7176, 7176, 7176, 7177, 7177, 7177, 7177, 7178,
-    7178, 7178, 7178, 7179, 7179, 7179, 7179, 7179, 7180, 7180, 7180,
-    7180, 7180, 7181, 7181, 7181, 7181, 7181, 7181, 7181, 7182, 7182,
-    7182, 7182, 7182, 7182, 7182, 7182, 7182, 7183, 7183, 7183, 7183,
-    7183, 7183, 7183, 7183, 7183, 7183, 7183, 7183, 7183, 7183, 7183,
-    7183, 7183, 7183, 7183, 7183, 7183, 7183, 7183, 7183, 7183, 7183,
-    7183, 7183, 7183, 7183, 7183, 7183, 7183, 7183, 7183, 7183, 7183,
-    7183, 7183, 7183, 7183, 7183, 7183, 7183, 7182, 7182, 7182, 7182,
-    7182, 7182, 7182, 7182, 7182, 7182, 7182, 7182, 7182, 7182, 7181,
-    7181, 7181, 7181, 7181, 7181, 7181, 7181, 7181, 7181, 7181, 7181,
-    7181, 7181, 7181, 7180, 7180, 7180, 7180, 7180, 7180, 7180, 7180,
-    7180, 7180, 7180, 7180, 7180, 7180, 7180, 7180, 7180, 7180, 7180,
-    7180, 7180, 7180, 7180, 7180, 7180, 7180, 7180, 7180, 7180, 7180,
-    7180, 7180, 7180, 7180, 7180, 7181, 7181, 7181, 7181, 7181, 7181,
-    7181, 7181, 7181, 7182, 7182, 7182, 7182, 7182, 7182, 7183, 7183,
-    7183, 7183, 7184, 7184, 7184, 7184, 7185, 7185, 7185, 7186, 7186,
-    7186, 7187, 7187, 7187, 7188, 7188, 7188, 7189, 7189, 7190, 7190,
-    7191, 7191, 7192, 7192, 7193, 7193, 7194, 7194, 7195, 7195, 7196,
-    7196, 7197, 7198, 7198, 7199, 7200, 7200, 7201, 7202, 7203, 7203,
-    7204, 7205, 7206, 7207, 7207, 7208, 7209, 7210, 7211, 7212, 7213,
-    7214, 7215, 7216, 7217, 7218, 7219, 7220, 7221, 7222, 7223, 7224,
-    7225, 7227, 7228, 7229, 7230, 7231, 7233, 7234, 7235, 7237, 7238,
-    7239, 7241, 7242, 7244, 7245, 7247, 7248, 7250, 7251, 7253, 7254,
-    7256, 7257, 7259, 7261, 7262, 7264, 7266, 7268, 7269, 7271, 7273,
-    7275, 7277, 7279, 7281, 7282, 7284, 7286, 7288, 7290, 7292, 7295,
-    7297, 7299, 7301, 7303, 7305, 7307, 7310, 7312, 7314, 7316, 7319,
-    7321, 7324, 7326, 7328, 7331, 7333, 7336, 7338, 7341, 7343, 7346,
-    7349, 7351, 7354, 7357, 7359, 7362, 7365, 7367, 7370, 7373, 7376,
-    7379, 7382, 7385, 7388, 7391, 7393, 7396, 7400, 7403, 7406, 7409,
-    7412, 7415, 7418, 7421, 7425, 7428, 7431, 7434, 7438, 7441, 7444,
-    7448, 7451, 7455, 7458, 7461, 7465, 7468, 7472, 7476, 7479, 7483,
-    7486, 7490, 7494, 7497, 7501, 7505, 7508, 7512, 7516, 7520, 7524,
-    7527, 7531, 7535, 7539, 7543, 7547, 7551, 7555, 7559, 7563, 7567,
-    7571, 7575, 7579, 7583, 7587, 7591, 7595, 7599, 7604, 7608, 7612,
-    7616, 7620, 7625, 7629, 7633, 7637, 7642, 7646, 7650, 7655, 7659,
-    7663, 7668, 7672, 7676, 7681, 7685, 7689, 7694, 7698, 7703, 7707,
-    7712, 7716, 7721, 7725, 7729, 7734, 7738, 7743, 7747, 7752, 7756,
-    7761, 7765, 7770, 7774, 7779, 7783, 7788, 7792, 7797, 7802, 7806,
-    7811, 7815, 7820, 7824, 7829, 7833, 7838, 7842, 7847, 7851, 7856,
-    7860, 7865, 7869, 7873, 7878, 7882, 7887, 7891, 7896, 7900, 7904,
-    7909, 7913, 7918, 7922, 7926, 7931, 7935, 7939, 7943, 7948, 7952,
-    7956, 7960, 7965, 7969, 7973, 7977, 7981, 7985, 7989, 7993, 7997,
-    8001, 8005, 8009, 8013, 8017, 8021, 8025, 8029, 8032, 8036, 8040,
-    8044, 8047, 8051, 8055, 8058, 8062, 8065, 8069, 8072, 8076, 8079,
-    8082, 8086, 8089, 8092, 8095, 8098, 8102, 8105, 8108, 8111, 8114,
-    8116, 8119, 8122, 8125, 8128, 8130, 8133, 8135, 8138, 8140, 8143,
-    8145, 8147, 8150, 8152, 8154, 8156, 8158, 8160, 8162, 8164, 8166,
-    8168, 8169, 8171, 8173, 8174, 8176, 8177, 8178, 8180, 8181, 8182,
-    8183, 8184, 8185, 8186, 8187, 8187, 8188, 8189, 8189, 8190, 8190,
-    8190, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8190, 8190, 8190,
-    8189, 8188, 8188, 8187, 8186, 8185, 8184, 8183, 8182, 8181, 8179,
-    8178, 8176, 8175, 8173, 8171, 8169, 8167, 8165, 8163, 8161, 8159,
-    8156, 8154, 8151, 8148, 8145, 8143, 8140, 8136, 8133, 8130, 8127,
-    8123, 8119, 8116, 8112, 8108, 8104, 8100, 8096, 8091, 8087, 8083,
-    8078, 8073, 8068, 8063, 8058, 8053, 8048, 8043, 8037, 8032, 8026,
-    8020, 8014, 8008, 8002, 7996, 7989, 7983, 7976, 7970, 7963, 7956,
-    7949, 7942, 7935, 7927, 7920, 7912, 7904, 7897, 7889, 7881, 7872,
-    7864, 7856, 7847, 7838, 7830, 7821, 7812, 7803, 7793, 7784, 7775,
-    7765, 7755, 7745, 7735, 7725, 7715, 7705, 7694, 7684, 7673, 7662,
-    7651, 7640, 7629, 7618, 7606, 7595, 7583, 7572, 7560, 7548, 7535,
-    7523, 7511, 7498, 7486, 7473, 7460, 7447, 7434, 7421, 7407, 7394,
-    7380, 7367, 7353, 7339, 7325, 7310, 7296, 7282, 7267, 7252, 7238,
-    7223, 7208, 7193, 7177, 7162, 7146, 7131, 7115, 7099, 7083, 7067,
-    7051, 7034, 7018, 7001, 6985, 6968, 6951, 6934, 6917, 6900, 6882,
-    6865, 6847, 6830, 6812, 6794, 6776, 6758, 6739, 6721, 6703, 6684,
-    6665, 6647, 6628, 6609, 6590, 6570, 6551, 6532, 6512, 6493, 6473,
-    6453, 6433, 6413, 6393, 6373, 6353, 6332, 6312, 6291, 6270, 6250,
-    6229, 6208, 6187, 6166, 6144, 6123, 6102, 6080, 6058, 6037, 6015,
-    5993, 5971, 5949, 5927, 5905, 5883, 5860, 5838, 5815, 5793, 5770,
-    5747, 5725, 5702, 5679, 5656, 5633, 5610, 5586, 5563, 5540, 5516,
-    5493, 5469, 5446, 5422, 5398, 5375, 5351, 5327, 5303, 5279, 5255,
-    5231, 5206, 5182, 5158, 5134, 5109, 5085, 5060, 5036, 5011, 4987,
-    4962, 4937, 4913, 4888, 4863, 4838, 4814, 4789, 4764, 4739, 4714,
-    4689, 4664, 4639, 4614, 4588, 4563, 4538, 4513, 4488, 4463, 4437,
-    4412, 4387, 4361, 4336, 4311, 4286, 4260, 4235, 4210, 4184, 4159, 4134
-]
-
-tri10 = [
-    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 5, 5, 6, 6,
-    7, 8, 8, 9, 10, 10, 11, 12, 13, 13, 14, 15, 16, 17, 18, 19, 20, 21,
-    22, 23, 24, 25, 26, 27, 28, 30, 31, 32, 33, 34, 36, 37, 38, 40, 41,
-    42, 44, 45, 47, 48, 49, 51, 52, 54, 55, 57, 58, 60, 62, 63, 65, 66,
-    68, 70, 71, 73, 75, 77, 78, 80, 82, 84, 85, 87, 89, 91, 93, 94, 96,
-    98, 100, 102, 104, 106, 108, 109, 111, 113, 115, 117, 119, 121, 123,
-    125, 127, 129, 131, 133, 135, 137, 139, 141, 143, 145, 147, 149, 152,
-    154, 156, 158, 160, 162, 164, 166, 168, 170, 172, 175, 177, 179, 181,
-    183, 185, 187, 190, 192, 194, 196, 198, 200, 202, 205, 207, 209, 211,
-    213, 215, 218, 220, 222, 224, 226, 228, 231, 233, 235, 237, 239, 242,
-    244, 246, 248, 250, 252, 255, 257, 259, 261, 263, 266, 268, 270, 272,
-    274, 276, 279, 281, 283, 285, 287, 290, 292, 294, 296, 298, 300, 303,
-    305, 307, 309, 311, 313, 316, 318, 320, 322, 324, 326, 329, 331, 333,
-    335, 337, 339, 341, 344, 346, 348, 350, 352, 354, 357, 359, 361, 363,
-    365, 367, 369, 372, 374, 376, 378, 380, 382, 384, 386, 389, 391, 393,
-    395, 397, 399, 401, 403, 405, 408, 410, 412, 414, 416, 418, 420, 422,
-    424, 427, 429, 431, 433, 435, 437, 439, 441, 443, 445, 448, 450, 452,
-    454, 456, 458, 460, 462, 464, 466, 468, 470, 473, 475, 477, 479, 481,
-    483, 485, 487, 489, 491, 493, 495, 497, 499, 502, 504, 506, 508, 510,
-    512, 514, 516, 518, 520, 522, 524, 526, 528, 530, 532, 534, 536, 539,
-    541, 543, 545, 547, 549, 551, 553, 555, 557, 559, 561, 563, 565, 567,
-    569, 571, 573, 575, 577, 579, 582, 584, 586, 588, 590, 592, 594, 596,
-    598, 600, 602, 604, 606, 608, 610, 612, 614, 616, 618, 620, 622, 624,
-    626, 628, 630, 632, 634, 637, 639, 641, 643, 645, 647, 649, 651, 653,
-    655, 657, 659, 661, 663, 665, 667, 669, 671, 673, 675, 677, 679, 681,
-    683, 685, 687, 689, 691, 693, 695, 697, 699, 702, 704, 706, 708, 710,
-    712, 714, 716, 718, 720, 722, 724, 726, 728, 730, 732, 734, 736, 738,
-    740, 742, 744, 746, 748, 750, 752, 754, 756, 758, 760, 762, 764, 766,
-    769, 771, 773, 775, 777, 779, 781, 783, 785, 787, 789, 791, 793, 795,
-    797, 799, 801, 803, 805, 807, 809, 811, 813, 815, 817, 819, 821, 823,
-    825, 827, 829, 831, 834, 836, 838, 840, 842, 844, 846, 848, 850, 852,
-    854, 856, 858, 860, 862, 864, 866, 868, 870, 872, 874, 876, 878, 880,
-    882, 884, 886, 888, 890, 892, 895, 897, 899, 901, 903, 905, 907, 909,
-    911, 913, 915, 917, 919, 921, 923, 925, 927, 929, 931, 933, 935, 937,
-    939, 941, 943, 945, 947, 949, 951, 954, 956, 958, 960, 962, 964, 966,
-    968, 970, 972, 974, 976, 978, 980, 982, 984, 986, 988, 990, 992, 994,
-    996, 998, 1000, 1002, 1004, 1006, 1008, 1011, 1013, 1015, 1017, 1019,
-    1021, 1023, 1025, 1027, 1029, 1031, 1033, 1035, 1037, 1039, 1041,
-    1043, 1045, 1047, 1049, 1051, 1053, 1055, 1057, 1059, 1061, 1063,
-    1065, 1068, 1070, 1072, 1074, 1076, 1078, 1080, 1082, 1084, 1086,
-    1088, 1090, 1092, 1094, 1096, 1098, 1100, 1102, 1104, 1106, 1108,
-    1110, 1112, 1114, 1116, 1118, 1120, 1123, 1125, 1127, 1129, 1131,
-    1133, 1135, 1137, 1139, 1141, 1143, 1145, 1147, 1149, 1151, 1153,
-    1155, 1157, 1159, 1161, 1163, 1165, 1167, 1169, 1171, 1173, 1175,
-    1178, 1180, 1182, 1184, 1186, 1188, 1190, 1192, 1194, 1196, 1198,
-    1200, 1202, 1204, 1206, 1208, 1210, 1212, 1214, 1216, 1218, 1220,
-    1222, 1224, 1226, 1228, 1230, 1232, 1235, 1237, 1239, 1241, 1243,
-    1245, 1247, 1249, 1251, 1253, 1255, 1257, 1259, 1261, 1263, 1265,
-    1267, 1269, 1271, 1273, 1275, 1277, 1279, 1281, 1283, 1285, 1287,
-    1290, 1292, 1294, 1296, 1298, 1300, 1302, 1304, 1306, 1308, 1310,
-    1312, 1314, 1316, 1318, 1320, 1322, 1324, 1326, 1328, 1330, 1332,
-    1334, 1336, 1338, 1340, 1342, 1345, 1347, 1349, 1351, 1353, 1355,
-    1357, 1359, 1361, 1363, 1365, 1367, 1369, 1371, 1373, 1375, 1377,
-    1379, 1381, 1383, 1385, 1387, 1389, 1391, 1393, 1395, 1397, 1399,
-    1402, 1404, 1406, 1408, 1410, 1412, 1414, 1416, 1418, 1420, 1422,
-    1424, 1426, 1428, 1430, 1432, 1434, 1436, 1438, 1440, 1442, 1444,
-    1446, 1448, 1450, 1452, 1454, 1457, 1459, 1461, 1463, 1465, 1467,
-    1469, 1471, 1473, 1475, 1477, 1479, 1481, 1483, 1485, 1487, 1489,
-    1491, 1493, 1495, 1497, 1499, 1501, 1503, 1505, 1507, 1509, 1512,
-    1514, 1516, 1518, 1520, 1522, 1524, 1526, 1528, 1530, 1532, 1534,
-    1536, 1538, 1540, 1542, 1544, 1546, 1548, 1550, 1552, 1554, 1556,
-    1558, 1560, 1562, 1564, 1566, 1569, 1571, 1573, 1575, 1577, 1579,
-    1581, 1583, 1585, 1587, 1589, 1591, 1593, 1595, 1597, 1599, 1601,
-    1603, 1605, 1607, 1609, 1611, 1613, 1615, 1617, 1619, 1621, 1624,
-    1626, 1628, 1630, 1632, 1634, 1636, 1638, 1640, 1642, 1644, 1646,
-    1648, 1650, 1652, 1654, 1656, 1658, 1660, 1662, 1664, 1666, 1668,
-    1670, 1672, 1674, 1676, 1678, 1681, 1683, 1685, 1687, 1689, 1691,
-    1693, 1695, 1697, 1699, 1701, 1703, 1705, 1707, 1709, 1711, 1713,
-    1715, 1717, 1719, 1721, 1723, 1725, 1727, 1729, 1731, 1733, 1736,
-    1738, 1740, 1742, 1744, 1746, 1748, 1750, 1752, 1754, 1756, 1758,
-    1760, 1762, 1764, 1766, 1768, 1770, 1772, 1774, 1776, 1778, 1780,
-    1782, 1784, 1786, 1788, 1790, 1793, 1795, 1797, 1799, 1801, 1803,
-    1805, 1807, 1809, 1811, 1813, 1815, 1817, 1819, 1821, 1823, 1825,
-    1827, 1829, 1831, 1833, 1835, 1837, 1839, 1841, 1843, 1845, 1848,
-    1850, 1852, 1854, 1856, 1858, 1860, 1862, 1864, 1866, 1868, 1870,
-    1872, 1874, 1876, 1878, 1880, 1882, 1884, 1886, 1888, 1890, 1892,
-    1894, 1896, 1898, 1900, 1902, 1905, 1907, 1909, 1911, 1913, 1915,
-    1917, 1919, 1921, 1923, 1925, 1927, 1929, 1931, 1933, 1935, 1937,
-    1939, 1941, 1943, 1945, 1947, 1949, 1951, 1953, 1955, 1957, 1960,
-    1962, 1964, 1966, 1968, 1970, 1972, 1974, 1976, 1978, 1980, 1982,
-    1984, 1986, 1988, 1990, 1992, 1994, 1996, 1998, 2000, 2002, 2004,
-    2006, 2008, 2010, 2012, 2015, 2017, 2019, 2021, 2023, 2025, 2027,
-    2029, 2031, 2033, 2035, 2037, 2039, 2041, 2043, 2045, 2047, 2049,
-    2051, 2053, 2055, 2057, 2059, 2061, 2063, 2065, 2067, 2069, 2072,
-    2074, 2076, 2078, 2080, 2082, 2084, 2086, 2088, 2090, 2092, 2094,
-    2096, 2098, 2100, 2102, 2104, 2106, 2108, 2110, 2112, 2114, 2116,
-    2118, 2120, 2122, 2124, 2127, 2129, 2131, 2133, 2135, 2137, 2139,
-    2141, 2143, 2145, 2147, 2149, 2151, 2153, 2155, 2157, 2159, 2161,
-    2163, 2165, 2167, 2169, 2171, 2173, 2175, 2177, 2179, 2181, 2184,
-    2186, 2188, 2190, 2192, 2194, 2196, 2198, 2200, 2202, 2204, 2206,
-    2208, 2210, 2212, 2214, 2216, 2218, 2220, 2222, 2224, 2226, 2228,
-    2230, 2232, 2234, 2236, 2239, 2241, 2243, 2245, 2247, 2249, 2251,
-    2253, 2255, 2257, 2259, 2261, 2263, 2265, 2267, 2269, 2271, 2273,
-    2275, 2277, 2279, 2281, 2283, 2285, 2287, 2289, 2291, 2293, 2296,
-    2298, 2300, 2302, 2304, 2306, 2308, 2310, 2312, 2314, 2316, 2318,
-    2320, 2322, 2324, 2326, 2328, 2330, 2332, 2334, 2336, 2338, 2340,
-    2342, 2344, 2346, 2348, 2351, 2353, 2355, 2357, 2359, 2361, 2363,
-    2365, 2367, 2369, 2371, 2373, 2375, 2377, 2379, 2381, 2383, 2385,
-    2387, 2389, 2391, 2393, 2395, 2397, 2399, 2401, 2403, 2406, 2408,
-    2410, 2412, 2414, 2416, 2418, 2420, 2422, 2424, 2426, 2428, 2430,
-    2432, 2434, 2436, 2438, 2440, 2442, 2444, 2446, 2448, 2450, 2452,
-    2454, 2456, 2458, 2460, 2463, 2465, 2467, 2469, 2471, 2473, 2475,
-    2477, 2479, 2481, 2483, 2485, 2487, 2489, 2491, 2493, 2495, 2497,
-    2499, 2501, 2503, 2505, 2507, 2509, 2511, 2513, 2515, 2518, 2520,
-    2522, 2524, 2526, 2528, 2530, 2532, 2534, 2536, 2538, 2540, 2542,
-    2544, 2546, 2548, 2550, 2552, 2554, 2556, 2558, 2560, 2562, 2564,
-    2566, 2568, 2570, 2572, 2575, 2577, 2579, 2581, 2583, 2585, 2587,
-    2589, 2591, 2593, 2595, 2597, 2599, 2601, 2603, 2605, 2607, 2609,
-    2611, 2613, 2615, 2617, 2619, 2621, 2623, 2625, 2627, 2630, 2632,
-    2634, 2636, 2638, 2640, 2642, 2644, 2646, 2648, 2650, 2652, 2654,
-    2656, 2658, 2660, 2662, 2664, 2666, 2668, 2670, 2672, 2674, 2676,
-    2678, 2680, 2682, 2684, 2687, 2689, 2691, 2693, 2695, 2697, 2699,
-    2701, 2703, 2705, 2707, 2709, 2711, 2713, 2715, 2717, 2719, 2721,
-    2723, 2725, 2727, 2729, 2731, 2733, 2735, 2737, 2739, 2742, 2744,
-    2746, 2748, 2750, 2752, 2754, 2756, 2758, 2760, 2762, 2764, 2766,
-    2768, 2770, 2772, 2774, 2776, 2778, 2780, 2782, 2784, 2786, 2788,
-    2790, 2792, 2794, 2796, 2799, 2801, 2803, 2805, 2807, 2809, 2811,
-    2813, 2815, 2817, 2819, 2821, 2823, 2825, 2827, 2829, 2831, 2833,
-    2835, 2837, 2839, 2841, 2843, 2845, 2847, 2849, 2851, 2854, 2856,
-    2858, 2860, 2862, 2864, 2866, 2868, 2870, 2872, 2874, 2876, 2878,
-    2880, 2882, 2884, 2886, 2888, 2890, 2892, 2894, 2896, 2898, 2900,
-    2902, 2904, 2906, 2909, 2911, 2913, 2915, 2917, 2919, 2921, 2923,
-    2925, 2927, 2929, 2931, 2933, 2935, 2937, 2939, 2941, 2943, 2945,
-    2947, 2949, 2951, 2953, 2955, 2957, 2959, 2961, 2963, 2966, 2968,
-    2970, 2972, 2974, 2976, 2978, 2980, 2982, 2984, 2986, 2988, 2990,
-    2992, 2994, 2996, 2998, 3000, 3002, 3004, 3006, 3008, 3010, 3012,
-    3014, 3016, 3018, 3021, 3023, 3025, 3027, 3029, 3031, 3033, 3035,
-    3037, 3039, 3041, 3043, 3045, 3047, 3049, 3051, 3053, 3055, 3057,
-    3059, 3061, 3063, 3065, 3067, 3069, 3071, 3073, 3075, 3078, 3080,
-    3082, 3084, 3086, 3088, 3090, 3092, 3094, 3096, 3098, 3100, 3102,
-    3104, 3106, 3108, 3110, 3112, 3114, 3116, 3118, 3120, 3122, 3124,
-    3126, 3128, 3130, 3133, 3135, 3137, 3139, 3141, 3143, 3145, 3147,
-    3149, 3151, 3153, 3155, 3157, 3159, 3161, 3163, 3165, 3167, 3169,
-    3171, 3173, 3175, 3177, 3179, 3181, 3183, 3185, 3187, 3190, 3192,
-    3194, 3196, 3198, 3200, 3202, 3204, 3206, 3208, 3210, 3212, 3214,
-    3216, 3218, 3220, 3222, 3224, 3226, 3228, 3230, 3232, 3234, 3236,
-    3238, 3240, 3242, 3245, 3247, 3249, 3251, 3253, 3255, 3257, 3259,
-    3261, 3263, 3265, 3267, 3269, 3271, 3273, 3275, 3277, 3279, 3281,
-    3283, 3285, 3287, 3289, 3291, 3293, 3295, 3297, 3300, 3302, 3304,
-    3306, 3308, 3310, 3312, 3314, 3316, 3318, 3320, 3322, 3324, 3326,
-    3328, 3330, 3332, 3334, 3336, 3338, 3340, 3342, 3344, 3346, 3348,
-    3350, 3352, 3354, 3357, 3359, 3361, 3363, 3365, 3367, 3369, 3371,
-    3373, 3375, 3377, 3379, 3381, 3383, 3385, 3387, 3389, 3391, 3393,
-    3395, 3397, 3399, 3401, 3403, 3405, 3407, 3409, 3412, 3414, 3416,
-    3418, 3420, 3422, 3424, 3426, 3428, 3430, 3432, 3434, 3436, 3438,
-    3440, 3442, 3444, 3446, 3448, 3450, 3452, 3454, 3456, 3458, 3460,
-    3462, 3464, 3466, 3469, 3471, 3473, 3475, 3477, 3479, 3481, 3483,
-    3485, 3487, 3489, 3491, 3493, 3495, 3497, 3499, 3501, 3503, 3505,
-    3507, 3509, 3511, 3513, 3515, 3517, 3519, 3521, 3524, 3526, 3528,
-    3530, 3532, 3534, 3536, 3538, 3540, 3542, 3544, 3546, 3548, 3550,
-    3552, 3554, 3556, 3558, 3560, 3562, 3564, 3566, 3568, 3570, 3572,
-    3574, 3576, 3578, 3581, 3583, 3585, 3587, 3589, 3591, 3593, 3595,
-    3597, 3599, 3601, 3603, 3605, 3607, 3609, 3611, 3613, 3615, 3617,
-    3619, 3621, 3623, 3625, 3627, 3629, 3631, 3633, 3636, 3638, 3640,
-    3642, 3644, 3646, 3648, 3650, 3652, 3654, 3656, 3658, 3660, 3662,
-    3664, 3666, 3668, 3670, 3672, 3674, 3676, 3678, 3680, 3682, 3684,
-    3686, 3688, 3691, 3693, 3695, 3697, 3699, 3701, 3703, 3705, 3707,
-    3709, 3711, 3713, 3715, 3717, 3719, 3721, 3723, 3725, 3727, 3729,
-    3731, 3733, 3735, 3737, 3739, 3741, 3743, 3745, 3748, 3750, 3752,
-    3754, 3756, 3758, 3760, 3762, 3764, 3766, 3768, 3770, 3772, 3774,
-    3776, 3778, 3780, 3782, 3784, 3786, 3788, 3790, 3792, 3794, 3796,
-    3798, 3800, 3803, 3805, 3807, 3809, 3811, 3813, 3815, 3817, 3819,
-    3821, 3823, 3825, 3827, 3829, 3831, 3833, 3835, 3837, 3839, 3841,
-    3843, 3845, 3847, 3849, 3851, 3853, 3855, 3857, 3860, 3862, 3864,
-    3866, 3868, 3870, 3872, 3874, 3876, 3878, 3880, 3882, 3884, 3886,
-    3888, 3890, 3892, 3894, 3896, 3898, 3900, 3902, 3904, 3906, 3908,
-    3910, 3912, 3915, 3917, 3919, 3921, 3923, 3925, 3927, 3929, 3931,
-    3933, 3935, 3937, 3939, 3941, 3943, 3945, 3947, 3949, 3951, 3953,
-    3955, 3957, 3959, 3961, 3963, 3965, 3967, 3969, 3972, 3974, 3976,
-    3978, 3980, 3982, 3984, 3986, 3988, 3990, 3992, 3994, 3996, 3998,
-    4000, 4002, 4004, 4006, 4008, 4010, 4012, 4014, 4016, 4018, 4020,
-    4022, 4024, 4027, 4029, 4031, 4033, 4035, 4037, 4039, 4041, 4043,
-    4045, 4047, 4049, 4051, 4053, 4055, 4057, 4059, 4061, 4063, 4065,
-    4067, 4069, 4071, 4073, 4075, 4077, 4079, 4081, 4084, 4086, 4088,
-    4090, 4092, 4094, 4096, 4098, 4100, 4102, 4104, 4106, 4108, 4110,
-    4112, 4114, 4116, 4118, 4120, 4122, 4124, 4126, 4128, 4130, 4132,
-    4134, 4136, 4139, 4141, 4143, 4145, 4147, 4149, 4151, 4153, 4155,
-    4157, 4159, 4161, 4163, 4165, 4167, 4169, 4171, 4173, 4175, 4177,
-    4179, 4181, 4183, 4185, 4187, 4189, 4191, 4194, 4196, 4198, 4200,
-    4202, 4204, 4206, 4208, 4210, 4212, 4214, 4216, 4218, 4220, 4222,
-    4224, 4226, 4228, 4230, 4232, 4234, 4236, 4238, 4240, 4242, 4244,
-    4246, 4248, 4251, 4253, 4255, 4257, 4259, 4261, 4263, 4265, 4267,
-    4269, 4271, 4273, 4275, 4277, 4279, 4281, 4283, 4285, 4287, 4289,
-    4291, 4293, 4295, 4297, 4299, 4301, 4303, 4306, 4308, 4310, 4312,
-    4314, 4316, 4318, 4320, 4322, 4324, 4326, 4328, 4330, 4332, 4334,
-    4336, 4338, 4340, 4342, 4344, 4346, 4348, 4350, 4352, 4354, 4356,
-    4358, 4360, 4363, 4365, 4367, 4369, 4371, 4373, 4375, 4377, 4379,
-    4381, 4383, 4385, 4387, 4389, 4391, 4393, 4395, 4397, 4399, 4401,
-    4403, 4405, 4407, 4409, 4411, 4413, 4415, 4418, 4420, 4422, 4424,
-    4426, 4428, 4430, 4432, 4434, 4436, 4438, 4440, 4442, 4444, 4446,
-    4448, 4450, 4452, 4454, 4456, 4458, 4460, 4462, 4464, 4466, 4468,
-    4470, 4472, 4475, 4477, 4479, 4481, 4483, 4485, 4487, 4489, 4491,
-    4493, 4495, 4497, 4499, 4501, 4503, 4505, 4507, 4509, 4511, 4513,
-    4515, 4517, 4519, 4521, 4523, 4525, 4527, 4530, 4532, 4534, 4536,
-    4538, 4540, 4542, 4544, 4546, 4548, 4550, 4552, 4554, 4556, 4558,
-    4560, 4562, 4564, 4566, 4568, 4570, 4572, 4574, 4576, 4578, 4580,
-    4582, 4585, 4587, 4589, 4591, 4593, 4595, 4597, 4599, 4601, 4603,
-    4605, 4607, 4609, 4611, 4613, 4615, 4617, 4619, 4621, 4623, 4625,
-    4627, 4629, 4631, 4633, 4635, 4637, 4639, 4642, 4644, 4646, 4648,
-    4650, 4652, 4654, 4656, 4658, 4660, 4662, 4664, 4666, 4668, 4670,
-    4672, 4674, 4676, 4678, 4680, 4682, 4684, 4686, 4688, 4690, 4692,
-    4694, 4697, 4699, 4701, 4703, 4705, 4707, 4709, 4711, 4713, 4715,
-    4717, 4719, 4721, 4723, 4725, 4727, 4729, 4731, 4733, 4735, 4737,
-    4739, 4741, 4743, 4745, 4747, 4749, 4751, 4754, 4756, 4758, 4760,
-    4762, 4764, 4766, 4768, 4770, 4772, 4774, 4776, 4778, 4780, 4782,
-    4784, 4786, 4788, 4790, 4792, 4794, 4796, 4798, 4800, 4802, 4804,
-    4806, 4809, 4811, 4813, 4815, 4817, 4819, 4821, 4823, 4825, 4827,
-    4829, 4831, 4833, 4835, 4837, 4839, 4841, 4843, 4845, 4847, 4849,
-    4851, 4853, 4855, 4857, 4859, 4861, 4863, 4866, 4868, 4870, 4872,
-    4874, 4876, 4878, 4880, 4882, 4884, 4886, 4888, 4890, 4892, 4894,
-    4896, 4898, 4900, 4902, 4904, 4906, 4908, 4910, 4912, 4914, 4916,
-    4918, 4921, 4923, 4925, 4927, 4929, 4931, 4933, 4935, 4937, 4939,
-    4941, 4943, 4945, 4947, 4949, 4951, 4953, 4955, 4957, 4959, 4961,
-    4963, 4965, 4967, 4969, 4971, 4973, 4976, 4978, 4980, 4982, 4984,
-    4986, 4988, 4990, 4992, 4994, 4996, 4998, 5000, 5002, 5004, 5006,
-    5008, 5010, 5012, 5014, 5016, 5018, 5020, 5022, 5024, 5026, 5028,
-    5030, 5033, 5035, 5037, 5039, 5041, 5043, 5045, 5047, 5049, 5051,
-    5053, 5055, 5057, 5059, 5061, 5063, 5065, 5067, 5069, 5071, 5073,
-    5075, 5077, 5079, 5081, 5083, 5085, 5088, 5090, 5092, 5094, 5096,
-    5098, 5100, 5102, 5104, 5106, 5108, 5110, 5112, 5114, 5116, 5118,
-    5120, 5122, 5124, 5126, 5128, 5130, 5132, 5134, 5136, 5138, 5140,
-    5142, 5145, 5147, 5149, 5151, 5153, 5155, 5157, 5159, 5161, 5163,
-    5165, 5167, 5169, 5171, 5173, 5175, 5177, 5179, 5181, 5183, 5185,
-    5187, 5189, 5191, 5193, 5195, 5197, 5200, 5202, 5204, 5206, 5208,
-    5210, 5212, 5214, 5216, 5218, 5220, 5222, 5224, 5226, 5228, 5230,
-    5232, 5234, 5236, 5238, 5240, 5242, 5244, 5246, 5248, 5250, 5252,
-    5254, 5257, 5259, 5261, 5263, 5265, 5267, 5269, 5271, 5273, 5275,
-    5277, 5279, 5281, 5283, 5285, 5287, 5289, 5291, 5293, 5295, 5297,
-    5299, 5301, 5303, 5305, 5307, 5309, 5312, 5314, 5316, 5318, 5320,
-    5322, 5324, 5326, 5328, 5330, 5332, 5334, 5336, 5338, 5340, 5342,
-    5344, 5346, 5348, 5350, 5352, 5354, 5356, 5358, 5360, 5362, 5364,
-    5366, 5369, 5371, 5373, 5375, 5377, 5379, 5381, 5383, 5385, 5387,
-    5389, 5391, 5393, 5395, 5397, 5399, 5401, 5403, 5405, 5407, 5409,
-    5411, 5413, 5415, 5417, 5419, 5421, 5424, 5426, 5428, 5430, 5432,
-    5434, 5436, 5438, 5440, 5442, 5444, 5446, 5448, 5450, 5452, 5454,
-    5456, 5458, 5460, 5462, 5464, 5466, 5468, 5470, 5472, 5474, 5476,
-    5479, 5481, 5483, 5485, 5487, 5489, 5491, 5493, 5495, 5497, 5499,
-    5501, 5503, 5505, 5507, 5509, 5511, 5513, 5515, 5517, 5519, 5521,
-    5523, 5525, 5527, 5529, 5531, 5533, 5536, 5538, 5540, 5542, 5544,
-    5546, 5548, 5550, 5552, 5554, 5556, 5558, 5560, 5562, 5564, 5566,
-    5568, 5570, 5572, 5574, 5576, 5578, 5580, 5582, 5584, 5586, 5588,
-    5591, 5593, 5595, 5597, 5599, 5601, 5603, 5605, 5607, 5609, 5611,
-    5613, 5615, 5617, 5619, 5621, 5623, 5625, 5627, 5629, 5631, 5633,
-    5635, 5637, 5639, 5641, 5643, 5645, 5648, 5650, 5652, 5654, 5656,
-    5658, 5660, 5662, 5664, 5666, 5668, 5670, 5672, 5674, 5676, 5678,
-    5680, 5682, 5684, 5686, 5688, 5690, 5692, 5694, 5696, 5698, 5700,
-    5703, 5705, 5707, 5709, 5711, 5713, 5715, 5717, 5719, 5721, 5723,
-    5725, 5727, 5729, 5731, 5733, 5735, 5737, 5739, 5741, 5743, 5745,
-    5747, 5749, 5751, 5753, 5755, 5757, 5760, 5762, 5764, 5766, 5768,
-    5770, 5772, 5774, 5776, 5778, 5780, 5782, 5784, 5786, 5788, 5790,
-    5792, 5794, 5796, 5798, 5800, 5802, 5804, 5806, 5808, 5810, 5812,
-    5815, 5817, 5819, 5821, 5823, 5825, 5827, 5829, 5831, 5833, 5835,
-    5837, 5839, 5841, 5843, 5845, 5847, 5849, 5851, 5853, 5855, 5857,
-    5859, 5861, 5863, 5865, 5867, 5870, 5872, 5874, 5876, 5878, 5880,
-    5882, 5884, 5886, 5888, 5890, 5892, 5894, 5896, 5898, 5900, 5902,
-    5904, 5906, 5908, 5910, 5912, 5914, 5916, 5918, 5920, 5922, 5924,
-    5927, 5929, 5931, 5933, 5935, 5937, 5939, 5941, 5943, 5945, 5947,
-    5949, 5951, 5953, 5955, 5957, 5959, 5961, 5963, 5965, 5967, 5969,
-    5971, 5973, 5975, 5977, 5979, 5982, 5984, 5986, 5988, 5990, 5992,
-    5994, 5996, 5998, 6000, 6002, 6004, 6006, 6008, 6010, 6012, 6014,
-    6016, 6018, 6020, 6022, 6024, 6026, 6028, 6030, 6032, 6034, 6036,
-    6039, 6041, 6043, 6045, 6047, 6049, 6051, 6053, 6055, 6057, 6059,
-    6061, 6063, 6065, 6067, 6069, 6071, 6073, 6075, 6077, 6079, 6081,
-    6083, 6085, 6087, 6089, 6091, 6094, 6096, 6098, 6100, 6102, 6104,
-    6106, 6108, 6110, 6112, 6114, 6116, 6118, 6120, 6122, 6124, 6126,
-    6128, 6130, 6132, 6134, 6136, 6138, 6140, 6142, 6144, 6146, 6148,
-    6151, 6153, 6155, 6157, 6159, 6161, 6163, 6165, 6167, 6169, 6171,
-    6173, 6175, 6177, 6179, 6181, 6183, 6185, 6187, 6189, 6191, 6193,
-    6195, 6197, 6199, 6201, 6203, 6206, 6208, 6210, 6212, 6214, 6216,
-    6218, 6220, 6222, 6224, 6226, 6228, 6230, 6232, 6234, 6236, 6238,
-    6240, 6242, 6244, 6246, 6248, 6250, 6252, 6254, 6256, 6258, 6261,
-    6263, 6265, 6267, 6269, 6271, 6273, 6275, 6277, 6279, 6281, 6283,
-    6285, 6287, 6289, 6291, 6293, 6295, 6297, 6299, 6301, 6303, 6305,
-    6307, 6309, 6311, 6313, 6315, 6318, 6320, 6322, 6324, 6326, 6328,
-    6330, 6332, 6334, 6336, 6338, 6340, 6342, 6344, 6346, 6348, 6350,
-    6352, 6354, 6356, 6358, 6360, 6362, 6364, 6366, 6368, 6370, 6373,
-    6375, 6377, 6379, 6381, 6383, 6385, 6387, 6389, 6391, 6393, 6395,
-    6397, 6399, 6401, 6403, 6405, 6407, 6409, 6411, 6413, 6415, 6417,
-    6419, 6421, 6423, 6425, 6427, 6430, 6432, 6434, 6436, 6438, 6440,
-    6442, 6444, 6446, 6448, 6450, 6452, 6454, 6456, 6458, 6460, 6462,
-    6464, 6466, 6468, 6470, 6472, 6474, 6476, 6478, 6480, 6482, 6485,
-    6487, 6489, 6491, 6493, 6495, 6497, 6499, 6501, 6503, 6505, 6507,
-    6509, 6511, 6513, 6515, 6517, 6519, 6521, 6523, 6525, 6527, 6529,
-    6531, 6533, 6535, 6537, 6539, 6542, 6544, 6546, 6548, 6550, 6552,
-    6554, 6556, 6558, 6560, 6562, 6564, 6566, 6568, 6570, 6572, 6574,
-    6576, 6578, 6580, 6582, 6584, 6586, 6588, 6590, 6592, 6594, 6597,
-    6599, 6601, 6603, 6605, 6607, 6609, 6611, 6613, 6615, 6617, 6619,
-    6621, 6623, 6625, 6627, 6629, 6631, 6633, 6635, 6637, 6639, 6641,
-    6643, 6645, 6647, 6649, 6651, 6654, 6656, 6658, 6660, 6662, 6664,
-    6666, 6668, 6670, 6672, 6674, 6676, 6678, 6680, 6682, 6684, 6686,
-    6688, 6690, 6692, 6694, 6696, 6698, 6700, 6702, 6704, 6706, 6709,
-    6711, 6713, 6715, 6717, 6719, 6721, 6723, 6725, 6727, 6729, 6731,
-    6733, 6735, 6737, 6739, 6741, 6743, 6745, 6747, 6749, 6751, 6753,
-    6755, 6757, 6759, 6761, 6764, 6766, 6768, 6770, 6772, 6774, 6776,
-    6778, 6780, 6782, 6784, 6786, 6788, 6790, 6792, 6794, 6796, 6798,
-    6800, 6802, 6804, 6806, 6808, 6810, 6812, 6814, 6816, 6818, 6821,
-    6823, 6825, 6827, 6829, 6831, 6833, 6835, 6837, 6839, 6841, 6843,
-    6845, 6847, 6849, 6851, 6853, 6855, 6857, 6859, 6861, 6863, 6865,
-    6867, 6869, 6871, 6873, 6876, 6878, 6880, 6882, 6884, 6886, 6888,
-    6890, 6892, 6894, 6896, 6898, 6900, 6902, 6904, 6906, 6908, 6910,
-    6912, 6914, 6916, 6918, 6920, 6922, 6924, 6926, 6928, 6931, 6933,
-    6935, 6937, 6939, 6941, 6943, 6945, 6947, 6949, 6951, 6953, 6955,
-    6957, 6959, 6961, 6963, 6965, 6967, 6969, 6971, 6973, 6975, 6977,
-    6979, 6981, 6983, 6985, 6988, 6990, 6992, 6994, 6996, 6998, 7000,
-    7002, 7004, 7006, 7008, 7010, 7012, 7014, 7016, 7018, 7020, 7022,
-    7024, 7026, 7028, 7030, 7032, 7034, 7036, 7038, 7040, 7043, 7045,
-    7047, 7049, 7051, 7053, 7055, 7057, 7059, 7061, 7063, 7065, 7067,
-    7069, 7071, 7073, 7075, 7077, 7079, 7081, 7083, 7085, 7087, 7089,
-    7091, 7093, 7095, 7098, 7100, 7102, 7104, 7106, 7108, 7110, 7112,
-    7114, 7116, 7118, 7120, 7122, 7124, 7126, 7128, 7130, 7132, 7134,
-    7136, 7138, 7140, 7142, 7144, 7146, 7148, 7150, 7152, 7155, 7157,
-    7159, 7161, 7163, 7165, 7167, 7169, 7171, 7173, 7175, 7177, 7179,
-    7181, 7183, 7185, 7187, 7189, 7191, 7193, 7195, 7197, 7199, 7201,
-    7203, 7205, 7207, 7210, 7212, 7214, 7216, 7218, 7220, 7222, 7224,
-    7226, 7228, 7230, 7232, 7234, 7236, 7238, 7240, 7242, 7244, 7246,
-    7248, 7250, 7252, 7254, 7256, 7258, 7260, 7262, 7264, 7266, 7269,
-    7271, 7273, 7275, 7277, 7279, 7281, 7283, 7285, 7287, 7289, 7291,
-    7293, 7295, 7297, 7299, 7301, 7303, 7305, 7307, 7309, 7311, 7313,
-    7315, 7317, 7319, 7321, 7323, 7325, 7328, 7330, 7332, 7334, 7336,
-    7338, 7340, 7342, 7344, 7346, 7348, 7350, 7352, 7354, 7356, 7358,
-    7360, 7362, 7364, 7366, 7368, 7370, 7372, 7374, 7376, 7378, 7380,
-    7382, 7384, 7386, 7388, 7391, 7393, 7395, 7397, 7399, 7401, 7403,
-    7405, 7407, 7409, 7411, 7413, 7415, 7417, 7419, 7421, 7423, 7425,
-    7427, 7429, 7431, 7433, 7435, 7437, 7439, 7441, 7443, 7445, 7447,
-    7449, 7451, 7453, 7455, 7458, 7460, 7462, 7464, 7466, 7468, 7470,
-    7472, 7474, 7476, 7478, 7480, 7482, 7484, 7486, 7488, 7490, 7492,
-    7494, 7496, 7498, 7500, 7502, 7504, 7506, 7508, 7510, 7512, 7514,
-    7516, 7518, 7520, 7522, 7525, 7527, 7529, 7531, 7533, 7535, 7537,
-    7539, 7541, 7543, 7545, 7547, 7549, 7551, 7553, 7555, 7557, 7559,
-    7561, 7563, 7565, 7567, 7569, 7571, 7573, 7575, 7577, 7579, 7581,
-    7583, 7586, 7588, 7590, 7592, 7594, 7596, 7598, 7600, 7602, 7604,
-    7606, 7608, 7610, 7612, 7614, 7616, 7618, 7620, 7622, 7624, 7626,
-    7628, 7630, 7632, 7635, 7637, 7639, 7641, 7643, 7645, 7647, 7649,
-    7651, 7653, 7655, 7657, 7659, 7661, 7663, 7665, 7667, 7669, 7671,
-    7674, 7676, 7678, 7680, 7682, 7684, 7686, 7688, 7690, 7692, 7694,
-    7696, 7698, 7700, 7702, 7704, 7707, 7709, 7711, 7713, 7715, 7717,
-    7719, 7721, 7723, 7725, 7727, 7729, 7731, 7734, 7736, 7738, 7740,
-    7742, 7744, 7746, 7748, 7750, 7752, 7754, 7757, 7759, 7761, 7763,
-    7765, 7767, 7769, 7771, 7773, 7775, 7778, 7780, 7782, 7784, 7786,
-    7788, 7790, 7792, 7795, 7797, 7799, 7801, 7803, 7805, 7807, 7809,
-    7811, 7814, 7816, 7818, 7820, 7822, 7824, 7826, 7829, 7831, 7833,
-    7835, 7837, 7839, 7841, 7844, 7846, 7848, 7850, 7852, 7854, 7857,
-    7859, 7861, 7863, 7865, 7867, 7869, 7872, 7874, 7876, 7878, 7880,
-    7882, 7885, 7887, 7889, 7891, 7893, 7896, 7898, 7900, 7902, 7904,
-    7906, 7909, 7911, 7913, 7915, 7917, 7919, 7922, 7924, 7926, 7928,
-    7930, 7933, 7935, 7937, 7939, 7941, 7943, 7946, 7948, 7950, 7952,
-    7954, 7957, 7959, 7961, 7963, 7965, 7967, 7970, 7972, 7974, 7976,
-    7978, 7980, 7983, 7985, 7987, 7989, 7991, 7993, 7996, 7998, 8000,
-    8002, 8004, 8006, 8008, 8011, 8013, 8015, 8017, 8019, 8021, 8023,
-    8025, 8027, 8030, 8032, 8034, 8036, 8038, 8040, 8042, 8044, 8046,
-    8048, 8050, 8052, 8054, 8056, 8058, 8060, 8062, 8064, 8066, 8068,
-    8070, 8072, 8074, 8076, 8078, 8080, 8082, 8084, 8086, 8088, 8090,
-    8092, 8093, 8095, 8097, 8099, 8101, 8103, 8104, 8106, 8108, 8110,
-    8111, 8113, 8115, 8117, 8118, 8120, 8122, 8123, 8125, 8127, 8128,
-    8130, 8131, 8133, 8134, 8136, 8138, 8139, 8140, 8142, 8143, 8145,
-    8146, 8148, 8149, 8150, 8152, 8153, 8154, 8156, 8157, 8158, 8159,
-    8161, 8162, 8163, 8164, 8165, 8166, 8167, 8168, 8169, 8170, 8171,
-    8172, 8173, 8174, 8175, 8176, 8177, 8178, 8179, 8179, 8180, 8181,
-    8182, 8182, 8183, 8184, 8184, 8185, 8185, 8186, 8186, 8187, 8187,
-    8188, 8188, 8188, 8189, 8189, 8189, 8190, 8190, 8190, 8190, 8191,
-    8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,
-    8191, 8190, 8190, 8190, 8190, 8189, 8189, 8189, 8188, 8188, 8188,
-    8187, 8187, 8186, 8186, 8185, 8185, 8184, 8183, 8183, 8182, 8181,
-    8181, 8180, 8179, 8178, 8178, 8177, 8176, 8175, 8174, 8173, 8172,
-    8171, 8170, 8169, 8168, 8167, 8166, 8165, 8164, 8163, 8161, 8160,
-    8159, 8158, 8157, 8155, 8154, 8153, 8151, 8150, 8149, 8147, 8146,
-    8144, 8143, 8142, 8140, 8139, 8137, 8136, 8134, 8133, 8131, 8129,
-    8128, 8126, 8125, 8123, 8121, 8120, 8118, 8116, 8114, 8113, 8111,
-    8109, 8107, 8106, 8104, 8102, 8100, 8098, 8097, 8095, 8093, 8091,
-    8089, 8087, 8085, 8083, 8082, 8080, 8078, 8076, 8074, 8072, 8070,
-    8068, 8066, 8064, 8062, 8060, 8058, 8056, 8054, 8052, 8050, 8048,
-    8046, 8044, 8042, 8039, 8037, 8035, 8033, 8031, 8029, 8027, 8025,
-    8023, 8021, 8019, 8016, 8014, 8012, 8010, 8008, 8006, 8004, 8001,
-    7999, 7997, 7995, 7993, 7991, 7989, 7986, 7984, 7982, 7980, 7978,
-    7976, 7973, 7971, 7969, 7967, 7965, 7963, 7960, 7958, 7956, 7954,
-    7952, 7949, 7947, 7945, 7943, 7941, 7939, 7936, 7934, 7932, 7930,
-    7928, 7925, 7923, 7921, 7919, 7917, 7915, 7912, 7910, 7908, 7906,
-    7904, 7901, 7899, 7897, 7895, 7893, 7891, 7888, 7886, 7884, 7882,
-    7880, 7878, 7875, 7873, 7871, 7869, 7867, 7865, 7862, 7860, 7858,
-    7856, 7854, 7852, 7850, 7847, 7845, 7843, 7841, 7839, 7837, 7834,
-    7832, 7830, 7828, 7826, 7824, 7822, 7819, 7817, 7815, 7813, 7811,
-    7809, 7807, 7805, 7802, 7800, 7798, 7796, 7794, 7792, 7790, 7788,
-    7786, 7783, 7781, 7779, 7777, 7775, 7773, 7771, 7769, 7767, 7764,
-    7762, 7760, 7758, 7756, 7754, 7752, 7750, 7748, 7746, 7743, 7741,
-    7739, 7737, 7735, 7733, 7731, 7729, 7727, 7725, 7723, 7721, 7718,
-    7716, 7714, 7712, 7710, 7708, 7706, 7704, 7702, 7700, 7698, 7696,
-    7694, 7692, 7689, 7687, 7685, 7683, 7681, 7679, 7677, 7675, 7673,
-    7671, 7669, 7667, 7665, 7663, 7661, 7659, 7657, 7655, 7652, 7650,
-    7648, 7646, 7644, 7642, 7640, 7638, 7636, 7634, 7632, 7630, 7628,
-    7626, 7624, 7622, 7620, 7618, 7616, 7614, 7612, 7609, 7607, 7605,
-    7603, 7601, 7599, 7597, 7595, 7593, 7591, 7589, 7587, 7585, 7583,
-    7581, 7579, 7577, 7575, 7573, 7571, 7569, 7567, 7565, 7563, 7561,
-    7559, 7557, 7554, 7552, 7550, 7548, 7546, 7544, 7542, 7540, 7538,
-    7536, 7534, 7532, 7530, 7528, 7526, 7524, 7522, 7520, 7518, 7516,
-    7514, 7512, 7510, 7508, 7506, 7504, 7502, 7500, 7498, 7496, 7494,
-    7492, 7489, 7487, 7485, 7483, 7481, 7479, 7477, 7475, 7473, 7471,
-    7469, 7467, 7465, 7463, 7461, 7459, 7457, 7455, 7453, 7451, 7449,
-    7447, 7445, 7443, 7441, 7439, 7437, 7435, 7433, 7431, 7429, 7427,
-    7425, 7422, 7420, 7418, 7416, 7414, 7412, 7410, 7408, 7406, 7404,
-    7402, 7400, 7398, 7396, 7394, 7392, 7390, 7388, 7386, 7384, 7382,
-    7380, 7378, 7376, 7374, 7372, 7370, 7368, 7366, 7364, 7362, 7360,
-    7357, 7355, 7353, 7351, 7349, 7347, 7345, 7343, 7341, 7339, 7337,
-    7335, 7333, 7331, 7329, 7327, 7325, 7323, 7321, 7319, 7317, 7315,
-    7313, 7311, 7309, 7307, 7305, 7303, 7301, 7299, 7296, 7294, 7292,
-    7290, 7288, 7286, 7284, 7282, 7280, 7278, 7276, 7274, 7272, 7270,
-    7268, 7266, 7264, 7262, 7260, 7258, 7256, 7254, 7252, 7250, 7248,
-    7246, 7244, 7242, 7240, 7237, 7235, 7233, 7231, 7229, 7227, 7225,
-    7223, 7221, 7219, 7217, 7215, 7213, 7211, 7209, 7207, 7205, 7203,
-    7201, 7199, 7197, 7195, 7193, 7191, 7189, 7187, 7185, 7183, 7180,
-    7178, 7176, 7174, 7172, 7170, 7168, 7166, 7164, 7162, 7160, 7158,
-    7156, 7154, 7152, 7150, 7148, 7146, 7144, 7142, 7140, 7138, 7136,
-    7134, 7132, 7130, 7128, 7126, 7123, 7121, 7119, 7117, 7115, 7113,
-    7111, 7109, 7107, 7105, 7103, 7101, 7099, 7097, 7095, 7093, 7091,
-    7089, 7087, 7085, 7083, 7081, 7079, 7077, 7075, 7073, 7071, 7068,
-    7066, 7064, 7062, 7060, 7058, 7056, 7054, 7052, 7050, 7048, 7046,
-    7044, 7042, 7040, 7038, 7036, 7034, 7032, 7030, 7028, 7026, 7024,
-    7022, 7020, 7018, 7016, 7013, 7011, 7009, 7007, 7005, 7003, 7001,
-    6999, 6997, 6995, 6993, 6991, 6989, 6987, 6985, 6983, 6981, 6979,
-    6977, 6975, 6973, 6971, 6969, 6967, 6965, 6963, 6961, 6959, 6956,
-    6954, 6952, 6950, 6948, 6946, 6944, 6942, 6940, 6938, 6936, 6934,
-    6932, 6930, 6928, 6926, 6924, 6922, 6920, 6918, 6916, 6914, 6912,
-    6910, 6908, 6906, 6904, 6901, 6899, 6897, 6895, 6893, 6891, 6889,
-    6887, 6885, 6883, 6881, 6879, 6877, 6875, 6873, 6871, 6869, 6867,
-    6865, 6863, 6861, 6859, 6857, 6855, 6853, 6851, 6849, 6846, 6844,
-    6842, 6840, 6838, 6836, 6834, 6832, 6830, 6828, 6826, 6824, 6822,
-    6820, 6818, 6816, 6814, 6812, 6810, 6808, 6806, 6804, 6802, 6800,
-    6798, 6796, 6794, 6792, 6789, 6787, 6785, 6783, 6781, 6779, 6777,
-    6775, 6773, 6771, 6769, 6767, 6765, 6763, 6761, 6759, 6757, 6755,
-    6753, 6751, 6749, 6747, 6745, 6743, 6741, 6739, 6737, 6734, 6732,
-    6730, 6728, 6726, 6724, 6722, 6720, 6718, 6716, 6714, 6712, 6710,
-    6708, 6706, 6704, 6702, 6700, 6698, 6696, 6694, 6692, 6690, 6688,
-    6686, 6684, 6682, 6679, 6677, 6675, 6673, 6671, 6669, 6667, 6665,
-    6663, 6661, 6659, 6657, 6655, 6653, 6651, 6649, 6647, 6645, 6643,
-    6641, 6639, 6637, 6635, 6633, 6631, 6629, 6627, 6625, 6622, 6620,
-    6618, 6616, 6614, 6612, 6610, 6608, 6606, 6604, 6602, 6600, 6598,
-    6596, 6594, 6592, 6590, 6588, 6586, 6584, 6582, 6580, 6578, 6576,
-    6574, 6572, 6570, 6567, 6565, 6563, 6561, 6559, 6557, 6555, 6553,
-    6551, 6549, 6547, 6545, 6543, 6541, 6539, 6537, 6535, 6533, 6531,
-    6529, 6527, 6525, 6523, 6521, 6519, 6517, 6515, 6513, 6510, 6508,
-    6506, 6504, 6502, 6500, 6498, 6496, 6494, 6492, 6490, 6488, 6486,
-    6484, 6482, 6480, 6478, 6476, 6474, 6472, 6470, 6468, 6466, 6464,
-    6462, 6460, 6458, 6455, 6453, 6451, 6449, 6447, 6445, 6443, 6441,
-    6439, 6437, 6435, 6433, 6431, 6429, 6427, 6425, 6423, 6421, 6419,
-    6417, 6415, 6413, 6411, 6409, 6407, 6405, 6403, 6401, 6398, 6396,
-    6394, 6392, 6390, 6388, 6386, 6384, 6382, 6380, 6378, 6376, 6374,
-    6372, 6370, 6368, 6366, 6364, 6362, 6360, 6358, 6356, 6354, 6352,
-    6350, 6348, 6346, 6343, 6341, 6339, 6337, 6335, 6333, 6331, 6329,
-    6327, 6325, 6323, 6321, 6319, 6317, 6315, 6313, 6311, 6309, 6307,
-    6305, 6303, 6301, 6299, 6297, 6295, 6293, 6291, 6289, 6286, 6284,
-    6282, 6280, 6278, 6276, 6274, 6272, 6270, 6268, 6266, 6264, 6262,
-    6260, 6258, 6256, 6254, 6252, 6250, 6248, 6246, 6244, 6242, 6240,
-    6238, 6236, 6234, 6231, 6229, 6227, 6225, 6223, 6221, 6219, 6217,
-    6215, 6213, 6211, 6209, 6207, 6205, 6203, 6201, 6199, 6197, 6195,
-    6193, 6191, 6189, 6187, 6185, 6183, 6181, 6179, 6176, 6174, 6172,
-    6170, 6168, 6166, 6164, 6162, 6160, 6158, 6156, 6154, 6152, 6150,
-    6148, 6146, 6144, 6142, 6140, 6138, 6136, 6134, 6132, 6130, 6128,
-    6126, 6124, 6122, 6119, 6117, 6115, 6113, 6111, 6109, 6107, 6105,
-    6103, 6101, 6099, 6097, 6095, 6093, 6091, 6089, 6087, 6085, 6083,
-    6081, 6079, 6077, 6075, 6073, 6071, 6069, 6067, 6064, 6062, 6060,
-    6058, 6056, 6054, 6052, 6050, 6048, 6046, 6044, 6042, 6040, 6038,
-    6036, 6034, 6032, 6030, 6028, 6026, 6024, 6022, 6020, 6018, 6016,
-    6014, 6012, 6010, 6007, 6005, 6003, 6001, 5999, 5997, 5995, 5993,
-    5991, 5989, 5987, 5985, 5983, 5981, 5979, 5977, 5975, 5973, 5971,
-    5969, 5967, 5965, 5963, 5961, 5959, 5957, 5955, 5952, 5950, 5948,
-    5946, 5944, 5942, 5940, 5938, 5936, 5934, 5932, 5930, 5928, 5926,
-    5924, 5922, 5920, 5918, 5916, 5914, 5912, 5910, 5908, 5906, 5904,
-    5902, 5900, 5898, 5895, 5893, 5891, 5889, 5887, 5885, 5883, 5881,
-    5879, 5877, 5875, 5873, 5871, 5869, 5867, 5865, 5863, 5861, 5859,
-    5857, 5855, 5853, 5851, 5849, 5847, 5845, 5843, 5840, 5838, 5836,
-    5834, 5832, 5830, 5828, 5826, 5824, 5822, 5820, 5818, 5816, 5814,
-    5812, 5810, 5808, 5806, 5804, 5802, 5800, 5798, 5796, 5794, 5792,
-    5790, 5788, 5785, 5783, 5781, 5779, 5777, 5775, 5773, 5771, 5769,
-    5767, 5765, 5763, 5761, 5759, 5757, 5755, 5753, 5751, 5749, 5747,
-    5745, 5743, 5741, 5739, 5737, 5735, 5733, 5731, 5728, 5726, 5724,
-    5722, 5720, 5718, 5716, 5714, 5712, 5710, 5708, 5706, 5704, 5702,
-    5700, 5698, 5696, 5694, 5692, 5690, 5688, 5686, 5684, 5682, 5680,
-    5678, 5676, 5673, 5671, 5669, 5667, 5665, 5663, 5661, 5659, 5657,
-    5655, 5653, 5651, 5649, 5647, 5645, 5643, 5641, 5639, 5637, 5635,
-    5633, 5631, 5629, 5627, 5625, 5623, 5621, 5619, 5616, 5614, 5612,
-    5610, 5608, 5606, 5604, 5602, 5600, 5598, 5596, 5594, 5592, 5590,
-    5588, 5586, 5584, 5582, 5580, 5578, 5576, 5574, 5572, 5570, 5568,
-    5566, 5564, 5561, 5559, 5557, 5555, 5553, 5551, 5549, 5547, 5545,
-    5543, 5541, 5539, 5537, 5535, 5533, 5531, 5529, 5527, 5525, 5523,
-    5521, 5519, 5517, 5515, 5513, 5511, 5509, 5507, 5504, 5502, 5500,
-    5498, 5496, 5494, 5492, 5490, 5488, 5486, 5484, 5482, 5480, 5478,
-    5476, 5474, 5472, 5470, 5468, 5466, 5464, 5462, 5460, 5458, 5456,
-    5454, 5452, 5449, 5447, 5445, 5443, 5441, 5439, 5437, 5435, 5433,
-    5431, 5429, 5427, 5425, 5423, 5421, 5419, 5417, 5415, 5413, 5411,
-    5409, 5407, 5405, 5403, 5401, 5399, 5397, 5395, 5392, 5390, 5388,
-    5386, 5384, 5382, 5380, 5378, 5376, 5374, 5372, 5370, 5368, 5366,
-    5364, 5362, 5360, 5358, 5356, 5354, 5352, 5350, 5348, 5346, 5344,
-    5342, 5340, 5337, 5335, 5333, 5331, 5329, 5327, 5325, 5323, 5321,
-    5319, 5317, 5315, 5313, 5311, 5309, 5307, 5305, 5303, 5301, 5299,
-    5297, 5295, 5293, 5291, 5289, 5287, 5285, 5282, 5280, 5278, 5276,
-    5274, 5272, 5270, 5268, 5266, 5264, 5262, 5260, 5258, 5256, 5254,
-    5252, 5250, 5248, 5246, 5244, 5242, 5240, 5238, 5236, 5234, 5232,
-    5230, 5228, 5225, 5223, 5221, 5219, 5217, 5215, 5213, 5211, 5209,
-    5207, 5205, 5203, 5201, 5199, 5197, 5195, 5193, 5191, 5189, 5187,
-    5185, 5183, 5181, 5179, 5177, 5175, 5173, 5170, 5168, 5166, 5164,
-    5162, 5160, 5158, 5156, 5154, 5152, 5150, 5148, 5146, 5144, 5142,
-    5140, 5138, 5136, 5134, 5132, 5130, 5128, 5126, 5124, 5122, 5120,
-    5118, 5116, 5113, 5111, 5109, 5107, 5105, 5103, 5101, 5099, 5097,
-    5095, 5093, 5091, 5089, 5087, 5085, 5083, 5081, 5079, 5077, 5075,
-    5073, 5071, 5069, 5067, 5065, 5063, 5061, 5058, 5056, 5054, 5052,
-    5050, 5048, 5046, 5044, 5042, 5040, 5038, 5036, 5034, 5032, 5030,
-    5028, 5026, 5024, 5022, 5020, 5018, 5016, 5014, 5012, 5010, 5008,
-    5006, 5004, 5001, 4999, 4997, 4995, 4993, 4991, 4989, 4987, 4985,
-    4983, 4981, 4979, 4977, 4975, 4973, 4971, 4969, 4967, 4965, 4963,
-    4961, 4959, 4957, 4955, 4953, 4951, 4949, 4946, 4944, 4942, 4940,
-    4938, 4936, 4934, 4932, 4930, 4928, 4926, 4924, 4922, 4920, 4918,
-    4916, 4914, 4912, 4910, 4908, 4906, 4904, 4902, 4900, 4898, 4896,
-    4894, 4891, 4889, 4887, 4885, 4883, 4881, 4879, 4877, 4875, 4873,
-    4871, 4869, 4867, 4865, 4863, 4861, 4859, 4857, 4855, 4853, 4851,
-    4849, 4847, 4845, 4843, 4841, 4839, 4837, 4834, 4832, 4830, 4828,
-    4826, 4824, 4822, 4820, 4818, 4816, 4814, 4812, 4810, 4808, 4806,
-    4804, 4802, 4800, 4798, 4796, 4794, 4792, 4790, 4788, 4786, 4784,
-    4782, 4779, 4777, 4775, 4773, 4771, 4769, 4767, 4765, 4763, 4761,
-    4759, 4757, 4755, 4753, 4751, 4749, 4747, 4745, 4743, 4741, 4739,
-    4737, 4735, 4733, 4731, 4729, 4727, 4725, 4722, 4720, 4718, 4716,
-    4714, 4712, 4710, 4708, 4706, 4704, 4702, 4700, 4698, 4696, 4694,
-    4692, 4690, 4688, 4686, 4684, 4682, 4680, 4678, 4676, 4674, 4672,
-    4670, 4667, 4665, 4663, 4661, 4659, 4657, 4655, 4653, 4651, 4649,
-    4647, 4645, 4643, 4641, 4639, 4637, 4635, 4633, 4631, 4629, 4627,
-    4625, 4623, 4621, 4619, 4617, 4615, 4613, 4610, 4608, 4606, 4604,
-    4602, 4600, 4598, 4596, 4594, 4592, 4590, 4588, 4586, 4584, 4582,
-    4580, 4578, 4576, 4574, 4572, 4570, 4568, 4566, 4564, 4562, 4560,
-    4558, 4555, 4553, 4551, 4549, 4547, 4545, 4543, 4541, 4539, 4537,
-    4535, 4533, 4531, 4529, 4527, 4525, 4523, 4521, 4519, 4517, 4515,
-    4513, 4511, 4509, 4507, 4505, 4503, 4500, 4498, 4496, 4494, 4492,
-    4490, 4488, 4486, 4484, 4482, 4480, 4478, 4476, 4474, 4472, 4470,
-    4468, 4466, 4464, 4462, 4460, 4458, 4456, 4454, 4452, 4450, 4448,
-    4446, 4443, 4441, 4439, 4437, 4435, 4433, 4431, 4429, 4427, 4425,
-    4423, 4421, 4419, 4417, 4415, 4413, 4411, 4409, 4407, 4405, 4403,
-    4401, 4399, 4397, 4395, 4393, 4391, 4388, 4386, 4384, 4382, 4380,
-    4378, 4376, 4374, 4372, 4370, 4368, 4366, 4364, 4362, 4360, 4358,
-    4356, 4354, 4352, 4350, 4348, 4346, 4344, 4342, 4340, 4338, 4336,
-    4334, 4331, 4329, 4327, 4325, 4323, 4321, 4319, 4317, 4315, 4313,
-    4311, 4309, 4307, 4305, 4303, 4301, 4299, 4297, 4295, 4293, 4291,
-    4289, 4287, 4285, 4283, 4281, 4279, 4276, 4274, 4272, 4270, 4268,
-    4266, 4264, 4262, 4260, 4258, 4256, 4254, 4252, 4250, 4248, 4246,
-    4244, 4242, 4240, 4238, 4236, 4234, 4232, 4230, 4228, 4226, 4224,
-    4222, 4219, 4217, 4215, 4213, 4211, 4209, 4207, 4205, 4203, 4201,
-    4199, 4197, 4195, 4193, 4191, 4189, 4187, 4185, 4183, 4181, 4179,
-    4177, 4175, 4173, 4171, 4169, 4167, 4164, 4162, 4160, 4158, 4156,
-    4154, 4152, 4150, 4148, 4146, 4144, 4142, 4140, 4138, 4136, 4134,
-    4132, 4130, 4128, 4126, 4124, 4122, 4120, 4118, 4116, 4114, 4112,
-    4110, 4107, 4105, 4103, 4101, 4099, 4097, 4095, 4093, 4091, 4089,
-    4087, 4085, 4083, 4081, 4079, 4077, 4075, 4073, 4071, 4069, 4067,
-    4065, 4063, 4061, 4059, 4057, 4055, 4052, 4050, 4048, 4046, 4044,
-    4042, 4040, 4038, 4036, 4034, 4032, 4030, 4028, 4026, 4024, 4022,
-    4020, 4018, 4016, 4014, 4012, 4010, 4008, 4006, 4004, 4002, 4000,
-    3997, 3995, 3993, 3991, 3989, 3987, 3985, 3983, 3981, 3979, 3977,
-    3975, 3973, 3971, 3969, 3967, 3965, 3963, 3961, 3959, 3957, 3955,
-    3953, 3951, 3949, 3947, 3945, 3943, 3940, 3938, 3936, 3934, 3932,
-    3930, 3928, 3926, 3924, 3922, 3920, 3918, 3916, 3914, 3912, 3910,
-    3908, 3906, 3904, 3902, 3900, 3898, 3896, 3894, 3892, 3890, 3888,
-    3885, 3883, 3881, 3879, 3877, 3875, 3873, 3871, 3869, 3867, 3865,
-    3863, 3861, 3859, 3857, 3855, 3853, 3851, 3849, 3847, 3845, 3843,
-    3841, 3839, 3837, 3835, 3833, 3831, 3828, 3826, 3824, 3822, 3820,
-    3818, 3816, 3814, 3812, 3810, 3808, 3806, 3804, 3802, 3800, 3798,
-    3796, 3794, 3792, 3790, 3788, 3786, 3784, 3782, 3780, 3778, 3776,
-    3773, 3771, 3769, 3767, 3765, 3763, 3761, 3759, 3757, 3755, 3753,
-    3751, 3749, 3747, 3745, 3743, 3741, 3739, 3737, 3735, 3733, 3731,
-    3729, 3727, 3725, 3723, 3721, 3719, 3716, 3714, 3712, 3710, 3708,
-    3706, 3704, 3702, 3700, 3698, 3696, 3694, 3692, 3690, 3688, 3686,
-    3684, 3682, 3680, 3678, 3676, 3674, 3672, 3670, 3668, 3666, 3664,
-    3661, 3659, 3657, 3655, 3653, 3651, 3649, 3647, 3645, 3643, 3641,
-    3639, 3637, 3635, 3633, 3631, 3629, 3627, 3625, 3623, 3621, 3619,
-    3617, 3615, 3613, 3611, 3609, 3606, 3604, 3602, 3600, 3598, 3596,
-    3594, 3592, 3590, 3588, 3586, 3584, 3582, 3580, 3578, 3576, 3574,
-    3572, 3570, 3568, 3566, 3564, 3562, 3560, 3558, 3556, 3554, 3552,
-    3549, 3547, 3545, 3543, 3541, 3539, 3537, 3535, 3533, 3531, 3529,
-    3527, 3525, 3523, 3521, 3519, 3517, 3515, 3513, 3511, 3509, 3507,
-    3505, 3503, 3501, 3499, 3497, 3494, 3492, 3490, 3488, 3486, 3484,
-    3482, 3480, 3478, 3476, 3474, 3472, 3470, 3468, 3466, 3464, 3462,
-    3460, 3458, 3456, 3454, 3452, 3450, 3448, 3446, 3444, 3442, 3440,
-    3437, 3435, 3433, 3431, 3429, 3427, 3425, 3423, 3421, 3419, 3417,
-    3415, 3413, 3411, 3409, 3407, 3405, 3403, 3401, 3399, 3397, 3395,
-    3393, 3391, 3389, 3387, 3385, 3382, 3380, 3378, 3376, 3374, 3372,
-    3370, 3368, 3366, 3364, 3362, 3360, 3358, 3356, 3354, 3352, 3350,
-    3348, 3346, 3344, 3342, 3340, 3338, 3336, 3334, 3332, 3330, 3328,
-    3325, 3323, 3321, 3319, 3317, 3315, 3313, 3311, 3309, 3307, 3305,
-    3303, 3301, 3299, 3297, 3295, 3293, 3291, 3289, 3287, 3285, 3283,
-    3281, 3279, 3277, 3275, 3273, 3270, 3268, 3266, 3264, 3262, 3260,
-    3258, 3256, 3254, 3252, 3250, 3248, 3246, 3244, 3242, 3240, 3238,
-    3236, 3234, 3232, 3230, 3228, 3226, 3224, 3222, 3220, 3218, 3215,
-    3213, 3211, 3209, 3207, 3205, 3203, 3201, 3199, 3197, 3195, 3193,
-    3191, 3189, 3187, 3185, 3183, 3181, 3179, 3177, 3175, 3173, 3171,
-    3169, 3167, 3165, 3163, 3161, 3158, 3156, 3154, 3152, 3150, 3148,
-    3146, 3144, 3142, 3140, 3138, 3136, 3134, 3132, 3130, 3128, 3126,
-    3124, 3122, 3120, 3118, 3116, 3114, 3112, 3110, 3108, 3106, 3103,
-    3101, 3099, 3097, 3095, 3093, 3091, 3089, 3087, 3085, 3083, 3081,
-    3079, 3077, 3075, 3073, 3071, 3069, 3067, 3065, 3063, 3061, 3059,
-    3057, 3055, 3053, 3051, 3049, 3046, 3044, 3042, 3040, 3038, 3036,
-    3034, 3032, 3030, 3028, 3026, 3024, 3022, 3020, 3018, 3016, 3014,
-    3012, 3010, 3008, 3006, 3004, 3002, 3000, 2998, 2996, 2994, 2991,
-    2989, 2987, 2985, 2983, 2981, 2979, 2977, 2975, 2973, 2971, 2969,
-    2967, 2965, 2963, 2961, 2959, 2957, 2955, 2953, 2951, 2949, 2947,
-    2945, 2943, 2941, 2939, 2937, 2934, 2932, 2930, 2928, 2926, 2924,
-    2922, 2920, 2918, 2916, 2914, 2912, 2910, 2908, 2906, 2904, 2902,
-    2900, 2898, 2896, 2894, 2892, 2890, 2888, 2886, 2884, 2882, 2879,
-    2877, 2875, 2873, 2871, 2869, 2867, 2865, 2863, 2861, 2859, 2857,
-    2855, 2853, 2851, 2849, 2847, 2845, 2843, 2841, 2839, 2837, 2835,
-    2833, 2831, 2829, 2827, 2825, 2822, 2820, 2818, 2816, 2814, 2812,
-    2810, 2808, 2806, 2804, 2802, 2800, 2798, 2796, 2794, 2792, 2790,
-    2788, 2786, 2784, 2782, 2780, 2778, 2776, 2774, 2772, 2770, 2767,
-    2765, 2763, 2761, 2759, 2757, 2755, 2753, 2751, 2749, 2747, 2745,
-    2743, 2741, 2739, 2737, 2735, 2733, 2731, 2729, 2727, 2725, 2723,
-    2721, 2719, 2717, 2715, 2712, 2710, 2708, 2706, 2704, 2702, 2700,
-    2698, 2696, 2694, 2692, 2690, 2688, 2686, 2684, 2682, 2680, 2678,
-    2676, 2674, 2672, 2670, 2668, 2666, 2664, 2662, 2660, 2658, 2655,
-    2653, 2651, 2649, 2647, 2645, 2643, 2641, 2639, 2637, 2635, 2633,
-    2631, 2629, 2627, 2625, 2623, 2621, 2619, 2617, 2615, 2613, 2611,
-    2609, 2607, 2605, 2603, 2600, 2598, 2596, 2594, 2592, 2590, 2588,
-    2586, 2584, 2582, 2580, 2578, 2576, 2574, 2572, 2570, 2568, 2566,
-    2564, 2562, 2560, 2558, 2556, 2554, 2552, 2550, 2548, 2546, 2543,
-    2541, 2539, 2537, 2535, 2533, 2531, 2529, 2527, 2525, 2523, 2521,
-    2519, 2517, 2515, 2513, 2511, 2509, 2507, 2505, 2503, 2501, 2499,
-    2497, 2495, 2493, 2491, 2488, 2486, 2484, 2482, 2480, 2478, 2476,
-    2474, 2472, 2470, 2468, 2466, 2464, 2462, 2460, 2458, 2456, 2454,
-    2452, 2450, 2448, 2446, 2444, 2442, 2440, 2438, 2436, 2434, 2431,
-    2429, 2427, 2425, 2423, 2421, 2419, 2417, 2415, 2413, 2411, 2409,
-    2407, 2405, 2403, 2401, 2399, 2397, 2395, 2393, 2391, 2389, 2387,
-    2385, 2383, 2381, 2379, 2376, 2374, 2372, 2370, 2368, 2366, 2364,
-    2362, 2360, 2358, 2356, 2354, 2352, 2350, 2348, 2346, 2344, 2342,
-    2340, 2338, 2336, 2334, 2332, 2330, 2328, 2326, 2324, 2321, 2319,
-    2317, 2315, 2313, 2311, 2309, 2307, 2305, 2303, 2301, 2299, 2297,
-    2295, 2293, 2291, 2289, 2287, 2285, 2283, 2281, 2279, 2277, 2275,
-    2273, 2271, 2269, 2267, 2264, 2262, 2260, 2258, 2256, 2254, 2252,
-    2250, 2248, 2246, 2244, 2242, 2240, 2238, 2236, 2234, 2232, 2230,
-    2228, 2226, 2224, 2222, 2220, 2218, 2216, 2214, 2212, 2209, 2207,
-    2205, 2203, 2201, 2199, 2197, 2195, 2193, 2191, 2189, 2187, 2185,
-    2183, 2181, 2179, 2177, 2175, 2173, 2171, 2169, 2167, 2165, 2163,
-    2161, 2159, 2157, 2155, 2152, 2150, 2148, 2146, 2144, 2142, 2140,
-    2138, 2136, 2134, 2132, 2130, 2128, 2126, 2124, 2122, 2120, 2118,
-    2116, 2114, 2112, 2110, 2108, 2106, 2104, 2102, 2100, 2097, 2095,
-    2093, 2091, 2089, 2087, 2085, 2083, 2081, 2079, 2077, 2075, 2073,
-    2071, 2069, 2067, 2065, 2063, 2061, 2059, 2057, 2055, 2053, 2051,
-    2049, 2047, 2045, 2043, 2040, 2038, 2036, 2034, 2032, 2030, 2028,
-    2026, 2024, 2022, 2020, 2018, 2016, 2014, 2012, 2010, 2008, 2006,
-    2004, 2002, 2000, 1998, 1996, 1994, 1992, 1990, 1988, 1985, 1983,
-    1981, 1979, 1977, 1975, 1973, 1971, 1969, 1967, 1965, 1963, 1961,
-    1959, 1957, 1955, 1953, 1951, 1949, 1947, 1945, 1943, 1941, 1939,
-    1937, 1935, 1933, 1930, 1928, 1926, 1924, 1922, 1920, 1918, 1916,
-    1914, 1912, 1910, 1908, 1906, 1904, 1902, 1900, 1898, 1896, 1894,
-    1892, 1890, 1888, 1886, 1884, 1882, 1880, 1878, 1876, 1873, 1871,
-    1869, 1867, 1865, 1863, 1861, 1859, 1857, 1855, 1853, 1851, 1849,
-    1847, 1845, 1843, 1841, 1839, 1837, 1835, 1833, 1831, 1829, 1827,
-    1825, 1823, 1821, 1818, 1816, 1814, 1812, 1810, 1808, 1806, 1804,
-    1802, 1800, 1798, 1796, 1794, 1792, 1790, 1788, 1786, 1784, 1782,
-    1780, 1778, 1776, 1774, 1772, 1770, 1768, 1766, 1764, 1761, 1759,
-    1757, 1755, 1753, 1751, 1749, 1747, 1745, 1743, 1741, 1739, 1737,
-    1735, 1733, 1731, 1729, 1727, 1725, 1723, 1721, 1719, 1717, 1715,
-    1713, 1711, 1709, 1706, 1704, 1702, 1700, 1698, 1696, 1694, 1692,
-    1690, 1688, 1686, 1684, 1682, 1680, 1678, 1676, 1674, 1672, 1670,
-    1668, 1666, 1664, 1662, 1660, 1658, 1656, 1654, 1652, 1649, 1647,
-    1645, 1643, 1641, 1639, 1637, 1635, 1633, 1631, 1629, 1627, 1625,
-    1623, 1621, 1619, 1617, 1615, 1613, 1611, 1609, 1607, 1605, 1603,
-    1601, 1599, 1597, 1594, 1592, 1590, 1588, 1586, 1584, 1582, 1580,
-    1578, 1576, 1574, 1572, 1570, 1568, 1566, 1564, 1562, 1560, 1558,
-    1556, 1554, 1552, 1550, 1548, 1546, 1544, 1542, 1540, 1537, 1535,
-    1533, 1531, 1529, 1527, 1525, 1523, 1521, 1519, 1517, 1515, 1513,
-    1511, 1509, 1507, 1505, 1503, 1501, 1499, 1497, 1495, 1493, 1491,
-    1489, 1487, 1485, 1482, 1480, 1478, 1476, 1474, 1472, 1470, 1468,
-    1466, 1464, 1462, 1460, 1458, 1456, 1454, 1452, 1450, 1448, 1446,
-    1444, 1442, 1440, 1438, 1436, 1434, 1432, 1430, 1427, 1425, 1423,
-    1421, 1419, 1417, 1415, 1413, 1411, 1409, 1407, 1405, 1403, 1401,
-    1399, 1397, 1395, 1393, 1391, 1389, 1387, 1385, 1383, 1381, 1379,
-    1377, 1375, 1373, 1370, 1368, 1366, 1364, 1362, 1360, 1358, 1356,
-    1354, 1352, 1350, 1348, 1346, 1344, 1342, 1340, 1338, 1336, 1334,
-    1332, 1330, 1328, 1326, 1324, 1322, 1320, 1318, 1315, 1313, 1311,
-    1309, 1307, 1305, 1303, 1301, 1299, 1297, 1295, 1293, 1291, 1289,
-    1287, 1285, 1283, 1281, 1279, 1277, 1275, 1273, 1271, 1269, 1267,
-    1265, 1263, 1260, 1258, 1256, 1254, 1252, 1250, 1248, 1246, 1244,
-    1242, 1240, 1238, 1236, 1234, 1232, 1230, 1228, 1226, 1224, 1222,
-    1220, 1218, 1216, 1214, 1212, 1210, 1208, 1206, 1203, 1201, 1199,
-    1197, 1195, 1193, 1191, 1189, 1187, 1185, 1183, 1181, 1179, 1177,
-    1175, 1173, 1171, 1169, 1167, 1165, 1163, 1161, 1159, 1157, 1155,
-    1153, 1151, 1148, 1146, 1144, 1142, 1140, 1138, 1136, 1134, 1132,
-    1130, 1128, 1126, 1124, 1122, 1120, 1118, 1116, 1114, 1112, 1110,
-    1108, 1106, 1104, 1102, 1100, 1098, 1096, 1093, 1091, 1089, 1087,
-    1085, 1083, 1081, 1079, 1077, 1075, 1073, 1071, 1069, 1067, 1065,
-    1063, 1061, 1059, 1057, 1055, 1053, 1051, 1049, 1047, 1045, 1043,
-    1041, 1039, 1036, 1034, 1032, 1030, 1028, 1026, 1024, 1022, 1020,
-    1018, 1016, 1014, 1012, 1010, 1008, 1006, 1004, 1002, 1000, 998, 996,
-    994, 992, 990, 988, 986, 984, 981, 979, 977, 975, 973, 971, 969, 967,
-    965, 963, 961, 959, 957, 955, 953, 951, 949, 947, 945, 943, 941, 939,
-    937, 935, 933, 931, 929, 927, 925, 922, 920, 918, 916, 914, 912, 910,
-    908, 906, 904, 902, 900, 898, 896, 894, 892, 890, 888, 886, 884, 882,
-    880, 878, 876, 874, 872, 870, 868, 866, 863, 861, 859, 857, 855, 853,
-    851, 849, 847, 845, 843, 841, 839, 837, 835, 833, 831, 829, 827, 825,
-    823, 821, 819, 817, 815, 813, 811, 809, 807, 805, 803, 800, 798, 796,
-    794, 792, 790, 788, 786, 784, 782, 780, 778, 776, 774, 772, 770, 768,
-    766, 764, 762, 760, 758, 756, 754, 752, 750, 748, 746, 744, 742, 740,
-    738, 736, 733, 731, 729, 727, 725, 723, 721, 719, 717, 715, 713, 711,
-    709, 707, 705, 703, 701, 699, 697, 695, 693, 691, 689, 687, 685, 683,
-    681, 679, 677, 675, 673, 671, 669, 666, 664, 662, 660, 658, 656, 654,
-    652, 650, 648, 646, 644, 642, 640, 638, 636, 634, 632, 630, 628, 626,
-    624, 622, 620, 618, 616, 614, 612, 610, 608, 605, 603, 601, 599, 597,
-    595, 593, 591, 589, 587, 585, 583, 581, 579, 577, 575, 573, 571, 569,
-    567, 565, 563, 561, 559, 556, 554, 552, 550, 548, 546, 544, 542, 540,
-    538, 536, 534, 532, 530, 528, 526, 524, 522, 520, 517, 515, 513, 511,
-    509, 507, 505, 503, 501, 499, 497, 495, 493, 491, 489, 487, 484, 482,
-    480, 478, 476, 474, 472, 470, 468, 466, 464, 462, 460, 457, 455, 453,
-    451, 449, 447, 445, 443, 441, 439, 437, 434, 432, 430, 428, 426, 424,
-    422, 420, 418, 416, 413, 411, 409, 407, 405, 403, 401, 399, 396, 394,
-    392, 390, 388, 386, 384, 382, 380, 377, 375, 373, 371, 369, 367, 365,
-    362, 360, 358, 356, 354, 352, 350, 347, 345, 343, 341, 339, 337, 334,
-    332, 330, 328, 326, 324, 322, 319, 317, 315, 313, 311, 309, 306, 304,
-    302, 300, 298, 295, 293, 291, 289, 287, 285, 282, 280, 278, 276, 274,
-    272, 269, 267, 265, 263, 261, 258, 256, 254, 252, 250, 248, 245, 243,
-    241, 239, 237, 234, 232, 230, 228, 226, 224, 221, 219, 217, 215, 213,
-    211, 208, 206, 204, 202, 200, 198, 195, 193, 191, 189, 187, 185, 183,
-    180, 178, 176, 174, 172, 170, 168, 166, 164, 161, 159, 157, 155, 153,
-    151, 149, 147, 145, 143, 141, 139, 137, 135, 133, 131, 129, 127, 125,
-    123, 121, 119, 117, 115, 113, 111, 109, 107, 105, 103, 101, 99, 98,
-    96, 94, 92, 90, 88, 87, 85, 83, 81, 80, 78, 76, 74, 73, 71, 69, 68,
-    66, 64, 63, 61, 60, 58, 57, 55, 53, 52, 51, 49, 48, 46, 45, 43, 42,
-    41, 39, 38, 37, 35, 34, 33, 32, 30, 29, 28, 27, 26, 25, 24, 23, 22,
-    21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 12, 11, 10, 9, 9, 8, 7, 7, 6,
-    6, 5, 5, 4, 4, 3, 3, 3, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0    
-]
+# One mip-map level per octave of phase increment: level i holds the first
+# 128 >> i harmonics of the shape, which stay below Nyquist as long as the
+# increment is below 2^(24 + i), whatever the sample rate. The period of
+# each level halves with the number of harmonics, to keep the error of
+# the linear interpolation low, down to a minimum size. The levels of a
+# shape are concatenated in a single table.
+
+NUM_MIPMAP_LEVELS = 8
+
+def mipmap_size(level):
+  return max(WAVETABLE_SIZE >> level, 128)
+
+def sinc(x):
+  return 1.0 if x == 0 else math.sin(math.pi * x) / (math.pi * x)
+
+def ramp_harmonics(n):
+  return -2 / (math.pi * n)
+
+# stored from the rising zero crossing, read a quarter period late: a
+# square wave smoothed by a box filter of the ramp's width
+def trapezoid_harmonics(n, rise=0.25):
+  square = 4 / (math.pi * n) if n % 2 else 0
+  return square * sinc(n * rise)
+
+def triangle_harmonics(n):
+  return trapezoid_harmonics(n, rise=0.5)
+
+def mipmap(harmonics, symmetry):
+  table = []
+  for level in xrange(NUM_MIPMAP_LEVELS):
+    size = mipmap_size(level)
+    x = [i / float(size) for i in xrange(size + 1)]
+    num_harmonics = 128 >> level
+    n = range(1, num_harmonics + 1)
+    # Lanczos sigma factors tame the Gibbs ripples of the truncated series
+    gains = [harmonics(k) * sinc(k / float(num_harmonics + 1)) for k in n]
+    wave = [sum(math.sin(2 * math.pi * (t * k)) * g for k, g in zip(n, gains))
+            for t in x]
+    scale = 32767 / max(abs(w) for w in wave)
+    table.extend(symmetry([int(w * scale) for w in wave], size))
+  return table
+
+waveforms.append(('saw_mipmap', mipmap(ramp_harmonics, half_wave)))
+waveforms.append(('tri_mipmap', mipmap(triangle_harmonics, quarter_wave)))
+waveforms.append(('trap_mipmap', mipmap(trapezoid_harmonics, quarter_wave)))
 
-tri100 = [
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
-    2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7,
-    7, 8, 8, 8, 9, 9, 9, 10, 10, 11, 11, 11, 12, 12, 13, 13, 13, 14, 14,
-    15, 15, 16, 16, 17, 17, 18, 18, 19, 19, 20, 20, 21, 21, 22, 22, 23,
-    23, 24, 25, 25, 26, 26, 27, 28, 28, 29, 29, 30, 31, 31, 32, 33, 33,
-    34, 35, 35, 36, 37, 37, 38, 39, 40, 40, 41, 42, 43, 43, 44, 45, 46,
-    46, 47, 48, 49, 50, 50, 51, 52, 53, 54, 55, 56, 56, 57, 58, 59, 60,
-    61, 62, 63, 64, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
-    77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 93, 94,
-    95, 96, 97, 98, 99, 100, 101, 103, 104, 105, 106, 107, 108, 110, 111,
-    112, 113, 114, 115, 117, 118, 119, 120, 122, 123, 124, 125, 127, 128,
-    129, 130, 132, 133, 134, 135, 137, 138, 139, 141, 142, 143, 145, 146,
-    147, 149, 150, 151, 153, 154, 155, 157, 158, 159, 161, 162, 164, 165,
-    166, 168, 169, 171, 172, 174, 175, 176, 178, 179, 181, 182, 184, 185,
-    187, 188, 190, 191, 193, 194, 196, 197, 199, 200, 202, 203, 205, 206,
-    208, 209, 211, 212, 214, 215, 217, 219, 220, 222, 223, 225, 227, 228,
-    230, 231, 233, 235, 236, 238, 239, 241, 243, 244, 246, 248, 249, 251,
-    253, 254, 256, 258, 259, 261, 263, 264, 266, 268, 269, 271, 273, 275,
-    276, 278, 280, 281, 283, 285, 287, 288, 290, 292, 294, 295, 297, 299,
-    301, 303, 304, 306, 308, 310, 311, 313, 315, 317, 319, 320, 322, 324,
-    326, 328, 330, 331, 333, 335, 337, 339, 341, 342, 344, 346, 348, 350,
-    352, 354, 355, 357, 359, 361, 363, 365, 367, 369, 371, 373, 374, 376,
-    378, 380, 382, 384, 386, 388, 390, 392, 394, 396, 398, 399, 401, 403,
-    405, 407, 409, 411, 413, 415, 417, 419, 421, 423, 425, 427, 429, 431,
-    433, 435, 437, 439, 441, 443, 445, 447, 449, 451, 453, 455, 457, 459,
-    461, 463, 465, 467, 469, 471, 473, 475, 477, 479, 482, 484, 486, 488,
-    490, 492, 494, 496, 498, 500, 502, 504, 506, 508, 510, 513, 515, 517,
-    519, 521, 523, 525, 527, 529, 531, 534, 536, 538, 540, 542, 544, 546,
-    548, 550, 553, 555, 557, 559, 561, 563, 565, 568, 570, 572, 574, 576,
-    578, 580, 583, 585, 587, 589, 591, 593, 595, 598, 600, 602, 604, 606,
-    608, 611, 613, 615, 617, 619, 621, 624, 626, 628, 630, 632, 635, 637,
-    639, 641, 643, 646, 648, 650, 652, 654, 657, 659, 661, 663, 665, 668,
-    670, 672, 674, 676, 679, 681, 683, 685, 687, 690, 692, 694, 696, 699,
-    701, 703, 705, 707, 710, 712, 714, 716, 719, 721, 723, 725, 728, 730,
-    732, 734, 737, 739, 741, 743, 746, 748, 750, 752, 755, 757, 759, 761,
-    764, 766, 768, 770, 773, 775, 777, 779, 782, 784, 786, 788, 791, 793,
-    795, 797, 800, 802, 804, 807, 809, 811, 813, 816, 818, 820, 822, 825,
-    827, 829, 832, 834, 836, 838, 841, 843, 845, 848, 850, 852, 854, 857,
-    859, 861, 864, 866, 868, 870, 873, 875, 877, 880, 882, 884, 886, 889,
-    891, 893, 896, 898, 900, 902, 905, 907, 909, 912, 914, 916, 919, 921,
-    923, 925, 928, 930, 932, 935, 937, 939, 942, 944, 946, 948, 951, 953,
-    955, 958, 960, 962, 965, 967, 969, 971, 974, 976, 978, 981, 983, 985,
-    988, 990, 992, 994, 997, 999, 1001, 1004, 1006, 1008, 1011, 1013,
-    1015, 1018, 1020, 1022, 1024, 1027, 1029, 1031, 1034, 1036, 1038,
-    1041, 1043, 1045, 1048, 1050, 1052, 1055, 1057, 1059, 1061, 1064,
-    1066, 1068, 1071, 1073, 1075, 1078, 1080, 1082, 1085, 1087, 1089,
-    1091, 1094, 1096, 1098, 1101, 1103, 1105, 1108, 1110, 1112, 1115,
-    1117, 1119, 1122, 1124, 1126, 1128, 1131, 1133, 1135, 1138, 1140,
-    1142, 1145, 1147, 1149, 1152, 1154, 1156, 1158, 1161, 1163, 1165,
-    1168, 1170, 1172, 1175, 1177, 1179, 1182, 1184, 1186, 1188, 1191,
-    1193, 1195, 1198, 1200, 1202, 1205, 1207, 1209, 1212, 1214, 1216,
-    1218, 1221, 1223, 1225, 1228, 1230, 1232, 1235, 1237, 1239, 1242,
-    1244, 1246, 1248, 1251, 1253, 1255, 1258, 1260, 1262, 1265, 1267,
-    1269, 1271, 1274, 1276, 1278, 1281, 1283, 1285, 1288, 1290, 1292,
-    1294, 1297, 1299, 1301, 1304, 1306, 1308, 1311, 1313, 1315, 1317,
-    1320, 1322, 1324, 1327, 1329, 1331, 1334, 1336, 1338, 1340, 1343,
-    1345, 1347, 1350, 1352, 1354, 1356, 1359, 1361, 1363, 1366, 1368,
-    1370, 1372, 1375, 1377, 1379, 1382, 1384, 1386, 1389, 1391, 1393,
-    1395, 1398, 1400, 1402, 1405, 1407, 1409, 1411, 1414, 1416, 1418,
-    1421, 1423, 1425, 1427, 1430, 1432, 1434, 1436, 1439, 1441, 1443,
-    1446, 1448, 1450, 1452, 1455, 1457, 1459, 1462, 1464, 1466, 1468,
-    1471, 1473, 1475, 1477, 1480, 1482, 1484, 1487, 1489, 1491, 1493,
-    1496, 1498, 1500, 1503, 1505, 1507, 1509, 1512, 1514, 1516, 1518,
-    1521, 1523, 1525, 1527, 1530, 1532, 1534, 1537, 1539, 1541, 1543,
-    1546, 1548, 1550, 1552, 1555, 1557, 1559, 1561, 1564, 1566, 1568,
-    1570, 1573, 1575, 1577, 1580, 1582, 1584, 1586, 1589, 1591, 1593,
-    1595, 1598, 1600, 1602, 1604, 1607, 1609, 1611, 1613, 1616, 1618,
-    1620, 1622, 1625, 1627, 1629, 1631, 1634, 1636, 1638, 1640, 1643,
-    1645, 1647, 1649, 1652, 1654, 1656, 1658, 1661, 1663, 1665, 1667,
-    1670, 1672, 1674, 1676, 1679, 1681, 1683, 1685, 1688, 1690, 1692,
-    1694, 1697, 1699, 1701, 1703, 1706, 1708, 1710, 1712, 1715, 1717,
-    1719, 1721, 1723, 1726, 1728, 1730, 1732, 1735, 1737, 1739, 1741,
-    1744, 1746, 1748, 1750, 1753, 1755, 1757, 1759, 1761, 1764, 1766,
-    1768, 1770, 1773, 1775, 1777, 1779, 1782, 1784, 1786, 1788, 1790,
-    1793, 1795, 1797, 1799, 1802, 1804, 1806, 1808, 1810, 1813, 1815,
-    1817, 1819, 1822, 1824, 1826, 1828, 1830, 1833, 1835, 1837, 1839,
-    1842, 1844, 1846, 1848, 1850, 1853, 1855, 1857, 1859, 1862, 1864,
-    1866, 1868, 1870, 1873, 1875, 1877, 1879, 1882, 1884, 1886, 1888,
-    1890, 1893, 1895, 1897, 1899, 1901, 1904, 1906, 1908, 1910, 1912,
-    1915, 1917, 1919, 1921, 1924, 1926, 1928, 1930, 1932, 1935, 1937,
-    1939, 1941, 1943, 1946, 1948, 1950, 1952, 1954, 1957, 1959, 1961,
-    1963, 1965, 1968, 1970, 1972, 1974, 1976, 1979, 1981, 1983, 1985,
-    1987, 1990, 1992, 1994, 1996, 1998, 2001, 2003, 2005, 2007, 2009,
-    2012, 2014, 2016, 2018, 2020, 2023, 2025, 2027, 2029, 2031, 2034,
-    2036, 2038, 2040, 2042, 2045, 2047, 2049, 2051, 2053, 2056, 2058,
-    2060, 2062, 2064, 2067, 2069, 2071, 2073, 2075, 2078, 2080, 2082,
-    2084, 2086, 2088, 2091, 2093, 2095, 2097, 2099, 2102, 2104, 2106,
-    2108, 2110, 2113, 2115, 2117, 2119, 2121, 2123, 2126, 2128, 2130,
-    2132, 2134, 2137, 2139, 2141, 2143, 2145, 2148, 2150, 2152, 2154,
-    2156, 2158, 2161, 2163, 2165, 2167, 2169, 2172, 2174, 2176, 2178,
-    2180, 2182, 2185, 2187, 2189, 2191, 2193, 2196, 2198, 2200, 2202,
-    2204, 2206, 2209, 2211, 2213, 2215, 2217, 2219, 2222, 2224, 2226,
-    2228, 2230, 2233, 2235, 2237, 2239, 2241, 2243, 2246, 2248, 2250,
-    2252, 2254, 2256, 2259, 2261, 2263, 2265, 2267, 2269, 2272, 2274,
-    2276, 2278, 2280, 2283, 2285, 2287, 2289, 2291, 2293, 2296, 2298,
-    2300, 2302, 2304, 2306, 2309, 2311, 2313, 2315, 2317, 2319, 2322,
-    2324, 2326, 2328, 2330, 2332, 2335, 2337, 2339, 2341, 2343, 2345,
-    2348, 2350, 2352, 2354, 2356, 2358, 2361, 2363, 2365, 2367, 2369,
-    2371, 2374, 2376, 2378, 2380, 2382, 2384, 2387, 2389, 2391, 2393,
-    2395, 2397, 2400, 2402, 2404, 2406, 2408, 2410, 2413, 2415, 2417,
-    2419, 2421, 2423, 2426, 2428, 2430, 2432, 2434, 2436, 2439, 2441,
-    2443, 2445, 2447, 2449, 2452, 2454, 2456, 2458, 2460, 2462, 2464,
-    2467, 2469, 2471, 2473, 2475, 2477, 2480, 2482, 2484, 2486, 2488,
-    2490, 2493, 2495, 2497, 2499, 2501, 2503, 2506, 2508, 2510, 2512,
-    2514, 2516, 2518, 2521, 2523, 2525, 2527, 2529, 2531, 2534, 2536,
-    2538, 2540, 2542, 2544, 2547, 2549, 2551, 2553, 2555, 2557, 2559,
-    2562, 2564, 2566, 2568, 2570, 2572, 2575, 2577, 2579, 2581, 2583,
-    2585, 2588, 2590, 2592, 2594, 2596, 2598, 2600, 2603, 2605, 2607,
-    2609, 2611, 2613, 2616, 2618, 2620, 2622, 2624, 2626, 2628, 2631,
-    2633, 2635, 2637, 2639, 2641, 2644, 2646, 2648, 2650, 2652, 2654,
-    2656, 2659, 2661, 2663, 2665, 2667, 2669, 2672, 2674, 2676, 2678,
-    2680, 2682, 2684, 2687, 2689, 2691, 2693, 2695, 2697, 2700, 2702,
-    2704, 2706, 2708, 2710, 2712, 2715, 2717, 2719, 2721, 2723, 2725,
-    2728, 2730, 2732, 2734, 2736, 2738, 2740, 2743, 2745, 2747, 2749,
-    2751, 2753, 2756, 2758, 2760, 2762, 2764, 2766, 2768, 2771, 2773,
-    2775, 2777, 2779, 2781, 2783, 2786, 2788, 2790, 2792, 2794, 2796,
-    2799, 2801, 2803, 2805, 2807, 2809, 2811, 2814, 2816, 2818, 2820,
-    2822, 2824, 2827, 2829, 2831, 2833, 2835, 2837, 2839, 2842, 2844,
-    2846, 2848, 2850, 2852, 2854, 2857, 2859, 2861, 2863, 2865, 2867,
-    2870, 2872, 2874, 2876, 2878, 2880, 2882, 2885, 2887, 2889, 2891,
-    2893, 2895, 2897, 2900, 2902, 2904, 2906, 2908, 2910, 2913, 2915,
-    2917, 2919, 2921, 2923, 2925, 2928, 2930, 2932, 2934, 2936, 2938,
-    2940, 2943, 2945, 2947, 2949, 2951, 2953, 2956, 2958, 2960, 2962,
-    2964, 2966, 2968, 2971, 2973, 2975, 2977, 2979, 2981, 2983, 2986,
-    2988, 2990, 2992, 2994, 2996, 2999, 3001, 3003, 3005, 3007, 3009,
-    3011, 3014, 3016, 3018, 3020, 3022, 3024, 3026, 3029, 3031, 3033,
-    3035, 3037, 3039, 3042, 3044, 3046, 3048, 3050, 3052, 3054, 3057,
-    3059, 3061, 3063, 3065, 3067, 3069, 3072, 3074, 3076, 3078, 3080,
-    3082, 3084, 3087, 3089, 3091, 3093, 3095, 3097, 3100, 3102, 3104,
-    3106, 3108, 3110, 3112, 3115, 3117, 3119, 3121, 3123, 3125, 3127,
-    3130, 3132, 3134, 3136, 3138, 3140, 3143, 3145, 3147, 3149, 3151,
-    3153, 3155, 3158, 3160, 3162, 3164, 3166, 3168, 3170, 3173, 3175,
-    3177, 3179, 3181, 3183, 3186, 3188, 3190, 3192, 3194, 3196, 3198,
-    3201, 3203, 3205, 3207, 3209, 3211, 3213, 3216, 3218, 3220, 3222,
-    3224, 3226, 3229, 3231, 3233, 3235, 3237, 3239, 3241, 3244, 3246,
-    3248, 3250, 3252, 3254, 3256, 3259, 3261, 3263, 3265, 3267, 3269,
-    3272, 3274, 3276, 3278, 3280, 3282, 3284, 3287, 3289, 3291, 3293,
-    3295, 3297, 3299, 3302, 3304, 3306, 3308, 3310, 3312, 3315, 3317,
-    3319, 3321, 3323, 3325, 3327, 3330, 3332, 3334, 3336, 3338, 3340,
-    3342, 3345, 3347, 3349, 3351, 3353, 3355, 3358, 3360, 3362, 3364,
-    3366, 3368, 3370, 3373, 3375, 3377, 3379, 3381, 3383, 3385, 3388,
-    3390, 3392, 3394, 3396, 3398, 3401, 3403, 3405, 3407, 3409, 3411,
-    3413, 3416, 3418, 3420, 3422, 3424, 3426, 3428, 3431, 3433, 3435,
-    3437, 3439, 3441, 3444, 3446, 3448, 3450, 3452, 3454, 3456, 3459,
-    3461, 3463, 3465, 3467, 3469, 3472, 3474, 3476, 3478, 3480, 3482,
-    3484, 3487, 3489, 3491, 3493, 3495, 3497, 3499, 3502, 3504, 3506,
-    3508, 3510, 3512, 3515, 3517, 3519, 3521, 3523, 3525, 3527, 3530,
-    3532, 3534, 3536, 3538, 3540, 3543, 3545, 3547, 3549, 3551, 3553,
-    3555, 3558, 3560, 3562, 3564, 3566, 3568, 3570, 3573, 3575, 3577,
-    3579, 3581, 3583, 3586, 3588, 3590, 3592, 3594, 3596, 3598, 3601,
-    3603, 3605, 3607, 3609, 3611, 3614, 3616, 3618, 3620, 3622, 3624,
-    3626, 3629, 3631, 3633, 3635, 3637, 3639, 3641, 3644, 3646, 3648,
-    3650, 3652, 3654, 3657, 3659, 3661, 3663, 3665, 3667, 3669, 3672,
-    3674, 3676, 3678, 3680, 3682, 3685, 3687, 3689, 3691, 3693, 3695,
-    3697, 3700, 3702, 3704, 3706, 3708, 3710, 3713, 3715, 3717, 3719,
-    3721, 3723, 3725, 3728, 3730, 3732, 3734, 3736, 3738, 3740, 3743,
-    3745, 3747, 3749, 3751, 3753, 3756, 3758, 3760, 3762, 3764, 3766,
-    3768, 3771, 3773, 3775, 3777, 3779, 3781, 3784, 3786, 3788, 3790,
-    3792, 3794, 3796, 3799, 3801, 3803, 3805, 3807, 3809, 3812, 3814,
-    3816, 3818, 3820, 3822, 3824, 3827, 3829, 3831, 3833, 3835, 3837,
-    3840, 3842, 3844, 3846, 3848, 3850, 3852, 3855, 3857, 3859, 3861,
-    3863, 3865, 3868, 3870, 3872, 3874, 3876, 3878, 3880, 3883, 3885,
-    3887, 3889, 3891, 3893, 3896, 3898, 3900, 3902, 3904, 3906, 3908,
-    3911, 3913, 3915, 3917, 3919, 3921, 3923, 3926, 3928, 3930, 3932,
-    3934, 3936, 3939, 3941, 3943, 3945, 3947, 3949, 3951, 3954, 3956,
-    3958, 3960, 3962, 3964, 3967, 3969, 3971, 3973, 3975, 3977, 3979,
-    3982, 3984, 3986, 3988, 3990, 3992, 3995, 3997, 3999, 4001, 4003,
-    4005, 4007, 4010, 4012, 4014, 4016, 4018, 4020, 4023, 4025, 4027,
-    4029, 4031, 4033, 4035, 4038, 4040, 4042, 4044, 4046, 4048, 4051,
-    4053, 4055, 4057, 4059, 4061, 4063, 4066, 4068, 4070, 4072, 4074,
-    4076, 4079, 4081, 4083, 4085, 4087, 4089, 4091, 4094, 4096, 4098,
-    4100, 4102, 4104, 4107, 4109, 4111, 4113, 4115, 4117, 4119, 4122,
-    4124, 4126, 4128, 4130, 4132, 4135, 4137, 4139, 4141, 4143, 4145,
-    4147, 4150, 4152, 4154, 4156, 4158, 4160, 4163, 4165, 4167, 4169,
-    4171, 4173, 4175, 4178, 4180, 4182, 4184, 4186, 4188, 4191, 4193,
-    4195, 4197, 4199, 4201, 4203, 4206, 4208, 4210, 4212, 4214, 4216,
-    4219, 4221, 4223, 4225, 4227, 4229, 4231, 4234, 4236, 4238, 4240,
-    4242, 4244, 4247, 4249, 4251, 4253, 4255, 4257, 4259, 4262, 4264,
-    4266, 4268, 4270, 4272, 4275, 4277, 4279, 4281, 4283, 4285, 4287,
-    4290, 4292, 4294, 4296, 4298, 4300, 4302, 4305, 4307, 4309, 4311,
-    4313, 4315, 4318, 4320, 4322, 4324, 4326, 4328, 4330, 4333, 4335,
-    4337, 4339, 4341, 4343, 4346, 4348, 4350, 4352, 4354, 4356, 4358,
-    4361, 4363, 4365, 4367, 4369, 4371, 4374, 4376, 4378, 4380, 4382,
-    4384, 4386, 4389, 4391, 4393, 4395, 4397, 4399, 4402, 4404, 4406,
-    4408, 4410, 4412, 4414, 4417, 4419, 4421, 4423, 4425, 4427, 4430,
-    4432, 4434, 4436, 4438, 4440, 4442, 4445, 4447, 4449, 4451, 4453,
-    4455, 4458, 4460, 4462, 4464, 4466, 4468, 4470, 4473, 4475, 4477,
-    4479, 4481, 4483, 4485, 4488, 4490, 4492, 4494, 4496, 4498, 4501,
-    4503, 4505, 4507, 4509, 4511, 4513, 4516, 4518, 4520, 4522, 4524,
-    4526, 4529, 4531, 4533, 4535, 4537, 4539, 4541, 4544, 4546, 4548,
-    4550, 4552, 4554, 4557, 4559, 4561, 4563, 4565, 4567, 4569, 4572,
-    4574, 4576, 4578, 4580, 4582, 4584, 4587, 4589, 4591, 4593, 4595,
-    4597, 4600, 4602, 4604, 4606, 4608, 4610, 4612, 4615, 4617, 4619,
-    4621, 4623, 4625, 4628, 4630, 4632, 4634, 4636, 4638, 4640, 4643,
-    4645, 4647, 4649, 4651, 4653, 4655, 4658, 4660, 4662, 4664, 4666,
-    4668, 4671, 4673, 4675, 4677, 4679, 4681, 4683, 4686, 4688, 4690,
-    4692, 4694, 4696, 4699, 4701, 4703, 4705, 4707, 4709, 4711, 4714,
-    4716, 4718, 4720, 4722, 4724, 4726, 4729, 4731, 4733, 4735, 4737,
-    4739, 4742, 4744, 4746, 4748, 4750, 4752, 4754, 4757, 4759, 4761,
-    4763, 4765, 4767, 4770, 4772, 4774, 4776, 4778, 4780, 4782, 4785,
-    4787, 4789, 4791, 4793, 4795, 4797, 4800, 4802, 4804, 4806, 4808,
-    4810, 4813, 4815, 4817, 4819, 4821, 4823, 4825, 4828, 4830, 4832,
-    4834, 4836, 4838, 4840, 4843, 4845, 4847, 4849, 4851, 4853, 4856,
-    4858, 4860, 4862, 4864, 4866, 4868, 4871, 4873, 4875, 4877, 4879,
-    4881, 4883, 4886, 4888, 4890, 4892, 4894, 4896, 4899, 4901, 4903,
-    4905, 4907, 4909, 4911, 4914, 4916, 4918, 4920, 4922, 4924, 4926,
-    4929, 4931, 4933, 4935, 4937, 4939, 4942, 4944, 4946, 4948, 4950,
-    4952, 4954, 4957, 4959, 4961, 4963, 4965, 4967, 4969, 4972, 4974,
-    4976, 4978, 4980, 4982, 4985, 4987, 4989, 4991, 4993, 4995, 4997,
-    5000, 5002, 5004, 5006, 5008, 5010, 5012, 5015, 5017, 5019, 5021,
-    5023, 5025, 5028, 5030, 5032, 5034, 5036, 5038, 5040, 5043, 5045,
-    5047, 5049, 5051, 5053, 5055, 5058, 5060, 5062, 5064, 5066, 5068,
-    5071, 5073, 5075, 5077, 5079, 5081, 5083, 5086, 5088, 5090, 5092,
-    5094, 5096, 5098, 5101, 5103, 5105, 5107, 5109, 5111, 5113, 5116,
-    5118, 5120, 5122, 5124, 5126, 5129, 5131, 5133, 5135, 5137, 5139,
-    5141, 5144, 5146, 5148, 5150, 5152, 5154, 5156, 5159, 5161, 5163,
-    5165, 5167, 5169, 5172, 5174, 5176, 5178, 5180, 5182, 5184, 5187,
-    5189, 5191, 5193, 5195, 5197, 5199, 5202, 5204, 5206, 5208, 5210,
-    5212, 5215, 5217, 5219, 5221, 5223, 5225, 5227, 5230, 5232, 5234,
-    5236, 5238, 5240, 5242, 5245, 5247, 5249, 5251, 5253, 5255, 5258,
-    5260, 5262, 5264, 5266, 5268, 5270, 5273, 5275, 5277, 5279, 5281,
-    5283, 5285, 5288, 5290, 5292, 5294, 5296, 5298, 5301, 5303, 5305,
-    5307, 5309, 5311, 5313, 5316, 5318, 5320, 5322, 5324, 5326, 5328,
-    5331, 5333, 5335, 5337, 5339, 5341, 5344, 5346, 5348, 5350, 5352,
-    5354, 5356, 5359, 5361, 5363, 5365, 5367, 5369, 5371, 5374, 5376,
-    5378, 5380, 5382, 5384, 5387, 5389, 5391, 5393, 5395, 5397, 5399,
-    5402, 5404, 5406, 5408, 5410, 5412, 5414, 5417, 5419, 5421, 5423,
-    5425, 5427, 5430, 5432, 5434, 5436, 5438, 5440, 5442, 5445, 5447,
-    5449, 5451, 5453, 5455, 5458, 5460, 5462, 5464, 5466, 5468, 5470,
-    5473, 5475, 5477, 5479, 5481, 5483, 5486, 5488, 5490, 5492, 5494,
-    5496, 5498, 5501, 5503, 5505, 5507, 5509, 5511, 5514, 5516, 5518,
-    5520, 5522, 5524, 5526, 5529, 5531, 5533, 5535, 5537, 5539, 5542,
-    5544, 5546, 5548, 5550, 5552, 5554, 5557, 5559, 5561, 5563, 5565,
-    5567, 5570, 5572, 5574, 5576, 5578, 5580, 5582, 5585, 5587, 5589,
-    5591, 5593, 5595, 5598, 5600, 5602, 5604, 5606, 5608, 5610, 5613,
-    5615, 5617, 5619, 5621, 5623, 5626, 5628, 5630, 5632, 5634, 5636,
-    5639, 5641, 5643, 5645, 5647, 5649, 5651, 5654, 5656, 5658, 5660,
-    5662, 5664, 5667, 5669, 5671, 5673, 5675, 5677, 5680, 5682, 5684,
-    5686, 5688, 5690, 5692, 5695, 5697, 5699, 5701, 5703, 5705, 5708,
-    5710, 5712, 5714, 5716, 5718, 5721, 5723, 5725, 5727, 5729, 5731,
-    5734, 5736, 5738, 5740, 5742, 5744, 5746, 5749, 5751, 5753, 5755,
-    5757, 5759, 5762, 5764, 5766, 5768, 5770, 5772, 5775, 5777, 5779,
-    5781, 5783, 5785, 5788, 5790, 5792, 5794, 5796, 5798, 5801, 5803,
-    5805, 5807, 5809, 5811, 5814, 5816, 5818, 5820, 5822, 5824, 5827,
-    5829, 5831, 5833, 5835, 5837, 5840, 5842, 5844, 5846, 5848, 5850,
-    5853, 5855, 5857, 5859, 5861, 5863, 5866, 5868, 5870, 5872, 5874,
-    5876, 5879, 5881, 5883, 5885, 5887, 5889, 5892, 5894, 5896, 5898,
-    5900, 5902, 5905, 5907, 5909, 5911, 5913, 5916, 5918, 5920, 5922,
-    5924, 5926, 5929, 5931, 5933, 5935, 5937, 5939, 5942, 5944, 5946,
-    5948, 5950, 5952, 5955, 5957, 5959, 5961, 5963, 5966, 5968, 5970,
-    5972, 5974, 5976, 5979, 5981, 5983, 5985, 5987, 5990, 5992, 5994,
-    5996, 5998, 6000, 6003, 6005, 6007, 6009, 6011, 6013, 6016, 6018,
-    6020, 6022, 6024, 6027, 6029, 6031, 6033, 6035, 6037, 6040, 6042,
-    6044, 6046, 6048, 6051, 6053, 6055, 6057, 6059, 6062, 6064, 6066,
-    6068, 6070, 6072, 6075, 6077, 6079, 6081, 6083, 6086, 6088, 6090,
-    6092, 6094, 6097, 6099, 6101, 6103, 6105, 6107, 6110, 6112, 6114,
-    6116, 6118, 6121, 6123, 6125, 6127, 6129, 6132, 6134, 6136, 6138,
-    6140, 6143, 6145, 6147, 6149, 6151, 6154, 6156, 6158, 6160, 6162,
-    6164, 6167, 6169, 6171, 6173, 6175, 6178, 6180, 6182, 6184, 6186,
-    6189, 6191, 6193, 6195, 6197, 6200, 6202, 6204, 6206, 6208, 6211,
-    6213, 6215, 6217, 6219, 6222, 6224, 6226, 6228, 6231, 6233, 6235,
-    6237, 6239, 6242, 6244, 6246, 6248, 6250, 6253, 6255, 6257, 6259,
-    6261, 6264, 6266, 6268, 6270, 6272, 6275, 6277, 6279, 6281, 6283,
-    6286, 6288, 6290, 6292, 6295, 6297, 6299, 6301, 6303, 6306, 6308,
-    6310, 6312, 6314, 6317, 6319, 6321, 6323, 6326, 6328, 6330, 6332,
-    6334, 6337, 6339, 6341, 6343, 6346, 6348, 6350, 6352, 6354, 6357,
-    6359, 6361, 6363, 6366, 6368, 6370, 6372, 6374, 6377, 6379, 6381,
-    6383, 6386, 6388, 6390, 6392, 6394, 6397, 6399, 6401, 6403, 6406,
-    6408, 6410, 6412, 6414, 6417, 6419, 6421, 6423, 6426, 6428, 6430,
-    6432, 6435, 6437, 6439, 6441, 6444, 6446, 6448, 6450, 6452, 6455,
-    6457, 6459, 6461, 6464, 6466, 6468, 6470, 6473, 6475, 6477, 6479,
-    6482, 6484, 6486, 6488, 6490, 6493, 6495, 6497, 6499, 6502, 6504,
-    6506, 6508, 6511, 6513, 6515, 6517, 6520, 6522, 6524, 6526, 6529,
-    6531, 6533, 6535, 6538, 6540, 6542, 6544, 6547, 6549, 6551, 6553,
-    6556, 6558, 6560, 6562, 6565, 6567, 6569, 6571, 6574, 6576, 6578,
-    6580, 6583, 6585, 6587, 6589, 6592, 6594, 6596, 6598, 6601, 6603,
-    6605, 6608, 6610, 6612, 6614, 6617, 6619, 6621, 6623, 6626, 6628,
-    6630, 6632, 6635, 6637, 6639, 6641, 6644, 6646, 6648, 6650, 6653,
-    6655, 6657, 6660, 6662, 6664, 6666, 6669, 6671, 6673, 6675, 6678,
-    6680, 6682, 6685, 6687, 6689, 6691, 6694, 6696, 6698, 6700, 6703,
-    6705, 6707, 6710, 6712, 6714, 6716, 6719, 6721, 6723, 6725, 6728,
-    6730, 6732, 6735, 6737, 6739, 6741, 6744, 6746, 6748, 6751, 6753,
-    6755, 6757, 6760, 6762, 6764, 6766, 6769, 6771, 6773, 6776, 6778,
-    6780, 6782, 6785, 6787, 6789, 6792, 6794, 6796, 6798, 6801, 6803,
-    6805, 6808, 6810, 6812, 6815, 6817, 6819, 6821, 6824, 6826, 6828,
-    6831, 6833, 6835, 6837, 6840, 6842, 6844, 6847, 6849, 6851, 6853,
-    6856, 6858, 6860, 6863, 6865, 6867, 6870, 6872, 6874, 6876, 6879,
-    6881, 6883, 6886, 6888, 6890, 6893, 6895, 6897, 6899, 6902, 6904,
-    6906, 6909, 6911, 6913, 6916, 6918, 6920, 6922, 6925, 6927, 6929,
-    6932, 6934, 6936, 6939, 6941, 6943, 6945, 6948, 6950, 6952, 6955,
-    6957, 6959, 6962, 6964, 6966, 6968, 6971, 6973, 6975, 6978, 6980,
-    6982, 6985, 6987, 6989, 6992, 6994, 6996, 6998, 7001, 7003, 7005,
-    7008, 7010, 7012, 7015, 7017, 7019, 7022, 7024, 7026, 7028, 7031,
-    7033, 7035, 7038, 7040, 7042, 7045, 7047, 7049, 7052, 7054, 7056,
-    7059, 7061, 7063, 7065, 7068, 7070, 7072, 7075, 7077, 7079, 7082,
-    7084, 7086, 7089, 7091, 7093, 7095, 7098, 7100, 7102, 7105, 7107,
-    7109, 7112, 7114, 7116, 7119, 7121, 7123, 7126, 7128, 7130, 7132,
-    7135, 7137, 7139, 7142, 7144, 7146, 7149, 7151, 7153, 7156, 7158,
-    7160, 7162, 7165, 7167, 7169, 7172, 7174, 7176, 7179, 7181, 7183,
-    7186, 7188, 7190, 7192, 7195, 7197, 7199, 7202, 7204, 7206, 7209,
-    7211, 7213, 7216, 7218, 7220, 7222, 7225, 7227, 7229, 7232, 7234,
-    7236, 7239, 7241, 7243, 7245, 7248, 7250, 7252, 7255, 7257, 7259,
-    7262, 7264, 7266, 7268, 7271, 7273, 7275, 7278, 7280, 7282, 7285,
-    7287, 7289, 7291, 7294, 7296, 7298, 7301, 7303, 7305, 7307, 7310,
-    7312, 7314, 7317, 7319, 7321, 7323, 7326, 7328, 7330, 7333, 7335,
-    7337, 7339, 7342, 7344, 7346, 7349, 7351, 7353, 7355, 7358, 7360,
-    7362, 7365, 7367, 7369, 7371, 7374, 7376, 7378, 7380, 7383, 7385,
-    7387, 7390, 7392, 7394, 7396, 7399, 7401, 7403, 7405, 7408, 7410,
-    7412, 7414, 7417, 7419, 7421, 7423, 7426, 7428, 7430, 7433, 7435,
-    7437, 7439, 7442, 7444, 7446, 7448, 7450, 7453, 7455, 7457, 7459,
-    7462, 7464, 7466, 7468, 7471, 7473, 7475, 7477, 7480, 7482, 7484,
-    7486, 7489, 7491, 7493, 7495, 7497, 7500, 7502, 7504, 7506, 7509,
-    7511, 7513, 7515, 7517, 7520, 7522, 7524, 7526, 7528, 7531, 7533,
-    7535, 7537, 7539, 7542, 7544, 7546, 7548, 7550, 7553, 7555, 7557,
-    7559, 7561, 7564, 7566, 7568, 7570, 7572, 7574, 7577, 7579, 7581,
-    7583, 7585, 7587, 7590, 7592, 7594, 7596, 7598, 7600, 7603, 7605,
-    7607, 7609, 7611, 7613, 7615, 7618, 7620, 7622, 7624, 7626, 7628,
-    7630, 7633, 7635, 7637, 7639, 7641, 7643, 7645, 7647, 7650, 7652,
-    7654, 7656, 7658, 7660, 7662, 7664, 7666, 7668, 7671, 7673, 7675,
-    7677, 7679, 7681, 7683, 7685, 7687, 7689, 7691, 7693, 7696, 7698,
-    7700, 7702, 7704, 7706, 7708, 7710, 7712, 7714, 7716, 7718, 7720,
-    7722, 7724, 7726, 7728, 7730, 7732, 7734, 7736, 7738, 7741, 7743,
-    7745, 7747, 7749, 7751, 7753, 7755, 7757, 7759, 7761, 7763, 7765,
-    7766, 7768, 7770, 7772, 7774, 7776, 7778, 7780, 7782, 7784, 7786,
-    7788, 7790, 7792, 7794, 7796, 7798, 7800, 7802, 7804, 7806, 7807,
-    7809, 7811, 7813, 7815, 7817, 7819, 7821, 7823, 7825, 7827, 7828,
-    7830, 7832, 7834, 7836, 7838, 7840, 7842, 7843, 7845, 7847, 7849,
-    7851, 7853, 7855, 7856, 7858, 7860, 7862, 7864, 7866, 7867, 7869,
-    7871, 7873, 7875, 7876, 7878, 7880, 7882, 7884, 7885, 7887, 7889,
-    7891, 7892, 7894, 7896, 7898, 7900, 7901, 7903, 7905, 7906, 7908,
-    7910, 7912, 7913, 7915, 7917, 7919, 7920, 7922, 7924, 7925, 7927,
-    7929, 7930, 7932, 7934, 7935, 7937, 7939, 7940, 7942, 7944, 7945,
-    7947, 7949, 7950, 7952, 7954, 7955, 7957, 7958, 7960, 7962, 7963,
-    7965, 7966, 7968, 7970, 7971, 7973, 7974, 7976, 7977, 7979, 7981,
-    7982, 7984, 7985, 7987, 7988, 7990, 7991, 7993, 7994, 7996, 7997,
-    7999, 8000, 8002, 8003, 8005, 8006, 8008, 8009, 8011, 8012, 8014,
-    8015, 8016, 8018, 8019, 8021, 8022, 8024, 8025, 8026, 8028, 8029,
-    8031, 8032, 8033, 8035, 8036, 8037, 8039, 8040, 8041, 8043, 8044,
-    8045, 8047, 8048, 8049, 8051, 8052, 8053, 8055, 8056, 8057, 8058,
-    8060, 8061, 8062, 8064, 8065, 8066, 8067, 8069, 8070, 8071, 8072,
-    8073, 8075, 8076, 8077, 8078, 8079, 8081, 8082, 8083, 8084, 8085,
-    8086, 8088, 8089, 8090, 8091, 8092, 8093, 8094, 8095, 8097, 8098,
-    8099, 8100, 8101, 8102, 8103, 8104, 8105, 8106, 8107, 8108, 8109,
-    8110, 8111, 8112, 8113, 8114, 8115, 8116, 8117, 8118, 8119, 8120,
-    8121, 8122, 8123, 8124, 8125, 8126, 8127, 8128, 8129, 8130, 8130,
-    8131, 8132, 8133, 8134, 8135, 8136, 8137, 8137, 8138, 8139, 8140,
-    8141, 8142, 8142, 8143, 8144, 8145, 8146, 8146, 8147, 8148, 8149,
-    8149, 8150, 8151, 8152, 8152, 8153, 8154, 8154, 8155, 8156, 8156,
-    8157, 8158, 8159, 8159, 8160, 8160, 8161, 8162, 8162, 8163, 8164,
-    8164, 8165, 8165, 8166, 8167, 8167, 8168, 8168, 8169, 8169, 8170,
-    8170, 8171, 8172, 8172, 8173, 8173, 8174, 8174, 8174, 8175, 8175,
-    8176, 8176, 8177, 8177, 8178, 8178, 8179, 8179, 8179, 8180, 8180,
-    8181, 8181, 8181, 8182, 8182, 8182, 8183, 8183, 8183, 8184, 8184,
-    8184, 8185, 8185, 8185, 8185, 8186, 8186, 8186, 8187, 8187, 8187,
-    8187, 8187, 8188, 8188, 8188, 8188, 8188, 8189, 8189, 8189, 8189,
-    8189, 8189, 8190, 8190, 8190, 8190, 8190, 8190, 8190, 8190, 8191,
-    8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,
-    8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,
-    8191, 8190, 8190, 8190, 8190, 8190, 8190, 8190, 8190, 8190, 8189,
-    8189, 8189, 8189, 8189, 8189, 8188, 8188, 8188, 8188, 8188, 8187,
-    8187, 8187, 8187, 8186, 8186, 8186, 8186, 8185, 8185, 8185, 8185,
-    8184, 8184, 8184, 8183, 8183, 8183, 8182, 8182, 8182, 8181, 8181,
-    8180, 8180, 8180, 8179, 8179, 8178, 8178, 8178, 8177, 8177, 8176,
-    8176, 8175, 8175, 8174, 8174, 8173, 8173, 8172, 8172, 8171, 8171,
-    8170, 8170, 8169, 8169, 8168, 8168, 8167, 8166, 8166, 8165, 8165,
-    8164, 8163, 8163, 8162, 8162, 8161, 8160, 8160, 8159, 8158, 8158,
-    8157, 8156, 8156, 8155, 8154, 8154, 8153, 8152, 8151, 8151, 8150,
-    8149, 8148, 8148, 8147, 8146, 8145, 8145, 8144, 8143, 8142, 8141,
-    8141, 8140, 8139, 8138, 8137, 8136, 8135, 8135, 8134, 8133, 8132,
-    8131, 8130, 8129, 8128, 8127, 8127, 8126, 8125, 8124, 8123, 8122,
-    8121, 8120, 8119, 8118, 8117, 8116, 8115, 8114, 8113, 8112, 8111,
-    8110, 8109, 8108, 8107, 8106, 8105, 8104, 8103, 8102, 8101, 8100,
-    8098, 8097, 8096, 8095, 8094, 8093, 8092, 8091, 8090, 8088, 8087,
-    8086, 8085, 8084, 8083, 8081, 8080, 8079, 8078, 8077, 8076, 8074,
-    8073, 8072, 8071, 8069, 8068, 8067, 8066, 8064, 8063, 8062, 8061,
-    8059, 8058, 8057, 8056, 8054, 8053, 8052, 8050, 8049, 8048, 8046,
-    8045, 8044, 8042, 8041, 8040, 8038, 8037, 8036, 8034, 8033, 8032,
-    8030, 8029, 8027, 8026, 8025, 8023, 8022, 8020, 8019, 8017, 8016,
-    8015, 8013, 8012, 8010, 8009, 8007, 8006, 8004, 8003, 8001, 8000,
-    7998, 7997, 7995, 7994, 7992, 7991, 7989, 7988, 7986, 7985, 7983,
-    7982, 7980, 7979, 7977, 7976, 7974, 7972, 7971, 7969, 7968, 7966,
-    7964, 7963, 7961, 7960, 7958, 7956, 7955, 7953, 7952, 7950, 7948,
-    7947, 7945, 7943, 7942, 7940, 7938, 7937, 7935, 7933, 7932, 7930,
-    7928, 7927, 7925, 7923, 7922, 7920, 7918, 7916, 7915, 7913, 7911,
-    7910, 7908, 7906, 7904, 7903, 7901, 7899, 7897, 7896, 7894, 7892,
-    7890, 7888, 7887, 7885, 7883, 7881, 7880, 7878, 7876, 7874, 7872,
-    7871, 7869, 7867, 7865, 7863, 7861, 7860, 7858, 7856, 7854, 7852,
-    7850, 7849, 7847, 7845, 7843, 7841, 7839, 7837, 7836, 7834, 7832,
-    7830, 7828, 7826, 7824, 7822, 7820, 7818, 7817, 7815, 7813, 7811,
-    7809, 7807, 7805, 7803, 7801, 7799, 7797, 7795, 7793, 7792, 7790,
-    7788, 7786, 7784, 7782, 7780, 7778, 7776, 7774, 7772, 7770, 7768,
-    7766, 7764, 7762, 7760, 7758, 7756, 7754, 7752, 7750, 7748, 7746,
-    7744, 7742, 7740, 7738, 7736, 7734, 7732, 7730, 7728, 7726, 7724,
-    7722, 7720, 7718, 7716, 7714, 7712, 7709, 7707, 7705, 7703, 7701,
-    7699, 7697, 7695, 7693, 7691, 7689, 7687, 7685, 7683, 7681, 7678,
-    7676, 7674, 7672, 7670, 7668, 7666, 7664, 7662, 7660, 7657, 7655,
-    7653, 7651, 7649, 7647, 7645, 7643, 7641, 7638, 7636, 7634, 7632,
-    7630, 7628, 7626, 7623, 7621, 7619, 7617, 7615, 7613, 7611, 7608,
-    7606, 7604, 7602, 7600, 7598, 7596, 7593, 7591, 7589, 7587, 7585,
-    7583, 7580, 7578, 7576, 7574, 7572, 7570, 7567, 7565, 7563, 7561,
-    7559, 7556, 7554, 7552, 7550, 7548, 7545, 7543, 7541, 7539, 7537,
-    7534, 7532, 7530, 7528, 7526, 7523, 7521, 7519, 7517, 7515, 7512,
-    7510, 7508, 7506, 7504, 7501, 7499, 7497, 7495, 7492, 7490, 7488,
-    7486, 7484, 7481, 7479, 7477, 7475, 7472, 7470, 7468, 7466, 7463,
-    7461, 7459, 7457, 7454, 7452, 7450, 7448, 7445, 7443, 7441, 7439,
-    7436, 7434, 7432, 7430, 7427, 7425, 7423, 7421, 7418, 7416, 7414,
-    7412, 7409, 7407, 7405, 7403, 7400, 7398, 7396, 7394, 7391, 7389,
-    7387, 7384, 7382, 7380, 7378, 7375, 7373, 7371, 7369, 7366, 7364,
-    7362, 7359, 7357, 7355, 7353, 7350, 7348, 7346, 7343, 7341, 7339,
-    7337, 7334, 7332, 7330, 7327, 7325, 7323, 7321, 7318, 7316, 7314,
-    7311, 7309, 7307, 7305, 7302, 7300, 7298, 7295, 7293, 7291, 7289,
-    7286, 7284, 7282, 7279, 7277, 7275, 7272, 7270, 7268, 7266, 7263,
-    7261, 7259, 7256, 7254, 7252, 7249, 7247, 7245, 7243, 7240, 7238,
-    7236, 7233, 7231, 7229, 7226, 7224, 7222, 7220, 7217, 7215, 7213,
-    7210, 7208, 7206, 7203, 7201, 7199, 7197, 7194, 7192, 7190, 7187,
-    7185, 7183, 7180, 7178, 7176, 7173, 7171, 7169, 7167, 7164, 7162,
-    7160, 7157, 7155, 7153, 7150, 7148, 7146, 7143, 7141, 7139, 7136,
-    7134, 7132, 7130, 7127, 7125, 7123, 7120, 7118, 7116, 7113, 7111,
-    7109, 7106, 7104, 7102, 7100, 7097, 7095, 7093, 7090, 7088, 7086,
-    7083, 7081, 7079, 7076, 7074, 7072, 7069, 7067, 7065, 7063, 7060,
-    7058, 7056, 7053, 7051, 7049, 7046, 7044, 7042, 7039, 7037, 7035,
-    7033, 7030, 7028, 7026, 7023, 7021, 7019, 7016, 7014, 7012, 7009,
-    7007, 7005, 7003, 7000, 6998, 6996, 6993, 6991, 6989, 6986, 6984,
-    6982, 6979, 6977, 6975, 6973, 6970, 6968, 6966, 6963, 6961, 6959,
-    6956, 6954, 6952, 6949, 6947, 6945, 6943, 6940, 6938, 6936, 6933,
-    6931, 6929, 6926, 6924, 6922, 6920, 6917, 6915, 6913, 6910, 6908,
-    6906, 6903, 6901, 6899, 6897, 6894, 6892, 6890, 6887, 6885, 6883,
-    6880, 6878, 6876, 6874, 6871, 6869, 6867, 6864, 6862, 6860, 6857,
-    6855, 6853, 6851, 6848, 6846, 6844, 6841, 6839, 6837, 6835, 6832,
-    6830, 6828, 6825, 6823, 6821, 6819, 6816, 6814, 6812, 6809, 6807,
-    6805, 6802, 6800, 6798, 6796, 6793, 6791, 6789, 6786, 6784, 6782,
-    6780, 6777, 6775, 6773, 6770, 6768, 6766, 6764, 6761, 6759, 6757,
-    6755, 6752, 6750, 6748, 6745, 6743, 6741, 6739, 6736, 6734, 6732,
-    6729, 6727, 6725, 6723, 6720, 6718, 6716, 6714, 6711, 6709, 6707,
-    6704, 6702, 6700, 6698, 6695, 6693, 6691, 6688, 6686, 6684, 6682,
-    6679, 6677, 6675, 6673, 6670, 6668, 6666, 6664, 6661, 6659, 6657,
-    6654, 6652, 6650, 6648, 6645, 6643, 6641, 6639, 6636, 6634, 6632,
-    6630, 6627, 6625, 6623, 6621, 6618, 6616, 6614, 6611, 6609, 6607,
-    6605, 6602, 6600, 6598, 6596, 6593, 6591, 6589, 6587, 6584, 6582,
-    6580, 6578, 6575, 6573, 6571, 6569, 6566, 6564, 6562, 6560, 6557,
-    6555, 6553, 6551, 6548, 6546, 6544, 6542, 6539, 6537, 6535, 6533,
-    6530, 6528, 6526, 6524, 6521, 6519, 6517, 6515, 6512, 6510, 6508,
-    6506, 6503, 6501, 6499, 6497, 6494, 6492, 6490, 6488, 6485, 6483,
-    6481, 6479, 6476, 6474, 6472, 6470, 6468, 6465, 6463, 6461, 6459,
-    6456, 6454, 6452, 6450, 6447, 6445, 6443, 6441, 6438, 6436, 6434,
-    6432, 6430, 6427, 6425, 6423, 6421, 6418, 6416, 6414, 6412, 6409,
-    6407, 6405, 6403, 6401, 6398, 6396, 6394, 6392, 6389, 6387, 6385,
-    6383, 6381, 6378, 6376, 6374, 6372, 6369, 6367, 6365, 6363, 6361,
-    6358, 6356, 6354, 6352, 6349, 6347, 6345, 6343, 6341, 6338, 6336,
-    6334, 6332, 6329, 6327, 6325, 6323, 6321, 6318, 6316, 6314, 6312,
-    6309, 6307, 6305, 6303, 6301, 6298, 6296, 6294, 6292, 6290, 6287,
-    6285, 6283, 6281, 6279, 6276, 6274, 6272, 6270, 6267, 6265, 6263,
-    6261, 6259, 6256, 6254, 6252, 6250, 6248, 6245, 6243, 6241, 6239,
-    6237, 6234, 6232, 6230, 6228, 6226, 6223, 6221, 6219, 6217, 6215,
-    6212, 6210, 6208, 6206, 6204, 6201, 6199, 6197, 6195, 6193, 6190,
-    6188, 6186, 6184, 6182, 6179, 6177, 6175, 6173, 6171, 6168, 6166,
-    6164, 6162, 6160, 6157, 6155, 6153, 6151, 6149, 6146, 6144, 6142,
-    6140, 6138, 6135, 6133, 6131, 6129, 6127, 6124, 6122, 6120, 6118,
-    6116, 6113, 6111, 6109, 6107, 6105, 6103, 6100, 6098, 6096, 6094,
-    6092, 6089, 6087, 6085, 6083, 6081, 6078, 6076, 6074, 6072, 6070,
-    6068, 6065, 6063, 6061, 6059, 6057, 6054, 6052, 6050, 6048, 6046,
-    6043, 6041, 6039, 6037, 6035, 6033, 6030, 6028, 6026, 6024, 6022,
-    6019, 6017, 6015, 6013, 6011, 6009, 6006, 6004, 6002, 6000, 5998,
-    5995, 5993, 5991, 5989, 5987, 5985, 5982, 5980, 5978, 5976, 5974,
-    5972, 5969, 5967, 5965, 5963, 5961, 5958, 5956, 5954, 5952, 5950,
-    5948, 5945, 5943, 5941, 5939, 5937, 5935, 5932, 5930, 5928, 5926,
-    5924, 5922, 5919, 5917, 5915, 5913, 5911, 5908, 5906, 5904, 5902,
-    5900, 5898, 5895, 5893, 5891, 5889, 5887, 5885, 5882, 5880, 5878,
-    5876, 5874, 5872, 5869, 5867, 5865, 5863, 5861, 5859, 5856, 5854,
-    5852, 5850, 5848, 5846, 5843, 5841, 5839, 5837, 5835, 5833, 5830,
-    5828, 5826, 5824, 5822, 5820, 5817, 5815, 5813, 5811, 5809, 5807,
-    5804, 5802, 5800, 5798, 5796, 5794, 5791, 5789, 5787, 5785, 5783,
-    5781, 5778, 5776, 5774, 5772, 5770, 5768, 5765, 5763, 5761, 5759,
-    5757, 5755, 5752, 5750, 5748, 5746, 5744, 5742, 5739, 5737, 5735,
-    5733, 5731, 5729, 5727, 5724, 5722, 5720, 5718, 5716, 5714, 5711,
-    5709, 5707, 5705, 5703, 5701, 5698, 5696, 5694, 5692, 5690, 5688,
-    5685, 5683, 5681, 5679, 5677, 5675, 5673, 5670, 5668, 5666, 5664,
-    5662, 5660, 5657, 5655, 5653, 5651, 5649, 5647, 5644, 5642, 5640,
-    5638, 5636, 5634, 5632, 5629, 5627, 5625, 5623, 5621, 5619, 5616,
-    5614, 5612, 5610, 5608, 5606, 5603, 5601, 5599, 5597, 5595, 5593,
-    5591, 5588, 5586, 5584, 5582, 5580, 5578, 5575, 5573, 5571, 5569,
-    5567, 5565, 5563, 5560, 5558, 5556, 5554, 5552, 5550, 5547, 5545,
-    5543, 5541, 5539, 5537, 5535, 5532, 5530, 5528, 5526, 5524, 5522,
-    5519, 5517, 5515, 5513, 5511, 5509, 5507, 5504, 5502, 5500, 5498,
-    5496, 5494, 5491, 5489, 5487, 5485, 5483, 5481, 5479, 5476, 5474,
-    5472, 5470, 5468, 5466, 5463, 5461, 5459, 5457, 5455, 5453, 5451,
-    5448, 5446, 5444, 5442, 5440, 5438, 5435, 5433, 5431, 5429, 5427,
-    5425, 5423, 5420, 5418, 5416, 5414, 5412, 5410, 5408, 5405, 5403,
-    5401, 5399, 5397, 5395, 5392, 5390, 5388, 5386, 5384, 5382, 5380,
-    5377, 5375, 5373, 5371, 5369, 5367, 5364, 5362, 5360, 5358, 5356,
-    5354, 5352, 5349, 5347, 5345, 5343, 5341, 5339, 5337, 5334, 5332,
-    5330, 5328, 5326, 5324, 5321, 5319, 5317, 5315, 5313, 5311, 5309,
-    5306, 5304, 5302, 5300, 5298, 5296, 5294, 5291, 5289, 5287, 5285,
-    5283, 5281, 5278, 5276, 5274, 5272, 5270, 5268, 5266, 5263, 5261,
-    5259, 5257, 5255, 5253, 5251, 5248, 5246, 5244, 5242, 5240, 5238,
-    5235, 5233, 5231, 5229, 5227, 5225, 5223, 5220, 5218, 5216, 5214,
-    5212, 5210, 5208, 5205, 5203, 5201, 5199, 5197, 5195, 5192, 5190,
-    5188, 5186, 5184, 5182, 5180, 5177, 5175, 5173, 5171, 5169, 5167,
-    5165, 5162, 5160, 5158, 5156, 5154, 5152, 5149, 5147, 5145, 5143,
-    5141, 5139, 5137, 5134, 5132, 5130, 5128, 5126, 5124, 5122, 5119,
-    5117, 5115, 5113, 5111, 5109, 5107, 5104, 5102, 5100, 5098, 5096,
-    5094, 5091, 5089, 5087, 5085, 5083, 5081, 5079, 5076, 5074, 5072,
-    5070, 5068, 5066, 5064, 5061, 5059, 5057, 5055, 5053, 5051, 5048,
-    5046, 5044, 5042, 5040, 5038, 5036, 5033, 5031, 5029, 5027, 5025,
-    5023, 5021, 5018, 5016, 5014, 5012, 5010, 5008, 5005, 5003, 5001,
-    4999, 4997, 4995, 4993, 4990, 4988, 4986, 4984, 4982, 4980, 4978,
-    4975, 4973, 4971, 4969, 4967, 4965, 4962, 4960, 4958, 4956, 4954,
-    4952, 4950, 4947, 4945, 4943, 4941, 4939, 4937, 4935, 4932, 4930,
-    4928, 4926, 4924, 4922, 4919, 4917, 4915, 4913, 4911, 4909, 4907,
-    4904, 4902, 4900, 4898, 4896, 4894, 4892, 4889, 4887, 4885, 4883,
-    4881, 4879, 4876, 4874, 4872, 4870, 4868, 4866, 4864, 4861, 4859,
-    4857, 4855, 4853, 4851, 4849, 4846, 4844, 4842, 4840, 4838, 4836,
-    4833, 4831, 4829, 4827, 4825, 4823, 4821, 4818, 4816, 4814, 4812,
-    4810, 4808, 4806, 4803, 4801, 4799, 4797, 4795, 4793, 4790, 4788,
-    4786, 4784, 4782, 4780, 4778, 4775, 4773, 4771, 4769, 4767, 4765,
-    4763, 4760, 4758, 4756, 4754, 4752, 4750, 4747, 4745, 4743, 4741,
-    4739, 4737, 4735, 4732, 4730, 4728, 4726, 4724, 4722, 4719, 4717,
-    4715, 4713, 4711, 4709, 4707, 4704, 4702, 4700, 4698, 4696, 4694,
-    4692, 4689, 4687, 4685, 4683, 4681, 4679, 4676, 4674, 4672, 4670,
-    4668, 4666, 4664, 4661, 4659, 4657, 4655, 4653, 4651, 4648, 4646,
-    4644, 4642, 4640, 4638, 4636, 4633, 4631, 4629, 4627, 4625, 4623,
-    4621, 4618, 4616, 4614, 4612, 4610, 4608, 4605, 4603, 4601, 4599,
-    4597, 4595, 4593, 4590, 4588, 4586, 4584, 4582, 4580, 4577, 4575,
-    4573, 4571, 4569, 4567, 4565, 4562, 4560, 4558, 4556, 4554, 4552,
-    4550, 4547, 4545, 4543, 4541, 4539, 4537, 4534, 4532, 4530, 4528,
-    4526, 4524, 4522, 4519, 4517, 4515, 4513, 4511, 4509, 4506, 4504,
-    4502, 4500, 4498, 4496, 4494, 4491, 4489, 4487, 4485, 4483, 4481,
-    4478, 4476, 4474, 4472, 4470, 4468, 4466, 4463, 4461, 4459, 4457,
-    4455, 4453, 4451, 4448, 4446, 4444, 4442, 4440, 4438, 4435, 4433,
-    4431, 4429, 4427, 4425, 4423, 4420, 4418, 4416, 4414, 4412, 4410,
-    4407, 4405, 4403, 4401, 4399, 4397, 4395, 4392, 4390, 4388, 4386,
-    4384, 4382, 4379, 4377, 4375, 4373, 4371, 4369, 4367, 4364, 4362,
-    4360, 4358, 4356, 4354, 4351, 4349, 4347, 4345, 4343, 4341, 4339,
-    4336, 4334, 4332, 4330, 4328, 4326, 4323, 4321, 4319, 4317, 4315,
-    4313, 4311, 4308, 4306, 4304, 4302, 4300, 4298, 4295, 4293, 4291,
-    4289, 4287, 4285, 4283, 4280, 4278, 4276, 4274, 4272, 4270, 4268,
-    4265, 4263, 4261, 4259, 4257, 4255, 4252, 4250, 4248, 4246, 4244,
-    4242, 4240, 4237, 4235, 4233, 4231, 4229, 4227, 4224, 4222, 4220,
-    4218, 4216, 4214, 4212, 4209, 4207, 4205, 4203, 4201, 4199, 4196,
-    4194, 4192, 4190, 4188, 4186, 4184, 4181, 4179, 4177, 4175, 4173,
-    4171, 4168, 4166, 4164, 4162, 4160, 4158, 4156, 4153, 4151, 4149,
-    4147, 4145, 4143, 4140, 4138, 4136, 4134, 4132, 4130, 4128, 4125,
-    4123, 4121, 4119, 4117, 4115, 4112, 4110, 4108, 4106, 4104, 4102,
-    4100, 4097, 4095, 4093, 4091, 4089, 4087, 4084, 4082, 4080, 4078,
-    4076, 4074, 4072, 4069, 4067, 4065, 4063, 4061, 4059, 4056, 4054,
-    4052, 4050, 4048, 4046, 4044, 4041, 4039, 4037, 4035, 4033, 4031,
-    4028, 4026, 4024, 4022, 4020, 4018, 4016, 4013, 4011, 4009, 4007,
-    4005, 4003, 4000, 3998, 3996, 3994, 3992, 3990, 3988, 3985, 3983,
-    3981, 3979, 3977, 3975, 3972, 3970, 3968, 3966, 3964, 3962, 3960,
-    3957, 3955, 3953, 3951, 3949, 3947, 3944, 3942, 3940, 3938, 3936,
-    3934, 3932, 3929, 3927, 3925, 3923, 3921, 3919, 3916, 3914, 3912,
-    3910, 3908, 3906, 3904, 3901, 3899, 3897, 3895, 3893, 3891, 3889,
-    3886, 3884, 3882, 3880, 3878, 3876, 3873, 3871, 3869, 3867, 3865,
-    3863, 3861, 3858, 3856, 3854, 3852, 3850, 3848, 3845, 3843, 3841,
-    3839, 3837, 3835, 3833, 3830, 3828, 3826, 3824, 3822, 3820, 3817,
-    3815, 3813, 3811, 3809, 3807, 3805, 3802, 3800, 3798, 3796, 3794,
-    3792, 3789, 3787, 3785, 3783, 3781, 3779, 3777, 3774, 3772, 3770,
-    3768, 3766, 3764, 3761, 3759, 3757, 3755, 3753, 3751, 3749, 3746,
-    3744, 3742, 3740, 3738, 3736, 3733, 3731, 3729, 3727, 3725, 3723,
-    3721, 3718, 3716, 3714, 3712, 3710, 3708, 3706, 3703, 3701, 3699,
-    3697, 3695, 3693, 3690, 3688, 3686, 3684, 3682, 3680, 3678, 3675,
-    3673, 3671, 3669, 3667, 3665, 3662, 3660, 3658, 3656, 3654, 3652,
-    3650, 3647, 3645, 3643, 3641, 3639, 3637, 3634, 3632, 3630, 3628,
-    3626, 3624, 3622, 3619, 3617, 3615, 3613, 3611, 3609, 3607, 3604,
-    3602, 3600, 3598, 3596, 3594, 3591, 3589, 3587, 3585, 3583, 3581,
-    3579, 3576, 3574, 3572, 3570, 3568, 3566, 3563, 3561, 3559, 3557,
-    3555, 3553, 3551, 3548, 3546, 3544, 3542, 3540, 3538, 3536, 3533,
-    3531, 3529, 3527, 3525, 3523, 3520, 3518, 3516, 3514, 3512, 3510,
-    3508, 3505, 3503, 3501, 3499, 3497, 3495, 3492, 3490, 3488, 3486,
-    3484, 3482, 3480, 3477, 3475, 3473, 3471, 3469, 3467, 3465, 3462,
-    3460, 3458, 3456, 3454, 3452, 3449, 3447, 3445, 3443, 3441, 3439,
-    3437, 3434, 3432, 3430, 3428, 3426, 3424, 3421, 3419, 3417, 3415,
-    3413, 3411, 3409, 3406, 3404, 3402, 3400, 3398, 3396, 3394, 3391,
-    3389, 3387, 3385, 3383, 3381, 3378, 3376, 3374, 3372, 3370, 3368,
-    3366, 3363, 3361, 3359, 3357, 3355, 3353, 3351, 3348, 3346, 3344,
-    3342, 3340, 3338, 3335, 3333, 3331, 3329, 3327, 3325, 3323, 3320,
-    3318, 3316, 3314, 3312, 3310, 3308, 3305, 3303, 3301, 3299, 3297,
-    3295, 3292, 3290, 3288, 3286, 3284, 3282, 3280, 3277, 3275, 3273,
-    3271, 3269, 3267, 3265, 3262, 3260, 3258, 3256, 3254, 3252, 3249,
-    3247, 3245, 3243, 3241, 3239, 3237, 3234, 3232, 3230, 3228, 3226,
-    3224, 3222, 3219, 3217, 3215, 3213, 3211, 3209, 3206, 3204, 3202,
-    3200, 3198, 3196, 3194, 3191, 3189, 3187, 3185, 3183, 3181, 3179,
-    3176, 3174, 3172, 3170, 3168, 3166, 3163, 3161, 3159, 3157, 3155,
-    3153, 3151, 3148, 3146, 3144, 3142, 3140, 3138, 3136, 3133, 3131,
-    3129, 3127, 3125, 3123, 3120, 3118, 3116, 3114, 3112, 3110, 3108,
-    3105, 3103, 3101, 3099, 3097, 3095, 3093, 3090, 3088, 3086, 3084,
-    3082, 3080, 3078, 3075, 3073, 3071, 3069, 3067, 3065, 3062, 3060,
-    3058, 3056, 3054, 3052, 3050, 3047, 3045, 3043, 3041, 3039, 3037,
-    3035, 3032, 3030, 3028, 3026, 3024, 3022, 3019, 3017, 3015, 3013,
-    3011, 3009, 3007, 3004, 3002, 3000, 2998, 2996, 2994, 2992, 2989,
-    2987, 2985, 2983, 2981, 2979, 2976, 2974, 2972, 2970, 2968, 2966,
-    2964, 2961, 2959, 2957, 2955, 2953, 2951, 2949, 2946, 2944, 2942,
-    2940, 2938, 2936, 2933, 2931, 2929, 2927, 2925, 2923, 2921, 2918,
-    2916, 2914, 2912, 2910, 2908, 2906, 2903, 2901, 2899, 2897, 2895,
-    2893, 2890, 2888, 2886, 2884, 2882, 2880, 2878, 2875, 2873, 2871,
-    2869, 2867, 2865, 2863, 2860, 2858, 2856, 2854, 2852, 2850, 2847,
-    2845, 2843, 2841, 2839, 2837, 2835, 2832, 2830, 2828, 2826, 2824,
-    2822, 2820, 2817, 2815, 2813, 2811, 2809, 2807, 2804, 2802, 2800,
-    2798, 2796, 2794, 2792, 2789, 2787, 2785, 2783, 2781, 2779, 2777,
-    2774, 2772, 2770, 2768, 2766, 2764, 2761, 2759, 2757, 2755, 2753,
-    2751, 2749, 2746, 2744, 2742, 2740, 2738, 2736, 2733, 2731, 2729,
-    2727, 2725, 2723, 2721, 2718, 2716, 2714, 2712, 2710, 2708, 2705,
-    2703, 2701, 2699, 2697, 2695, 2693, 2690, 2688, 2686, 2684, 2682,
-    2680, 2677, 2675, 2673, 2671, 2669, 2667, 2665, 2662, 2660, 2658,
-    2656, 2654, 2652, 2649, 2647, 2645, 2643, 2641, 2639, 2637, 2634,
-    2632, 2630, 2628, 2626, 2624, 2621, 2619, 2617, 2615, 2613, 2611,
-    2609, 2606, 2604, 2602, 2600, 2598, 2596, 2593, 2591, 2589, 2587,
-    2585, 2583, 2581, 2578, 2576, 2574, 2572, 2570, 2568, 2565, 2563,
-    2561, 2559, 2557, 2555, 2552, 2550, 2548, 2546, 2544, 2542, 2540,
-    2537, 2535, 2533, 2531, 2529, 2527, 2524, 2522, 2520, 2518, 2516,
-    2514, 2511, 2509, 2507, 2505, 2503, 2501, 2499, 2496, 2494, 2492,
-    2490, 2488, 2486, 2483, 2481, 2479, 2477, 2475, 2473, 2470, 2468,
-    2466, 2464, 2462, 2460, 2457, 2455, 2453, 2451, 2449, 2447, 2445,
-    2442, 2440, 2438, 2436, 2434, 2432, 2429, 2427, 2425, 2423, 2421,
-    2419, 2416, 2414, 2412, 2410, 2408, 2406, 2403, 2401, 2399, 2397,
-    2395, 2393, 2390, 2388, 2386, 2384, 2382, 2380, 2377, 2375, 2373,
-    2371, 2369, 2367, 2364, 2362, 2360, 2358, 2356, 2354, 2351, 2349,
-    2347, 2345, 2343, 2341, 2338, 2336, 2334, 2332, 2330, 2328, 2325,
-    2323, 2321, 2319, 2317, 2315, 2312, 2310, 2308, 2306, 2304, 2302,
-    2299, 2297, 2295, 2293, 2291, 2289, 2286, 2284, 2282, 2280, 2278,
-    2275, 2273, 2271, 2269, 2267, 2265, 2262, 2260, 2258, 2256, 2254,
-    2252, 2249, 2247, 2245, 2243, 2241, 2239, 2236, 2234, 2232, 2230,
-    2228, 2225, 2223, 2221, 2219, 2217, 2215, 2212, 2210, 2208, 2206,
-    2204, 2201, 2199, 2197, 2195, 2193, 2191, 2188, 2186, 2184, 2182,
-    2180, 2178, 2175, 2173, 2171, 2169, 2167, 2164, 2162, 2160, 2158,
-    2156, 2154, 2151, 2149, 2147, 2145, 2143, 2140, 2138, 2136, 2134,
-    2132, 2129, 2127, 2125, 2123, 2121, 2119, 2116, 2114, 2112, 2110,
-    2108, 2105, 2103, 2101, 2099, 2097, 2094, 2092, 2090, 2088, 2086,
-    2084, 2081, 2079, 2077, 2075, 2073, 2070, 2068, 2066, 2064, 2062,
-    2059, 2057, 2055, 2053, 2051, 2048, 2046, 2044, 2042, 2040, 2037,
-    2035, 2033, 2031, 2029, 2027, 2024, 2022, 2020, 2018, 2016, 2013,
-    2011, 2009, 2007, 2005, 2002, 2000, 1998, 1996, 1994, 1991, 1989,
-    1987, 1985, 1983, 1980, 1978, 1976, 1974, 1972, 1969, 1967, 1965,
-    1963, 1960, 1958, 1956, 1954, 1952, 1949, 1947, 1945, 1943, 1941,
-    1938, 1936, 1934, 1932, 1930, 1927, 1925, 1923, 1921, 1919, 1916,
-    1914, 1912, 1910, 1908, 1905, 1903, 1901, 1899, 1896, 1894, 1892,
-    1890, 1888, 1885, 1883, 1881, 1879, 1877, 1874, 1872, 1870, 1868,
-    1865, 1863, 1861, 1859, 1857, 1854, 1852, 1850, 1848, 1845, 1843,
-    1841, 1839, 1837, 1834, 1832, 1830, 1828, 1825, 1823, 1821, 1819,
-    1817, 1814, 1812, 1810, 1808, 1805, 1803, 1801, 1799, 1797, 1794,
-    1792, 1790, 1788, 1785, 1783, 1781, 1779, 1777, 1774, 1772, 1770,
-    1768, 1765, 1763, 1761, 1759, 1756, 1754, 1752, 1750, 1747, 1745,
-    1743, 1741, 1739, 1736, 1734, 1732, 1730, 1727, 1725, 1723, 1721,
-    1718, 1716, 1714, 1712, 1709, 1707, 1705, 1703, 1701, 1698, 1696,
-    1694, 1692, 1689, 1687, 1685, 1683, 1680, 1678, 1676, 1674, 1671,
-    1669, 1667, 1665, 1662, 1660, 1658, 1656, 1653, 1651, 1649, 1647,
-    1644, 1642, 1640, 1638, 1635, 1633, 1631, 1629, 1626, 1624, 1622,
-    1620, 1617, 1615, 1613, 1611, 1608, 1606, 1604, 1602, 1599, 1597,
-    1595, 1593, 1590, 1588, 1586, 1583, 1581, 1579, 1577, 1574, 1572,
-    1570, 1568, 1565, 1563, 1561, 1559, 1556, 1554, 1552, 1550, 1547,
-    1545, 1543, 1541, 1538, 1536, 1534, 1531, 1529, 1527, 1525, 1522,
-    1520, 1518, 1516, 1513, 1511, 1509, 1506, 1504, 1502, 1500, 1497,
-    1495, 1493, 1491, 1488, 1486, 1484, 1481, 1479, 1477, 1475, 1472,
-    1470, 1468, 1466, 1463, 1461, 1459, 1456, 1454, 1452, 1450, 1447,
-    1445, 1443, 1440, 1438, 1436, 1434, 1431, 1429, 1427, 1425, 1422,
-    1420, 1418, 1415, 1413, 1411, 1409, 1406, 1404, 1402, 1399, 1397,
-    1395, 1393, 1390, 1388, 1386, 1383, 1381, 1379, 1376, 1374, 1372,
-    1370, 1367, 1365, 1363, 1360, 1358, 1356, 1354, 1351, 1349, 1347,
-    1344, 1342, 1340, 1338, 1335, 1333, 1331, 1328, 1326, 1324, 1321,
-    1319, 1317, 1315, 1312, 1310, 1308, 1305, 1303, 1301, 1298, 1296,
-    1294, 1292, 1289, 1287, 1285, 1282, 1280, 1278, 1275, 1273, 1271,
-    1269, 1266, 1264, 1262, 1259, 1257, 1255, 1252, 1250, 1248, 1246,
-    1243, 1241, 1239, 1236, 1234, 1232, 1229, 1227, 1225, 1223, 1220,
-    1218, 1216, 1213, 1211, 1209, 1206, 1204, 1202, 1199, 1197, 1195,
-    1193, 1190, 1188, 1186, 1183, 1181, 1179, 1176, 1174, 1172, 1169,
-    1167, 1165, 1163, 1160, 1158, 1156, 1153, 1151, 1149, 1146, 1144,
-    1142, 1139, 1137, 1135, 1132, 1130, 1128, 1126, 1123, 1121, 1119,
-    1116, 1114, 1112, 1109, 1107, 1105, 1102, 1100, 1098, 1096, 1093,
-    1091, 1089, 1086, 1084, 1082, 1079, 1077, 1075, 1072, 1070, 1068,
-    1065, 1063, 1061, 1059, 1056, 1054, 1052, 1049, 1047, 1045, 1042,
-    1040, 1038, 1035, 1033, 1031, 1029, 1026, 1024, 1022, 1019, 1017,
-    1015, 1012, 1010, 1008, 1005, 1003, 1001, 999, 996, 994, 992, 989,
-    987, 985, 982, 980, 978, 975, 973, 971, 969, 966, 964, 962, 959, 957,
-    955, 952, 950, 948, 946, 943, 941, 939, 936, 934, 932, 929, 927, 925,
-    923, 920, 918, 916, 913, 911, 909, 906, 904, 902, 900, 897, 895, 893,
-    890, 888, 886, 884, 881, 879, 877, 874, 872, 870, 868, 865, 863, 861,
-    858, 856, 854, 852, 849, 847, 845, 842, 840, 838, 836, 833, 831, 829,
-    826, 824, 822, 820, 817, 815, 813, 811, 808, 806, 804, 801, 799, 797,
-    795, 792, 790, 788, 786, 783, 781, 779, 777, 774, 772, 770, 768, 765,
-    763, 761, 758, 756, 754, 752, 749, 747, 745, 743, 741, 738, 736, 734,
-    732, 729, 727, 725, 723, 720, 718, 716, 714, 711, 709, 707, 705, 702,
-    700, 698, 696, 694, 691, 689, 687, 685, 682, 680, 678, 676, 674, 671,
-    669, 667, 665, 663, 660, 658, 656, 654, 652, 649, 647, 645, 643, 641,
-    638, 636, 634, 632, 630, 627, 625, 623, 621, 619, 617, 614, 612, 610,
-    608, 606, 604, 601, 599, 597, 595, 593, 591, 588, 586, 584, 582, 580,
-    578, 576, 573, 571, 569, 567, 565, 563, 561, 558, 556, 554, 552, 550,
-    548, 546, 544, 541, 539, 537, 535, 533, 531, 529, 527, 525, 523, 520,
-    518, 516, 514, 512, 510, 508, 506, 504, 502, 500, 498, 495, 493, 491,
-    489, 487, 485, 483, 481, 479, 477, 475, 473, 471, 469, 467, 465, 463,
-    461, 459, 457, 455, 453, 450, 448, 446, 444, 442, 440, 438, 436, 434,
-    432, 430, 428, 426, 425, 423, 421, 419, 417, 415, 413, 411, 409, 407,
-    405, 403, 401, 399, 397, 395, 393, 391, 389, 387, 385, 384, 382, 380,
-    378, 376, 374, 372, 370, 368, 366, 364, 363, 361, 359, 357, 355, 353,
-    351, 349, 348, 346, 344, 342, 340, 338, 336, 335, 333, 331, 329, 327,
-    325, 324, 322, 320, 318, 316, 315, 313, 311, 309, 307, 306, 304, 302,
-    300, 299, 297, 295, 293, 291, 290, 288, 286, 285, 283, 281, 279, 278,
-    276, 274, 272, 271, 269, 267, 266, 264, 262, 261, 259, 257, 256, 254,
-    252, 251, 249, 247, 246, 244, 242, 241, 239, 237, 236, 234, 233, 231,
-    229, 228, 226, 225, 223, 221, 220, 218, 217, 215, 214, 212, 210, 209,
-    207, 206, 204, 203, 201, 200, 198, 197, 195, 194, 192, 191, 189, 188,
-    186, 185, 183, 182, 180, 179, 177, 176, 175, 173, 172, 170, 169, 167,
-    166, 165, 163, 162, 160, 159, 158, 156, 155, 154, 152, 151, 150, 148,
-    147, 146, 144, 143, 142, 140, 139, 138, 136, 135, 134, 133, 131, 130,
-    129, 127, 126, 125, 124, 122, 121, 120, 119, 118, 116, 115, 114, 113,
-    112, 110, 109, 108, 107, 106, 105, 103, 102, 101, 100, 99, 98, 97, 96,
-    94, 93, 92, 91, 90, 89, 88, 87, 86, 85, 84, 83, 82, 81, 80, 79, 78,
-    77, 76, 75, 74, 73, 72, 71, 70, 69, 68, 67, 66, 65, 64, 63, 62, 61,
-    61, 60, 59, 58, 57, 56, 55, 54, 54, 53, 52, 51, 50, 49, 49, 48, 47,
-    46, 45, 45, 44, 43, 42, 42, 41, 40, 39, 39, 38, 37, 37, 36, 35, 35,
-    34, 33, 32, 32, 31, 31, 30, 29, 29, 28, 27, 27, 26, 26, 25, 24, 24,
-    23, 23, 22, 22, 21, 21, 20, 19, 19, 18, 18, 17, 17, 17, 16, 16, 15,
-    15, 14, 14, 13, 13, 12, 12, 12, 11, 11, 10, 10, 10, 9, 9, 9, 8, 8, 8,
-    7, 7, 7, 6, 6, 6, 6, 5, 5, 5, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 2, 2, 2,
-    2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-]
-
-trap10 = [
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16,
-    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-    16, 16, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 14,
-    14, 14, 14, 14, 14, 14, 13, 13, 13, 13, 13, 13, 13, 12, 12, 12, 12,
-    12, 11, 11, 11, 11, 11, 10, 10, 10, 10, 9, 9, 9, 9, 8, 8, 8, 8, 7, 7,
-    7, 6, 6, 6, 6, 5, 5, 5, 4, 4, 4, 4, 3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1,
-    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3,
-    3, 4, 4, 5, 6, 6, 7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 20, 22, 24,
-    25, 27, 29, 31, 33, 36, 38, 40, 43, 45, 48, 51, 54, 57, 60, 63, 67,
-    70, 74, 77, 81, 85, 89, 93, 97, 101, 106, 110, 115, 119, 124, 129,
-    134, 139, 144, 150, 155, 160, 166, 172, 177, 183, 189, 195, 201, 208,
-    214, 220, 227, 233, 240, 247, 253, 260, 267, 274, 281, 288, 295, 302,
-    310, 317, 324, 332, 339, 347, 354, 362, 369, 377, 385, 393, 400, 408,
-    416, 424, 432, 440, 448, 456, 464, 472, 480, 488, 496, 504, 512, 520,
-    529, 537, 545, 553, 561, 570, 578, 586, 594, 602, 611, 619, 627, 635,
-    644, 652, 660, 668, 677, 685, 693, 701, 710, 718, 726, 734, 743, 751,
-    759, 767, 776, 784, 792, 800, 808, 817, 825, 833, 841, 849, 858, 866,
-    874, 882, 890, 898, 907, 915, 923, 931, 939, 947, 955, 963, 972, 980,
-    988, 996, 1004, 1012, 1020, 1028, 1036, 1044, 1052, 1060, 1068, 1077,
-    1085, 1093, 1101, 1109, 1117, 1125, 1133, 1141, 1149, 1157, 1165,
-    1173, 1181, 1189, 1197, 1205, 1213, 1221, 1229, 1237, 1245, 1253,
-    1261, 1269, 1277, 1285, 1293, 1301, 1309, 1317, 1325, 1333, 1341,
-    1349, 1357, 1364, 1372, 1380, 1388, 1396, 1404, 1412, 1420, 1428,
-    1436, 1444, 1452, 1460, 1468, 1476, 1484, 1492, 1500, 1508, 1516,
-    1524, 1532, 1540, 1548, 1556, 1564, 1571, 1579, 1587, 1595, 1603,
-    1611, 1619, 1627, 1635, 1643, 1651, 1659, 1667, 1675, 1683, 1691,
-    1699, 1707, 1715, 1723, 1731, 1739, 1747, 1755, 1762, 1770, 1778,
-    1786, 1794, 1802, 1810, 1818, 1826, 1834, 1842, 1850, 1858, 1866,
-    1874, 1882, 1890, 1898, 1906, 1914, 1922, 1930, 1938, 1946, 1954,
-    1962, 1970, 1978, 1985, 1993, 2001, 2009, 2017, 2025, 2033, 2041,
-    2049, 2057, 2065, 2073, 2081, 2089, 2097, 2105, 2113, 2121, 2129,
-    2137, 2145, 2153, 2161, 2169, 2177, 2185, 2193, 2201, 2209, 2217,
-    2225, 2233, 2240, 2248, 2256, 2264, 2272, 2280, 2288, 2296, 2304,
-    2312, 2320, 2328, 2336, 2344, 2352, 2360, 2368, 2376, 2384, 2392,
-    2400, 2408, 2416, 2424, 2432, 2440, 2448, 2456, 2464, 2472, 2480,
-    2488, 2496, 2504, 2511, 2519, 2527, 2535, 2543, 2551, 2559, 2567,
-    2575, 2583, 2591, 2599, 2607, 2615, 2623, 2631, 2639, 2647, 2655,
-    2663, 2671, 2679, 2687, 2695, 2703, 2711, 2719, 2727, 2735, 2743,
-    2751, 2759, 2767, 2774, 2782, 2790, 2798, 2806, 2814, 2822, 2830,
-    2838, 2846, 2854, 2862, 2870, 2878, 2886, 2894, 2902, 2910, 2918,
-    2926, 2934, 2942, 2950, 2958, 2966, 2974, 2982, 2990, 2998, 3006,
-    3014, 3022, 3030, 3038, 3045, 3053, 3061, 3069, 3077, 3085, 3093,
-    3101, 3109, 3117, 3125, 3133, 3141, 3149, 3157, 3165, 3173, 3181,
-    3189, 3197, 3205, 3213, 3221, 3229, 3237, 3245, 3253, 3261, 3269,
-    3277, 3285, 3293, 3301, 3308, 3316, 3324, 3332, 3340, 3348, 3356,
-    3364, 3372, 3380, 3388, 3396, 3404, 3412, 3420, 3428, 3436, 3444,
-    3452, 3460, 3468, 3476, 3484, 3492, 3500, 3508, 3516, 3524, 3532,
-    3540, 3548, 3556, 3564, 3571, 3579, 3587, 3595, 3603, 3611, 3619,
-    3627, 3635, 3643, 3651, 3659, 3667, 3675, 3683, 3691, 3699, 3707,
-    3715, 3723, 3731, 3739, 3747, 3755, 3763, 3771, 3779, 3787, 3795,
-    3803, 3811, 3819, 3827, 3834, 3842, 3850, 3858, 3866, 3874, 3882,
-    3890, 3898, 3906, 3914, 3922, 3930, 3938, 3946, 3954, 3962, 3970,
-    3978, 3986, 3994, 4002, 4010, 4018, 4026, 4034, 4042, 4050, 4058,
-    4066, 4074, 4082, 4090, 4097, 4105, 4113, 4121, 4129, 4137, 4145,
-    4153, 4161, 4169, 4177, 4185, 4193, 4201, 4209, 4217, 4225, 4233,
-    4241, 4249, 4257, 4265, 4273, 4281, 4289, 4297, 4305, 4313, 4321,
-    4329, 4337, 4345, 4353, 4360, 4368, 4376, 4384, 4392, 4400, 4408,
-    4416, 4424, 4432, 4440, 4448, 4456, 4464, 4472, 4480, 4488, 4496,
-    4504, 4512, 4520, 4528, 4536, 4544, 4552, 4560, 4568, 4576, 4584,
-    4592, 4600, 4608, 4616, 4624, 4631, 4639, 4647, 4655, 4663, 4671,
-    4679, 4687, 4695, 4703, 4711, 4719, 4727, 4735, 4743, 4751, 4759,
-    4767, 4775, 4783, 4791, 4799, 4807, 4815, 4823, 4831, 4839, 4847,
-    4855, 4863, 4871, 4879, 4887, 4894, 4902, 4910, 4918, 4926, 4934,
-    4942, 4950, 4958, 4966, 4974, 4982, 4990, 4998, 5006, 5014, 5022,
-    5030, 5038, 5046, 5054, 5062, 5070, 5078, 5086, 5094, 5102, 5110,
-    5118, 5126, 5134, 5142, 5150, 5157, 5165, 5173, 5181, 5189, 5197,
-    5205, 5213, 5221, 5229, 5237, 5245, 5253, 5261, 5269, 5277, 5285,
-    5293, 5301, 5309, 5317, 5325, 5333, 5341, 5349, 5357, 5365, 5373,
-    5381, 5389, 5397, 5405, 5413, 5420, 5428, 5436, 5444, 5452, 5460,
-    5468, 5476, 5484, 5492, 5500, 5508, 5516, 5524, 5532, 5540, 5548,
-    5556, 5564, 5572, 5580, 5588, 5596, 5604, 5612, 5620, 5628, 5636,
-    5644, 5652, 5660, 5668, 5676, 5684, 5691, 5699, 5707, 5715, 5723,
-    5731, 5739, 5747, 5755, 5763, 5771, 5779, 5787, 5795, 5803, 5811,
-    5819, 5827, 5835, 5843, 5851, 5859, 5867, 5875, 5883, 5891, 5899,
-    5907, 5915, 5923, 5931, 5939, 5947, 5955, 5962, 5970, 5978, 5986,
-    5994, 6002, 6010, 6018, 6026, 6034, 6042, 6050, 6058, 6066, 6074,
-    6082, 6090, 6098, 6106, 6114, 6122, 6130, 6138, 6146, 6154, 6162,
-    6170, 6178, 6186, 6194, 6202, 6209, 6217, 6225, 6233, 6241, 6249,
-    6257, 6265, 6273, 6281, 6289, 6297, 6305, 6313, 6321, 6329, 6337,
-    6345, 6353, 6361, 6369, 6377, 6385, 6393, 6401, 6409, 6417, 6425,
-    6432, 6440, 6448, 6456, 6464, 6472, 6480, 6488, 6496, 6504, 6512,
-    6520, 6528, 6536, 6544, 6552, 6560, 6568, 6576, 6584, 6592, 6600,
-    6608, 6616, 6624, 6631, 6639, 6647, 6655, 6663, 6671, 6679, 6687,
-    6695, 6703, 6711, 6719, 6727, 6735, 6743, 6751, 6759, 6767, 6775,
-    6783, 6791, 6799, 6807, 6815, 6823, 6830, 6838, 6846, 6854, 6862,
-    6870, 6878, 6886, 6894, 6902, 6910, 6918, 6926, 6934, 6942, 6950,
-    6958, 6966, 6974, 6982, 6990, 6998, 7006, 7014, 7022, 7030, 7038,
-    7046, 7054, 7062, 7070, 7078, 7086, 7094, 7102, 7110, 7118, 7127,
-    7135, 7143, 7151, 7159, 7167, 7175, 7183, 7191, 7199, 7207, 7215,
-    7224, 7232, 7240, 7248, 7256, 7264, 7272, 7280, 7289, 7297, 7305,
-    7313, 7321, 7329, 7338, 7346, 7354, 7362, 7370, 7378, 7387, 7395,
-    7403, 7411, 7420, 7428, 7436, 7444, 7452, 7461, 7469, 7477, 7485,
-    7494, 7502, 7510, 7518, 7527, 7535, 7543, 7551, 7560, 7568, 7576,
-    7584, 7593, 7601, 7609, 7617, 7626, 7634, 7642, 7650, 7658, 7666,
-    7675, 7683, 7691, 7699, 7707, 7715, 7723, 7731, 7739, 7747, 7755,
-    7763, 7771, 7779, 7787, 7794, 7802, 7810, 7818, 7825, 7833, 7841,
-    7848, 7856, 7863, 7870, 7878, 7885, 7892, 7899, 7906, 7914, 7921,
-    7927, 7934, 7941, 7948, 7954, 7961, 7967, 7974, 7980, 7986, 7993,
-    7999, 8005, 8011, 8016, 8022, 8028, 8033, 8039, 8044, 8049, 8054,
-    8060, 8064, 8069, 8074, 8079, 8083, 8088, 8092, 8096, 8100, 8104,
-    8108, 8112, 8116, 8119, 8123, 8126, 8129, 8133, 8136, 8139, 8141,
-    8144, 8147, 8149, 8152, 8154, 8157, 8159, 8161, 8163, 8165, 8167,
-    8168, 8170, 8172, 8173, 8175, 8176, 8177, 8178, 8180, 8181, 8182,
-    8183, 8183, 8184, 8185, 8186, 8186, 8187, 8188, 8188, 8189, 8189,
-    8189, 8190, 8190, 8190, 8190, 8191, 8191, 8191, 8191, 8191, 8191,
-    8191, 8191, 8191, 8191, 8191, 8191, 8191, 8190, 8190, 8190, 8190,
-    8190, 8189, 8189, 8189, 8189, 8189, 8188, 8188, 8188, 8188, 8187,
-    8187, 8187, 8186, 8186, 8186, 8186, 8185, 8185, 8185, 8184, 8184,
-    8184, 8184, 8183, 8183, 8183, 8183, 8182, 8182, 8182, 8182, 8181,
-    8181, 8181, 8181, 8180, 8180, 8180, 8180, 8180, 8179, 8179, 8179,
-    8179, 8179, 8178, 8178, 8178, 8178, 8178, 8178, 8177, 8177, 8177,
-    8177, 8177, 8177, 8177, 8177, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8175, 8175, 8175, 8175,
-    8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175,
-    8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175,
-    8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175,
-    8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175,
-    8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175,
-    8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175,
-    8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175,
-    8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175,
-    8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175,
-    8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175,
-    8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175,
-    8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175,
-    8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175,
-    8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175,
-    8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175, 8175,
-    8175, 8175, 8175, 8175, 8175, 8176, 8176, 8176, 8176, 8176, 8176,
-    8176, 8176, 8176, 8176, 8176, 8176, 8176, 8177, 8177, 8177, 8177,
-    8177, 8177, 8177, 8177, 8178, 8178, 8178, 8178, 8178, 8178, 8178,
-    8179, 8179, 8179, 8179, 8179, 8180, 8180, 8180, 8180, 8180, 8181,
-    8181, 8181, 8181, 8182, 8182, 8182, 8182, 8183, 8183, 8183, 8183,
-    8184, 8184, 8184, 8185, 8185, 8185, 8185, 8186, 8186, 8186, 8187,
-    8187, 8187, 8187, 8188, 8188, 8188, 8188, 8189, 8189, 8189, 8189,
-    8190, 8190, 8190, 8190, 8190, 8190, 8191, 8191, 8191, 8191, 8191,
-    8191, 8191, 8191, 8191, 8191, 8191, 8191, 8190, 8190, 8190, 8190,
-    8189, 8189, 8189, 8188, 8188, 8187, 8187, 8186, 8185, 8185, 8184,
-    8183, 8182, 8181, 8180, 8179, 8178, 8177, 8175, 8174, 8172, 8171,
-    8169, 8167, 8166, 8164, 8162, 8160, 8158, 8155, 8153, 8151, 8148,
-    8146, 8143, 8140, 8137, 8134, 8131, 8128, 8124, 8121, 8117, 8114,
-    8110, 8106, 8102, 8098, 8094, 8090, 8085, 8081, 8076, 8072, 8067,
-    8062, 8057, 8052, 8047, 8041, 8036, 8031, 8025, 8019, 8014, 8008,
-    8002, 7996, 7990, 7983, 7977, 7971, 7964, 7958, 7951, 7944, 7938,
-    7931, 7924, 7917, 7910, 7903, 7896, 7889, 7881, 7874, 7867, 7859,
-    7852, 7844, 7837, 7829, 7822, 7814, 7806, 7798, 7791, 7783, 7775,
-    7767, 7759, 7751, 7743, 7735, 7727, 7719, 7711, 7703, 7695, 7687,
-    7679, 7671, 7662, 7654, 7646, 7638, 7630, 7621, 7613, 7605, 7597,
-    7589, 7580, 7572, 7564, 7556, 7547, 7539, 7531, 7523, 7514, 7506,
-    7498, 7490, 7481, 7473, 7465, 7457, 7448, 7440, 7432, 7424, 7415,
-    7407, 7399, 7391, 7383, 7374, 7366, 7358, 7350, 7342, 7333, 7325,
-    7317, 7309, 7301, 7293, 7284, 7276, 7268, 7260, 7252, 7244, 7236,
-    7228, 7219, 7211, 7203, 7195, 7187, 7179, 7171, 7163, 7155, 7147,
-    7139, 7131, 7123, 7114, 7106, 7098, 7090, 7082, 7074, 7066, 7058,
-    7050, 7042, 7034, 7026, 7018, 7010, 7002, 6994, 6986, 6978, 6970,
-    6962, 6954, 6946, 6938, 6930, 6922, 6914, 6906, 6898, 6890, 6882,
-    6874, 6866, 6858, 6850, 6842, 6834, 6827, 6819, 6811, 6803, 6795,
-    6787, 6779, 6771, 6763, 6755, 6747, 6739, 6731, 6723, 6715, 6707,
-    6699, 6691, 6683, 6675, 6667, 6659, 6651, 6643, 6635, 6627, 6620,
-    6612, 6604, 6596, 6588, 6580, 6572, 6564, 6556, 6548, 6540, 6532,
-    6524, 6516, 6508, 6500, 6492, 6484, 6476, 6468, 6460, 6452, 6444,
-    6436, 6429, 6421, 6413, 6405, 6397, 6389, 6381, 6373, 6365, 6357,
-    6349, 6341, 6333, 6325, 6317, 6309, 6301, 6293, 6285, 6277, 6269,
-    6261, 6253, 6245, 6237, 6229, 6221, 6213, 6206, 6198, 6190, 6182,
-    6174, 6166, 6158, 6150, 6142, 6134, 6126, 6118, 6110, 6102, 6094,
-    6086, 6078, 6070, 6062, 6054, 6046, 6038, 6030, 6022, 6014, 6006,
-    5998, 5990, 5982, 5974, 5966, 5958, 5951, 5943, 5935, 5927, 5919,
-    5911, 5903, 5895, 5887, 5879, 5871, 5863, 5855, 5847, 5839, 5831,
-    5823, 5815, 5807, 5799, 5791, 5783, 5775, 5767, 5759, 5751, 5743,
-    5735, 5727, 5719, 5711, 5703, 5695, 5687, 5680, 5672, 5664, 5656,
-    5648, 5640, 5632, 5624, 5616, 5608, 5600, 5592, 5584, 5576, 5568,
-    5560, 5552, 5544, 5536, 5528, 5520, 5512, 5504, 5496, 5488, 5480,
-    5472, 5464, 5456, 5448, 5440, 5432, 5424, 5417, 5409, 5401, 5393,
-    5385, 5377, 5369, 5361, 5353, 5345, 5337, 5329, 5321, 5313, 5305,
-    5297, 5289, 5281, 5273, 5265, 5257, 5249, 5241, 5233, 5225, 5217,
-    5209, 5201, 5193, 5185, 5177, 5169, 5161, 5153, 5146, 5138, 5130,
-    5122, 5114, 5106, 5098, 5090, 5082, 5074, 5066, 5058, 5050, 5042,
-    5034, 5026, 5018, 5010, 5002, 4994, 4986, 4978, 4970, 4962, 4954,
-    4946, 4938, 4930, 4922, 4914, 4906, 4898, 4890, 4883, 4875, 4867,
-    4859, 4851, 4843, 4835, 4827, 4819, 4811, 4803, 4795, 4787, 4779,
-    4771, 4763, 4755, 4747, 4739, 4731, 4723, 4715, 4707, 4699, 4691,
-    4683, 4675, 4667, 4659, 4651, 4643, 4635, 4627, 4620, 4612, 4604,
-    4596, 4588, 4580, 4572, 4564, 4556, 4548, 4540, 4532, 4524, 4516,
-    4508, 4500, 4492, 4484, 4476, 4468, 4460, 4452, 4444, 4436, 4428,
-    4420, 4412, 4404, 4396, 4388, 4380, 4372, 4364, 4357, 4349, 4341,
-    4333, 4325, 4317, 4309, 4301, 4293, 4285, 4277, 4269, 4261, 4253,
-    4245, 4237, 4229, 4221, 4213, 4205, 4197, 4189, 4181, 4173, 4165,
-    4157, 4149, 4141, 4133, 4125, 4117, 4109, 4101, 4094, 4086, 4078,
-    4070, 4062, 4054, 4046, 4038, 4030, 4022, 4014, 4006, 3998, 3990,
-    3982, 3974, 3966, 3958, 3950, 3942, 3934, 3926, 3918, 3910, 3902,
-    3894, 3886, 3878, 3870, 3862, 3854, 3846, 3838, 3831, 3823, 3815,
-    3807, 3799, 3791, 3783, 3775, 3767, 3759, 3751, 3743, 3735, 3727,
-    3719, 3711, 3703, 3695, 3687, 3679, 3671, 3663, 3655, 3647, 3639,
-    3631, 3623, 3615, 3607, 3599, 3591, 3583, 3575, 3567, 3560, 3552,
-    3544, 3536, 3528, 3520, 3512, 3504, 3496, 3488, 3480, 3472, 3464,
-    3456, 3448, 3440, 3432, 3424, 3416, 3408, 3400, 3392, 3384, 3376,
-    3368, 3360, 3352, 3344, 3336, 3328, 3320, 3312, 3304, 3297, 3289,
-    3281, 3273, 3265, 3257, 3249, 3241, 3233, 3225, 3217, 3209, 3201,
-    3193, 3185, 3177, 3169, 3161, 3153, 3145, 3137, 3129, 3121, 3113,
-    3105, 3097, 3089, 3081, 3073, 3065, 3057, 3049, 3041, 3034, 3026,
-    3018, 3010, 3002, 2994, 2986, 2978, 2970, 2962, 2954, 2946, 2938,
-    2930, 2922, 2914, 2906, 2898, 2890, 2882, 2874, 2866, 2858, 2850,
-    2842, 2834, 2826, 2818, 2810, 2802, 2794, 2786, 2778, 2771, 2763,
-    2755, 2747, 2739, 2731, 2723, 2715, 2707, 2699, 2691, 2683, 2675,
-    2667, 2659, 2651, 2643, 2635, 2627, 2619, 2611, 2603, 2595, 2587,
-    2579, 2571, 2563, 2555, 2547, 2539, 2531, 2523, 2515, 2507, 2500,
-    2492, 2484, 2476, 2468, 2460, 2452, 2444, 2436, 2428, 2420, 2412,
-    2404, 2396, 2388, 2380, 2372, 2364, 2356, 2348, 2340, 2332, 2324,
-    2316, 2308, 2300, 2292, 2284, 2276, 2268, 2260, 2252, 2244, 2236,
-    2229, 2221, 2213, 2205, 2197, 2189, 2181, 2173, 2165, 2157, 2149,
-    2141, 2133, 2125, 2117, 2109, 2101, 2093, 2085, 2077, 2069, 2061,
-    2053, 2045, 2037, 2029, 2021, 2013, 2005, 1997, 1989, 1982, 1974,
-    1966, 1958, 1950, 1942, 1934, 1926, 1918, 1910, 1902, 1894, 1886,
-    1878, 1870, 1862, 1854, 1846, 1838, 1830, 1822, 1814, 1806, 1798,
-    1790, 1782, 1774, 1766, 1759, 1751, 1743, 1735, 1727, 1719, 1711,
-    1703, 1695, 1687, 1679, 1671, 1663, 1655, 1647, 1639, 1631, 1623,
-    1615, 1607, 1599, 1591, 1583, 1575, 1567, 1560, 1552, 1544, 1536,
-    1528, 1520, 1512, 1504, 1496, 1488, 1480, 1472, 1464, 1456, 1448,
-    1440, 1432, 1424, 1416, 1408, 1400, 1392, 1384, 1376, 1368, 1361,
-    1353, 1345, 1337, 1329, 1321, 1313, 1305, 1297, 1289, 1281, 1273,
-    1265, 1257, 1249, 1241, 1233, 1225, 1217, 1209, 1201, 1193, 1185,
-    1177, 1169, 1161, 1153, 1145, 1137, 1129, 1121, 1113, 1105, 1097,
-    1089, 1081, 1073, 1064, 1056, 1048, 1040, 1032, 1024, 1016, 1008,
-    1000, 992, 984, 976, 967, 959, 951, 943, 935, 927, 919, 911, 902, 894,
-    886, 878, 870, 862, 853, 845, 837, 829, 821, 813, 804, 796, 788, 780,
-    771, 763, 755, 747, 739, 730, 722, 714, 706, 697, 689, 681, 673, 664,
-    656, 648, 640, 631, 623, 615, 607, 598, 590, 582, 574, 565, 557, 549,
-    541, 533, 525, 516, 508, 500, 492, 484, 476, 468, 460, 452, 444, 436,
-    428, 420, 412, 404, 397, 389, 381, 373, 366, 358, 350, 343, 335, 328,
-    321, 313, 306, 299, 292, 285, 277, 270, 264, 257, 250, 243, 237, 230,
-    224, 217, 211, 205, 198, 192, 186, 180, 175, 169, 163, 158, 152, 147,
-    142, 137, 131, 127, 122, 117, 112, 108, 103, 99, 95, 91, 87, 83, 79,
-    75, 72, 68, 65, 62, 58, 55, 52, 50, 47, 44, 42, 39, 37, 34, 32, 30,
-    28, 26, 24, 23, 21, 19, 18, 16, 15, 14, 13, 11, 10, 9, 8, 8, 7, 6, 5,
-    5, 4, 3, 3, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 5, 5, 5, 5, 6,
-    6, 6, 7, 7, 7, 7, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11,
-    11, 11, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14,
-    14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-    16, 16, 16, 16, 16, 16, 16, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
-    15, 15
-]
 
-trap100 = [
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 63, 63, 63,
-    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
-    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
-    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
-    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
-    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
-    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
-    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 64, 64, 64, 64, 64,
-    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 65, 65, 65, 65, 65,
-    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
-    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
-    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
-    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
-    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
-    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
-    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 64, 64, 64, 64,
-    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 63, 63, 63,
-    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
-    63, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 60, 60, 60, 60,
-    60, 60, 60, 60, 60, 60, 60, 60, 59, 59, 59, 59, 59, 59, 59, 59, 59,
-    59, 58, 58, 58, 58, 58, 58, 58, 58, 58, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 56, 56, 56, 56, 56, 56, 56, 56, 55, 55, 55, 55, 55, 55, 55,
-    54, 54, 54, 54, 54, 54, 54, 53, 53, 53, 53, 53, 53, 52, 52, 52, 52,
-    52, 52, 51, 51, 51, 51, 51, 51, 50, 50, 50, 50, 50, 50, 49, 49, 49,
-    49, 49, 48, 48, 48, 48, 48, 48, 47, 47, 47, 47, 47, 46, 46, 46, 46,
-    46, 45, 45, 45, 45, 44, 44, 44, 44, 44, 43, 43, 43, 43, 43, 42, 42,
-    42, 42, 41, 41, 41, 41, 40, 40, 40, 40, 40, 39, 39, 39, 39, 38, 38,
-    38, 38, 37, 37, 37, 37, 36, 36, 36, 36, 35, 35, 35, 35, 34, 34, 34,
-    33, 33, 33, 33, 32, 32, 32, 32, 31, 31, 31, 31, 30, 30, 30, 29, 29,
-    29, 29, 28, 28, 28, 28, 27, 27, 27, 26, 26, 26, 26, 25, 25, 25, 24,
-    24, 24, 24, 23, 23, 23, 22, 22, 22, 22, 21, 21, 21, 21, 20, 20, 20,
-    19, 19, 19, 19, 18, 18, 18, 17, 17, 17, 17, 16, 16, 16, 15, 15, 15,
-    15, 14, 14, 14, 14, 13, 13, 13, 13, 12, 12, 12, 11, 11, 11, 11, 10,
-    10, 10, 10, 9, 9, 9, 9, 9, 8, 8, 8, 8, 7, 7, 7, 7, 6, 6, 6, 6, 6, 5,
-    5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2,
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
-    2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 6, 6, 6, 6, 7, 7, 8,
-    8, 8, 9, 9, 10, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15, 16,
-    17, 17, 18, 18, 19, 20, 20, 21, 22, 22, 23, 24, 25, 25, 26, 27, 28,
-    28, 29, 30, 31, 32, 33, 34, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
-    44, 46, 47, 48, 49, 50, 51, 52, 54, 55, 56, 57, 59, 60, 61, 62, 64,
-    65, 67, 68, 69, 71, 72, 74, 75, 77, 78, 80, 81, 83, 85, 86, 88, 90,
-    91, 93, 95, 96, 98, 100, 102, 104, 105, 107, 109, 111, 113, 115, 117,
-    119, 121, 123, 125, 127, 129, 131, 134, 136, 138, 140, 142, 145, 147,
-    149, 152, 154, 156, 159, 161, 164, 166, 168, 171, 174, 176, 179, 181,
-    184, 187, 189, 192, 195, 197, 200, 203, 206, 209, 212, 214, 217, 220,
-    223, 226, 229, 232, 235, 239, 242, 245, 248, 251, 254, 258, 261, 264,
-    267, 271, 274, 278, 281, 284, 288, 291, 295, 298, 302, 306, 309, 313,
-    317, 320, 324, 328, 332, 335, 339, 343, 347, 351, 355, 359, 363, 367,
-    371, 375, 379, 383, 387, 391, 395, 400, 404, 408, 412, 417, 421, 425,
-    430, 434, 439, 443, 448, 452, 457, 461, 466, 470, 475, 480, 484, 489,
-    494, 499, 503, 508, 513, 518, 523, 528, 533, 538, 543, 548, 553, 558,
-    563, 568, 573, 578, 583, 589, 594, 599, 604, 610, 615, 620, 626, 631,
-    637, 642, 647, 653, 658, 664, 670, 675, 681, 686, 692, 698, 703, 709,
-    715, 720, 726, 732, 738, 744, 750, 755, 761, 767, 773, 779, 785, 791,
-    797, 803, 809, 815, 822, 828, 834, 840, 846, 852, 859, 865, 871, 877,
-    884, 890, 896, 903, 909, 916, 922, 929, 935, 941, 948, 954, 961, 968,
-    974, 981, 987, 994, 1001, 1007, 1014, 1021, 1027, 1034, 1041, 1048,
-    1054, 1061, 1068, 1075, 1082, 1088, 1095, 1102, 1109, 1116, 1123,
-    1130, 1137, 1144, 1151, 1158, 1165, 1172, 1179, 1186, 1193, 1200,
-    1207, 1214, 1222, 1229, 1236, 1243, 1250, 1258, 1265, 1272, 1279,
-    1286, 1294, 1301, 1308, 1316, 1323, 1330, 1338, 1345, 1352, 1360,
-    1367, 1374, 1382, 1389, 1397, 1404, 1412, 1419, 1427, 1434, 1442,
-    1449, 1457, 1464, 1472, 1479, 1487, 1494, 1502, 1510, 1517, 1525,
-    1532, 1540, 1548, 1555, 1563, 1571, 1578, 1586, 1594, 1601, 1609,
-    1617, 1624, 1632, 1640, 1648, 1655, 1663, 1671, 1679, 1686, 1694,
-    1702, 1710, 1718, 1725, 1733, 1741, 1749, 1757, 1765, 1772, 1780,
-    1788, 1796, 1804, 1812, 1820, 1828, 1836, 1843, 1851, 1859, 1867,
-    1875, 1883, 1891, 1899, 1907, 1915, 1923, 1931, 1939, 1947, 1955,
-    1963, 1971, 1979, 1987, 1995, 2003, 2011, 2019, 2027, 2035, 2043,
-    2051, 2059, 2067, 2075, 2083, 2091, 2099, 2107, 2115, 2123, 2131,
-    2139, 2147, 2155, 2163, 2172, 2180, 2188, 2196, 2204, 2212, 2220,
-    2228, 2236, 2244, 2252, 2260, 2269, 2277, 2285, 2293, 2301, 2309,
-    2317, 2325, 2333, 2342, 2350, 2358, 2366, 2374, 2382, 2390, 2398,
-    2407, 2415, 2423, 2431, 2439, 2447, 2455, 2464, 2472, 2480, 2488,
-    2496, 2504, 2512, 2521, 2529, 2537, 2545, 2553, 2561, 2570, 2578,
-    2586, 2594, 2602, 2610, 2618, 2627, 2635, 2643, 2651, 2659, 2667,
-    2676, 2684, 2692, 2700, 2708, 2716, 2724, 2733, 2741, 2749, 2757,
-    2765, 2773, 2782, 2790, 2798, 2806, 2814, 2822, 2831, 2839, 2847,
-    2855, 2863, 2871, 2880, 2888, 2896, 2904, 2912, 2920, 2928, 2937,
-    2945, 2953, 2961, 2969, 2977, 2986, 2994, 3002, 3010, 3018, 3026,
-    3034, 3043, 3051, 3059, 3067, 3075, 3083, 3091, 3100, 3108, 3116,
-    3124, 3132, 3140, 3148, 3157, 3165, 3173, 3181, 3189, 3197, 3205,
-    3214, 3222, 3230, 3238, 3246, 3254, 3262, 3271, 3279, 3287, 3295,
-    3303, 3311, 3319, 3327, 3336, 3344, 3352, 3360, 3368, 3376, 3384,
-    3393, 3401, 3409, 3417, 3425, 3433, 3441, 3449, 3457, 3466, 3474,
-    3482, 3490, 3498, 3506, 3514, 3522, 3531, 3539, 3547, 3555, 3563,
-    3571, 3579, 3587, 3595, 3604, 3612, 3620, 3628, 3636, 3644, 3652,
-    3660, 3668, 3677, 3685, 3693, 3701, 3709, 3717, 3725, 3733, 3741,
-    3749, 3758, 3766, 3774, 3782, 3790, 3798, 3806, 3814, 3822, 3830,
-    3839, 3847, 3855, 3863, 3871, 3879, 3887, 3895, 3903, 3911, 3919,
-    3928, 3936, 3944, 3952, 3960, 3968, 3976, 3984, 3992, 4000, 4009,
-    4017, 4025, 4033, 4041, 4049, 4057, 4065, 4073, 4081, 4089, 4098,
-    4106, 4114, 4122, 4130, 4138, 4146, 4154, 4162, 4170, 4178, 4187,
-    4195, 4203, 4211, 4219, 4227, 4235, 4243, 4251, 4259, 4267, 4276,
-    4284, 4292, 4300, 4308, 4316, 4324, 4332, 4340, 4348, 4357, 4365,
-    4373, 4381, 4389, 4397, 4405, 4413, 4421, 4429, 4438, 4446, 4454,
-    4462, 4470, 4478, 4486, 4494, 4502, 4510, 4519, 4527, 4535, 4543,
-    4551, 4559, 4567, 4575, 4583, 4592, 4600, 4608, 4616, 4624, 4632,
-    4640, 4648, 4656, 4665, 4673, 4681, 4689, 4697, 4705, 4713, 4721,
-    4729, 4738, 4746, 4754, 4762, 4770, 4778, 4786, 4794, 4803, 4811,
-    4819, 4827, 4835, 4843, 4851, 4859, 4868, 4876, 4884, 4892, 4900,
-    4908, 4916, 4924, 4933, 4941, 4949, 4957, 4965, 4973, 4981, 4990,
-    4998, 5006, 5014, 5022, 5030, 5038, 5047, 5055, 5063, 5071, 5079,
-    5087, 5095, 5104, 5112, 5120, 5128, 5136, 5144, 5152, 5161, 5169,
-    5177, 5185, 5193, 5201, 5210, 5218, 5226, 5234, 5242, 5250, 5258,
-    5267, 5275, 5283, 5291, 5299, 5307, 5316, 5324, 5332, 5340, 5348,
-    5356, 5365, 5373, 5381, 5389, 5397, 5405, 5413, 5422, 5430, 5438,
-    5446, 5454, 5462, 5471, 5479, 5487, 5495, 5503, 5511, 5520, 5528,
-    5536, 5544, 5552, 5560, 5568, 5577, 5585, 5593, 5601, 5609, 5617,
-    5626, 5634, 5642, 5650, 5658, 5666, 5674, 5683, 5691, 5699, 5707,
-    5715, 5723, 5731, 5740, 5748, 5756, 5764, 5772, 5780, 5788, 5797,
-    5805, 5813, 5821, 5829, 5837, 5845, 5853, 5862, 5870, 5878, 5886,
-    5894, 5902, 5910, 5918, 5926, 5935, 5943, 5951, 5959, 5967, 5975,
-    5983, 5991, 5999, 6007, 6015, 6024, 6032, 6040, 6048, 6056, 6064,
-    6072, 6080, 6088, 6096, 6104, 6112, 6120, 6128, 6136, 6144, 6152,
-    6160, 6168, 6176, 6184, 6192, 6200, 6208, 6216, 6224, 6232, 6240,
-    6248, 6256, 6264, 6272, 6280, 6288, 6296, 6304, 6312, 6320, 6328,
-    6336, 6344, 6352, 6359, 6367, 6375, 6383, 6391, 6399, 6407, 6415,
-    6422, 6430, 6438, 6446, 6454, 6462, 6469, 6477, 6485, 6493, 6501,
-    6508, 6516, 6524, 6532, 6540, 6547, 6555, 6563, 6570, 6578, 6586,
-    6594, 6601, 6609, 6617, 6624, 6632, 6640, 6647, 6655, 6662, 6670,
-    6678, 6685, 6693, 6700, 6708, 6716, 6723, 6731, 6738, 6746, 6753,
-    6761, 6768, 6776, 6783, 6791, 6798, 6805, 6813, 6820, 6828, 6835,
-    6842, 6850, 6857, 6864, 6872, 6879, 6886, 6894, 6901, 6908, 6915,
-    6923, 6930, 6937, 6944, 6951, 6959, 6966, 6973, 6980, 6987, 6994,
-    7001, 7008, 7016, 7023, 7030, 7037, 7044, 7051, 7058, 7065, 7071,
-    7078, 7085, 7092, 7099, 7106, 7113, 7120, 7126, 7133, 7140, 7147,
-    7154, 7160, 7167, 7174, 7180, 7187, 7194, 7200, 7207, 7214, 7220,
-    7227, 7233, 7240, 7246, 7253, 7259, 7266, 7272, 7279, 7285, 7291,
-    7298, 7304, 7310, 7317, 7323, 7329, 7335, 7342, 7348, 7354, 7360,
-    7366, 7372, 7379, 7385, 7391, 7397, 7403, 7409, 7415, 7421, 7427,
-    7433, 7438, 7444, 7450, 7456, 7462, 7468, 7473, 7479, 7485, 7491,
-    7496, 7502, 7508, 7513, 7519, 7524, 7530, 7535, 7541, 7546, 7552,
-    7557, 7563, 7568, 7573, 7579, 7584, 7589, 7595, 7600, 7605, 7610,
-    7615, 7620, 7626, 7631, 7636, 7641, 7646, 7651, 7656, 7661, 7666,
-    7671, 7675, 7680, 7685, 7690, 7695, 7699, 7704, 7709, 7714, 7718,
-    7723, 7727, 7732, 7737, 7741, 7746, 7750, 7755, 7759, 7763, 7768,
-    7772, 7776, 7781, 7785, 7789, 7793, 7798, 7802, 7806, 7810, 7814,
-    7818, 7822, 7826, 7830, 7834, 7838, 7842, 7846, 7850, 7854, 7858,
-    7861, 7865, 7869, 7873, 7876, 7880, 7884, 7887, 7891, 7894, 7898,
-    7901, 7905, 7908, 7912, 7915, 7918, 7922, 7925, 7928, 7932, 7935,
-    7938, 7941, 7945, 7948, 7951, 7954, 7957, 7960, 7963, 7966, 7969,
-    7972, 7975, 7978, 7981, 7984, 7987, 7989, 7992, 7995, 7998, 8000,
-    8003, 8006, 8008, 8011, 8014, 8016, 8019, 8021, 8024, 8026, 8029,
-    8031, 8034, 8036, 8038, 8041, 8043, 8045, 8048, 8050, 8052, 8054,
-    8056, 8059, 8061, 8063, 8065, 8067, 8069, 8071, 8073, 8075, 8077,
-    8079, 8081, 8083, 8085, 8087, 8088, 8090, 8092, 8094, 8095, 8097,
-    8099, 8101, 8102, 8104, 8106, 8107, 8109, 8110, 8112, 8113, 8115,
-    8117, 8118, 8119, 8121, 8122, 8124, 8125, 8126, 8128, 8129, 8130,
-    8132, 8133, 8134, 8136, 8137, 8138, 8139, 8140, 8142, 8143, 8144,
-    8145, 8146, 8147, 8148, 8149, 8150, 8151, 8152, 8153, 8154, 8155,
-    8156, 8157, 8158, 8159, 8160, 8160, 8161, 8162, 8163, 8164, 8165,
-    8165, 8166, 8167, 8168, 8168, 8169, 8170, 8170, 8171, 8172, 8172,
-    8173, 8174, 8174, 8175, 8175, 8176, 8176, 8177, 8177, 8178, 8178,
-    8179, 8179, 8180, 8180, 8181, 8181, 8182, 8182, 8182, 8183, 8183,
-    8184, 8184, 8184, 8185, 8185, 8185, 8186, 8186, 8186, 8186, 8187,
-    8187, 8187, 8188, 8188, 8188, 8188, 8188, 8189, 8189, 8189, 8189,
-    8189, 8189, 8190, 8190, 8190, 8190, 8190, 8190, 8190, 8190, 8190,
-    8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,
-    8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,
-    8191, 8191, 8191, 8190, 8190, 8190, 8190, 8190, 8190, 8190, 8190,
-    8190, 8190, 8189, 8189, 8189, 8189, 8189, 8189, 8189, 8189, 8188,
-    8188, 8188, 8188, 8188, 8188, 8187, 8187, 8187, 8187, 8187, 8186,
-    8186, 8186, 8186, 8186, 8185, 8185, 8185, 8185, 8185, 8184, 8184,
-    8184, 8184, 8184, 8183, 8183, 8183, 8183, 8182, 8182, 8182, 8182,
-    8181, 8181, 8181, 8181, 8180, 8180, 8180, 8180, 8179, 8179, 8179,
-    8179, 8178, 8178, 8178, 8178, 8177, 8177, 8177, 8176, 8176, 8176,
-    8176, 8175, 8175, 8175, 8175, 8174, 8174, 8174, 8173, 8173, 8173,
-    8173, 8172, 8172, 8172, 8171, 8171, 8171, 8171, 8170, 8170, 8170,
-    8170, 8169, 8169, 8169, 8168, 8168, 8168, 8168, 8167, 8167, 8167,
-    8166, 8166, 8166, 8166, 8165, 8165, 8165, 8164, 8164, 8164, 8164,
-    8163, 8163, 8163, 8162, 8162, 8162, 8162, 8161, 8161, 8161, 8161,
-    8160, 8160, 8160, 8160, 8159, 8159, 8159, 8158, 8158, 8158, 8158,
-    8157, 8157, 8157, 8157, 8156, 8156, 8156, 8156, 8155, 8155, 8155,
-    8155, 8154, 8154, 8154, 8154, 8153, 8153, 8153, 8153, 8152, 8152,
-    8152, 8152, 8151, 8151, 8151, 8151, 8150, 8150, 8150, 8150, 8149,
-    8149, 8149, 8149, 8149, 8148, 8148, 8148, 8148, 8147, 8147, 8147,
-    8147, 8147, 8146, 8146, 8146, 8146, 8146, 8145, 8145, 8145, 8145,
-    8145, 8144, 8144, 8144, 8144, 8144, 8143, 8143, 8143, 8143, 8143,
-    8142, 8142, 8142, 8142, 8142, 8141, 8141, 8141, 8141, 8141, 8141,
-    8140, 8140, 8140, 8140, 8140, 8140, 8139, 8139, 8139, 8139, 8139,
-    8139, 8138, 8138, 8138, 8138, 8138, 8138, 8138, 8137, 8137, 8137,
-    8137, 8137, 8137, 8137, 8136, 8136, 8136, 8136, 8136, 8136, 8136,
-    8135, 8135, 8135, 8135, 8135, 8135, 8135, 8135, 8134, 8134, 8134,
-    8134, 8134, 8134, 8134, 8134, 8133, 8133, 8133, 8133, 8133, 8133,
-    8133, 8133, 8133, 8132, 8132, 8132, 8132, 8132, 8132, 8132, 8132,
-    8132, 8132, 8132, 8131, 8131, 8131, 8131, 8131, 8131, 8131, 8131,
-    8131, 8131, 8131, 8130, 8130, 8130, 8130, 8130, 8130, 8130, 8130,
-    8130, 8130, 8130, 8130, 8130, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126, 8126,
-    8126, 8126, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127, 8127,
-    8127, 8127, 8127, 8127, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128, 8128,
-    8128, 8128, 8128, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129,
-    8129, 8129, 8129, 8129, 8129, 8129, 8129, 8129, 8130, 8130, 8130,
-    8130, 8130, 8130, 8130, 8130, 8130, 8130, 8130, 8130, 8130, 8131,
-    8131, 8131, 8131, 8131, 8131, 8131, 8131, 8131, 8131, 8131, 8131,
-    8132, 8132, 8132, 8132, 8132, 8132, 8132, 8132, 8132, 8132, 8133,
-    8133, 8133, 8133, 8133, 8133, 8133, 8133, 8133, 8134, 8134, 8134,
-    8134, 8134, 8134, 8134, 8134, 8134, 8135, 8135, 8135, 8135, 8135,
-    8135, 8135, 8135, 8136, 8136, 8136, 8136, 8136, 8136, 8136, 8137,
-    8137, 8137, 8137, 8137, 8137, 8137, 8138, 8138, 8138, 8138, 8138,
-    8138, 8139, 8139, 8139, 8139, 8139, 8139, 8140, 8140, 8140, 8140,
-    8140, 8140, 8141, 8141, 8141, 8141, 8141, 8141, 8142, 8142, 8142,
-    8142, 8142, 8143, 8143, 8143, 8143, 8143, 8143, 8144, 8144, 8144,
-    8144, 8144, 8145, 8145, 8145, 8145, 8145, 8146, 8146, 8146, 8146,
-    8147, 8147, 8147, 8147, 8147, 8148, 8148, 8148, 8148, 8148, 8149,
-    8149, 8149, 8149, 8150, 8150, 8150, 8150, 8151, 8151, 8151, 8151,
-    8151, 8152, 8152, 8152, 8152, 8153, 8153, 8153, 8153, 8154, 8154,
-    8154, 8154, 8155, 8155, 8155, 8155, 8156, 8156, 8156, 8156, 8157,
-    8157, 8157, 8158, 8158, 8158, 8158, 8159, 8159, 8159, 8159, 8160,
-    8160, 8160, 8160, 8161, 8161, 8161, 8162, 8162, 8162, 8162, 8163,
-    8163, 8163, 8163, 8164, 8164, 8164, 8165, 8165, 8165, 8165, 8166,
-    8166, 8166, 8167, 8167, 8167, 8167, 8168, 8168, 8168, 8169, 8169,
-    8169, 8169, 8170, 8170, 8170, 8170, 8171, 8171, 8171, 8172, 8172,
-    8172, 8172, 8173, 8173, 8173, 8174, 8174, 8174, 8174, 8175, 8175,
-    8175, 8176, 8176, 8176, 8176, 8177, 8177, 8177, 8177, 8178, 8178,
-    8178, 8178, 8179, 8179, 8179, 8180, 8180, 8180, 8180, 8181, 8181,
-    8181, 8181, 8182, 8182, 8182, 8182, 8182, 8183, 8183, 8183, 8183,
-    8184, 8184, 8184, 8184, 8185, 8185, 8185, 8185, 8185, 8186, 8186,
-    8186, 8186, 8186, 8187, 8187, 8187, 8187, 8187, 8187, 8188, 8188,
-    8188, 8188, 8188, 8188, 8189, 8189, 8189, 8189, 8189, 8189, 8189,
-    8190, 8190, 8190, 8190, 8190, 8190, 8190, 8190, 8190, 8190, 8191,
-    8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,
-    8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191, 8191,
-    8191, 8191, 8191, 8190, 8190, 8190, 8190, 8190, 8190, 8190, 8190,
-    8190, 8189, 8189, 8189, 8189, 8189, 8188, 8188, 8188, 8188, 8188,
-    8187, 8187, 8187, 8187, 8186, 8186, 8186, 8185, 8185, 8185, 8185,
-    8184, 8184, 8183, 8183, 8183, 8182, 8182, 8181, 8181, 8181, 8180,
-    8180, 8179, 8179, 8178, 8178, 8177, 8177, 8176, 8176, 8175, 8174,
-    8174, 8173, 8173, 8172, 8171, 8171, 8170, 8169, 8169, 8168, 8167,
-    8166, 8166, 8165, 8164, 8163, 8163, 8162, 8161, 8160, 8159, 8158,
-    8157, 8157, 8156, 8155, 8154, 8153, 8152, 8151, 8150, 8149, 8148,
-    8147, 8145, 8144, 8143, 8142, 8141, 8140, 8139, 8137, 8136, 8135,
-    8134, 8132, 8131, 8130, 8129, 8127, 8126, 8124, 8123, 8122, 8120,
-    8119, 8117, 8116, 8114, 8113, 8111, 8110, 8108, 8106, 8105, 8103,
-    8101, 8100, 8098, 8096, 8095, 8093, 8091, 8089, 8087, 8086, 8084,
-    8082, 8080, 8078, 8076, 8074, 8072, 8070, 8068, 8066, 8064, 8062,
-    8060, 8057, 8055, 8053, 8051, 8049, 8046, 8044, 8042, 8039, 8037,
-    8035, 8032, 8030, 8027, 8025, 8023, 8020, 8017, 8015, 8012, 8010,
-    8007, 8004, 8002, 7999, 7996, 7994, 7991, 7988, 7985, 7982, 7979,
-    7977, 7974, 7971, 7968, 7965, 7962, 7959, 7956, 7952, 7949, 7946,
-    7943, 7940, 7937, 7933, 7930, 7927, 7924, 7920, 7917, 7913, 7910,
-    7907, 7903, 7900, 7896, 7893, 7889, 7885, 7882, 7878, 7874, 7871,
-    7867, 7863, 7859, 7856, 7852, 7848, 7844, 7840, 7836, 7832, 7828,
-    7824, 7820, 7816, 7812, 7808, 7804, 7800, 7796, 7791, 7787, 7783,
-    7779, 7774, 7770, 7766, 7761, 7757, 7752, 7748, 7743, 7739, 7734,
-    7730, 7725, 7721, 7716, 7711, 7707, 7702, 7697, 7692, 7688, 7683,
-    7678, 7673, 7668, 7663, 7658, 7653, 7648, 7643, 7638, 7633, 7628,
-    7623, 7618, 7613, 7608, 7602, 7597, 7592, 7587, 7581, 7576, 7571,
-    7565, 7560, 7554, 7549, 7544, 7538, 7533, 7527, 7521, 7516, 7510,
-    7505, 7499, 7493, 7488, 7482, 7476, 7471, 7465, 7459, 7453, 7447,
-    7441, 7436, 7430, 7424, 7418, 7412, 7406, 7400, 7394, 7388, 7382,
-    7376, 7369, 7363, 7357, 7351, 7345, 7339, 7332, 7326, 7320, 7314,
-    7307, 7301, 7295, 7288, 7282, 7275, 7269, 7262, 7256, 7250, 7243,
-    7237, 7230, 7223, 7217, 7210, 7204, 7197, 7190, 7184, 7177, 7170,
-    7164, 7157, 7150, 7143, 7137, 7130, 7123, 7116, 7109, 7103, 7096,
-    7089, 7082, 7075, 7068, 7061, 7054, 7047, 7040, 7033, 7026, 7019,
-    7012, 7005, 6998, 6991, 6984, 6977, 6969, 6962, 6955, 6948, 6941,
-    6933, 6926, 6919, 6912, 6905, 6897, 6890, 6883, 6875, 6868, 6861,
-    6853, 6846, 6839, 6831, 6824, 6817, 6809, 6802, 6794, 6787, 6779,
-    6772, 6764, 6757, 6749, 6742, 6734, 6727, 6719, 6712, 6704, 6697,
-    6689, 6681, 6674, 6666, 6659, 6651, 6643, 6636, 6628, 6620, 6613,
-    6605, 6597, 6590, 6582, 6574, 6567, 6559, 6551, 6543, 6536, 6528,
-    6520, 6512, 6505, 6497, 6489, 6481, 6473, 6466, 6458, 6450, 6442,
-    6434, 6426, 6419, 6411, 6403, 6395, 6387, 6379, 6371, 6363, 6355,
-    6348, 6340, 6332, 6324, 6316, 6308, 6300, 6292, 6284, 6276, 6268,
-    6260, 6252, 6244, 6236, 6228, 6220, 6212, 6204, 6196, 6188, 6180,
-    6172, 6164, 6156, 6148, 6140, 6132, 6124, 6116, 6108, 6100, 6092,
-    6084, 6076, 6068, 6060, 6052, 6044, 6036, 6028, 6019, 6011, 6003,
-    5995, 5987, 5979, 5971, 5963, 5955, 5947, 5939, 5931, 5922, 5914,
-    5906, 5898, 5890, 5882, 5874, 5866, 5858, 5849, 5841, 5833, 5825,
-    5817, 5809, 5801, 5793, 5784, 5776, 5768, 5760, 5752, 5744, 5736,
-    5727, 5719, 5711, 5703, 5695, 5687, 5679, 5670, 5662, 5654, 5646,
-    5638, 5630, 5621, 5613, 5605, 5597, 5589, 5581, 5573, 5564, 5556,
-    5548, 5540, 5532, 5524, 5515, 5507, 5499, 5491, 5483, 5475, 5467,
-    5458, 5450, 5442, 5434, 5426, 5418, 5409, 5401, 5393, 5385, 5377,
-    5369, 5360, 5352, 5344, 5336, 5328, 5320, 5311, 5303, 5295, 5287,
-    5279, 5271, 5263, 5254, 5246, 5238, 5230, 5222, 5214, 5205, 5197,
-    5189, 5181, 5173, 5165, 5157, 5148, 5140, 5132, 5124, 5116, 5108,
-    5100, 5091, 5083, 5075, 5067, 5059, 5051, 5043, 5034, 5026, 5018,
-    5010, 5002, 4994, 4986, 4977, 4969, 4961, 4953, 4945, 4937, 4929,
-    4920, 4912, 4904, 4896, 4888, 4880, 4872, 4864, 4855, 4847, 4839,
-    4831, 4823, 4815, 4807, 4798, 4790, 4782, 4774, 4766, 4758, 4750,
-    4742, 4734, 4725, 4717, 4709, 4701, 4693, 4685, 4677, 4669, 4660,
-    4652, 4644, 4636, 4628, 4620, 4612, 4604, 4596, 4587, 4579, 4571,
-    4563, 4555, 4547, 4539, 4531, 4523, 4514, 4506, 4498, 4490, 4482,
-    4474, 4466, 4458, 4450, 4442, 4433, 4425, 4417, 4409, 4401, 4393,
-    4385, 4377, 4369, 4361, 4352, 4344, 4336, 4328, 4320, 4312, 4304,
-    4296, 4288, 4280, 4272, 4263, 4255, 4247, 4239, 4231, 4223, 4215,
-    4207, 4199, 4191, 4182, 4174, 4166, 4158, 4150, 4142, 4134, 4126,
-    4118, 4110, 4102, 4093, 4085, 4077, 4069, 4061, 4053, 4045, 4037,
-    4029, 4021, 4013, 4004, 3996, 3988, 3980, 3972, 3964, 3956, 3948,
-    3940, 3932, 3924, 3915, 3907, 3899, 3891, 3883, 3875, 3867, 3859,
-    3851, 3843, 3834, 3826, 3818, 3810, 3802, 3794, 3786, 3778, 3770,
-    3762, 3753, 3745, 3737, 3729, 3721, 3713, 3705, 3697, 3689, 3681,
-    3672, 3664, 3656, 3648, 3640, 3632, 3624, 3616, 3608, 3599, 3591,
-    3583, 3575, 3567, 3559, 3551, 3543, 3535, 3526, 3518, 3510, 3502,
-    3494, 3486, 3478, 3470, 3462, 3453, 3445, 3437, 3429, 3421, 3413,
-    3405, 3397, 3388, 3380, 3372, 3364, 3356, 3348, 3340, 3332, 3323,
-    3315, 3307, 3299, 3291, 3283, 3275, 3267, 3258, 3250, 3242, 3234,
-    3226, 3218, 3210, 3201, 3193, 3185, 3177, 3169, 3161, 3153, 3144,
-    3136, 3128, 3120, 3112, 3104, 3096, 3087, 3079, 3071, 3063, 3055,
-    3047, 3039, 3030, 3022, 3014, 3006, 2998, 2990, 2981, 2973, 2965,
-    2957, 2949, 2941, 2933, 2924, 2916, 2908, 2900, 2892, 2884, 2875,
-    2867, 2859, 2851, 2843, 2835, 2826, 2818, 2810, 2802, 2794, 2786,
-    2778, 2769, 2761, 2753, 2745, 2737, 2729, 2720, 2712, 2704, 2696,
-    2688, 2680, 2671, 2663, 2655, 2647, 2639, 2631, 2623, 2614, 2606,
-    2598, 2590, 2582, 2574, 2565, 2557, 2549, 2541, 2533, 2525, 2517,
-    2508, 2500, 2492, 2484, 2476, 2468, 2460, 2451, 2443, 2435, 2427,
-    2419, 2411, 2403, 2394, 2386, 2378, 2370, 2362, 2354, 2346, 2338,
-    2329, 2321, 2313, 2305, 2297, 2289, 2281, 2273, 2265, 2256, 2248,
-    2240, 2232, 2224, 2216, 2208, 2200, 2192, 2184, 2176, 2167, 2159,
-    2151, 2143, 2135, 2127, 2119, 2111, 2103, 2095, 2087, 2079, 2071,
-    2063, 2055, 2047, 2039, 2031, 2023, 2015, 2007, 1999, 1991, 1983,
-    1975, 1967, 1959, 1951, 1943, 1935, 1927, 1919, 1911, 1903, 1895,
-    1887, 1879, 1871, 1863, 1855, 1847, 1839, 1832, 1824, 1816, 1808,
-    1800, 1792, 1784, 1776, 1769, 1761, 1753, 1745, 1737, 1729, 1722,
-    1714, 1706, 1698, 1690, 1683, 1675, 1667, 1659, 1651, 1644, 1636,
-    1628, 1621, 1613, 1605, 1597, 1590, 1582, 1574, 1567, 1559, 1551,
-    1544, 1536, 1529, 1521, 1513, 1506, 1498, 1491, 1483, 1475, 1468,
-    1460, 1453, 1445, 1438, 1430, 1423, 1415, 1408, 1400, 1393, 1386,
-    1378, 1371, 1363, 1356, 1349, 1341, 1334, 1327, 1319, 1312, 1305,
-    1297, 1290, 1283, 1276, 1268, 1261, 1254, 1247, 1240, 1232, 1225,
-    1218, 1211, 1204, 1197, 1190, 1183, 1175, 1168, 1161, 1154, 1147,
-    1140, 1133, 1126, 1120, 1113, 1106, 1099, 1092, 1085, 1078, 1071,
-    1065, 1058, 1051, 1044, 1037, 1031, 1024, 1017, 1011, 1004, 997, 991,
-    984, 977, 971, 964, 958, 951, 945, 938, 932, 925, 919, 912, 906, 900,
-    893, 887, 881, 874, 868, 862, 856, 849, 843, 837, 831, 825, 819, 812,
-    806, 800, 794, 788, 782, 776, 770, 764, 758, 753, 747, 741, 735, 729,
-    723, 718, 712, 706, 700, 695, 689, 683, 678, 672, 667, 661, 656, 650,
-    645, 639, 634, 628, 623, 618, 612, 607, 602, 596, 591, 586, 581, 576,
-    571, 565, 560, 555, 550, 545, 540, 535, 530, 525, 520, 516, 511, 506,
-    501, 496, 492, 487, 482, 477, 473, 468, 464, 459, 454, 450, 445, 441,
-    436, 432, 428, 423, 419, 415, 410, 406, 402, 398, 393, 389, 385, 381,
-    377, 373, 369, 365, 361, 357, 353, 349, 345, 341, 337, 333, 330, 326,
-    322, 318, 315, 311, 307, 304, 300, 297, 293, 290, 286, 283, 279, 276,
-    273, 269, 266, 263, 259, 256, 253, 250, 246, 243, 240, 237, 234, 231,
-    228, 225, 222, 219, 216, 213, 210, 207, 204, 202, 199, 196, 193, 191,
-    188, 185, 183, 180, 177, 175, 172, 170, 167, 165, 162, 160, 157, 155,
-    153, 150, 148, 146, 143, 141, 139, 137, 135, 132, 130, 128, 126, 124,
-    122, 120, 118, 116, 114, 112, 110, 108, 106, 104, 103, 101, 99, 97,
-    96, 94, 92, 90, 89, 87, 85, 84, 82, 81, 79, 78, 76, 74, 73, 72, 70,
-    69, 67, 66, 65, 63, 62, 61, 59, 58, 57, 55, 54, 53, 52, 51, 49, 48,
-    47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31,
-    31, 30, 29, 28, 27, 26, 26, 25, 24, 23, 23, 22, 21, 21, 20, 19, 19,
-    18, 17, 17, 16, 16, 15, 15, 14, 14, 13, 13, 12, 12, 11, 11, 10, 10, 9,
-    9, 9, 8, 8, 7, 7, 7, 6, 6, 6, 5, 5, 5, 5, 4, 4, 4, 3, 3, 3, 3, 3, 2,
-    2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
-    1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 5,
-    5, 5, 5, 5, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 8, 8, 8, 8, 9, 9, 9, 9, 10,
-    10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 13, 14, 14,
-    14, 15, 15, 15, 15, 16, 16, 16, 16, 17, 17, 17, 18, 18, 18, 18, 19,
-    19, 19, 20, 20, 20, 20, 21, 21, 21, 21, 22, 22, 22, 23, 23, 23, 23,
-    24, 24, 24, 25, 25, 25, 25, 26, 26, 26, 27, 27, 27, 27, 28, 28, 28,
-    29, 29, 29, 29, 30, 30, 30, 30, 31, 31, 31, 31, 32, 32, 32, 33, 33,
-    33, 33, 34, 34, 34, 34, 35, 35, 35, 35, 36, 36, 36, 36, 37, 37, 37,
-    37, 38, 38, 38, 38, 39, 39, 39, 39, 40, 40, 40, 40, 41, 41, 41, 41,
-    42, 42, 42, 42, 42, 43, 43, 43, 43, 44, 44, 44, 44, 44, 45, 45, 45,
-    45, 45, 46, 46, 46, 46, 46, 47, 47, 47, 47, 47, 48, 48, 48, 48, 48,
-    49, 49, 49, 49, 49, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51,
-    52, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 53, 54, 54, 54, 54,
-    54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 56, 56, 56, 56, 56, 56, 56,
-    56, 57, 57, 57, 57, 57, 57, 57, 57, 58, 58, 58, 58, 58, 58, 58, 58,
-    58, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 60, 60, 60, 60, 60,
-    60, 60, 60, 60, 60, 60, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-    61, 61, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
-    63, 63, 63, 63, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-    64, 64, 64, 64, 64, 64, 64, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
-    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
-    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
-    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
-    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
-    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
-    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
-    65, 65, 65, 65, 65, 65, 65, 65, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-    64, 64, 64, 64, 64, 64, 64, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
-    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
-    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
-    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
-    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
-    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
-    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
-    63, 63, 63, 63, 63, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
-    62, 62
-]
+"""----------------------------------------------------------------------------
+Band-limited steps
+----------------------------------------------------------------------------"""
 
 bl_steps = [
     [1, 1, 1.0007, 0.99867, 0.99708, 1.0103, 0.99643, 0.97054, 1.0552, 1.001,
@@ -4340,33 +210,12 @@ bl_steps = [
      -0.00067746, -3.883e-05, 2.2204e-15],
 ]
 
-x = [x * 8 - 32767 for x in saw10[0::8]]
-x.append(x[0])
-waveforms.append(('saw10', x))
-
-x = [x * 8 - 32767 for x in saw100[0::8]]
-x.append(x[0])
-waveforms.append(('saw100', x))
-
-x = [x * 8 - 32767 for x in tri10[0::8]]
-x.append(x[0])
-waveforms.append(('tri10', x))
-
-x = [x * 8 - 32767 for x in tri100[0::8]]
-x.append(x[0])
-waveforms.append(('tri100', x))
-
-x = [x * 8 - 32767 for x in trap10[0::8]]
-x.append(x[0])
-waveforms.append(('trap10', x))
-
-x = [x * 8 - 32767 for x in trap100[0::8]]
-x.append(x[0])
-waveforms.append(('trap100', x))
-
-bl_steps = [[int(x*30000) for x in l][6:-6] for l in bl_steps]
-
-# bl_steps[0] = numpy.arange(30000, 0, -30)
+# steps are normalized to 2^14 so that they are applied with a shift
+bl_steps = [[int(x*16384) for x in l][6:-6] for l in bl_steps]
 
-for i in range(0, 32):
-    waveforms.append(('bl_step'+str(i), bl_steps[i]))
+# single table, with the 32 sub-sample positions of each tap interleaved:
+# tap k of sub-sample position i is at index k * 32 + i.
+bl_step = []
+for tap in zip(*bl_steps):
+    bl_step.extend(tap)
+waveforms.append(('bl_step', bl_step))
@@ -0,0 +1,186 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Render path benchmark: reports the host time per sample for each
+// feature mode (audio interrupt: ADC scan, processor and DAC write) and
+// for each LFO shape (single LFO, rendering the sine and the shape, as
+// Lfo::Render does). For the modes, the worst sample is reported next to
+// the mean: it bounds the interrupt, as the max of PROFILE_ISR does on
+// the module. The time of each sample is the shortest of kNumRuns runs,
+// which leaves out the preemptions of the host; the worst sample is taken
+// after the first control period, which runs with cold caches.
+//
+// Usage: batumi_bench [script]
+// When a script is given, it is also run through the processor.
+
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+#include "stmlib/utils/random.h"
+
+#include "sim/control_script.h"
+#include "sim/simulator.h"
+#include "lfo.h"
+
+using namespace batumi;
+using namespace stmlib;
+using namespace std;
+
+const uint32_t kBenchDuration = 60 * SAMPLE_RATE;  // samples
+const uint32_t kLfoBenchDuration = 600 * SAMPLE_RATE;
+const uint32_t kSeed = 0x21;
+const uint8_t kNumRuns = 5;
+
+static const char* feat_mode_names[FEAT_MODE_LAST] = {
+  "free", "quad", "phase", "divide"
+};
+
+static const char* shape_names[] = {
+  "sine", "trapezoid", "ramp", "saw", "triangle", "square",
+  "random_step", "random_smooth", "logistic_step", "logistic_smooth"
+};
+
+static Simulator simulator;
+static Lfo lfo;
+
+// keeps the compiler from optimizing the renders away
+volatile int32_t sink;
+
+static double Now() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+// A busy patch: slow pot moves, CV sweeps and one reset per second on
+// every channel.
+static void MakeScript(FeatureMode mode, ControlScript* script) {
+  script->Init();
+  script->Add(0, CONTROL_ID_MODE, 0, mode);
+  for (uint8_t i=0; i<kNumSimChannels; i++) {
+    script->Add(0, CONTROL_ID_COARSE, i, 20000 + 10000 * i);
+  }
+  for (uint32_t t=0; t<kBenchDuration; t+=SAMPLE_RATE / 8) {
+    for (uint8_t i=0; i<kNumSimChannels; i++) {
+      int32_t cv = (t / 64 + i * 4096) % 32768 - 16384;
+      script->Add(t, CONTROL_ID_CV, i, cv);
+    }
+    if (t % SAMPLE_RATE == 0) {
+      for (uint8_t i=0; i<kNumSimChannels; i++) {
+        script->AddPulse(t + i * 100, i, 32);
+      }
+    }
+  }
+}
+
+// shortest time between two readings of the clock
+static double TimerOverhead() {
+  double overhead = 1e9;
+  for (int i=0; i<1000; i++) {
+    double start = Now();
+    double end = Now();
+    if (end - start < overhead)
+      overhead = end - start;
+  }
+  return overhead;
+}
+
+// Returns the mean time per sample, and the worst in *worst.
+static double BenchProcessor(ControlScript* script, uint32_t duration,
+                             double* worst) {
+  vector<double> times(duration, 1e9);
+  double overhead = TimerOverhead();
+  for (uint8_t run=0; run<kNumRuns; run++) {
+    simulator.Init(script, kSeed);
+    for (uint32_t t=0; t<duration; t++) {
+      simulator.ProcessControls();
+      double start = Now();
+      simulator.ProcessAudio();
+      double end = Now();
+      if (end - start - overhead < times[t])
+        times[t] = end - start - overhead;
+    }
+  }
+  sink = dac_output[0];
+  double sum = 0.0;
+  *worst = 0.0;
+  for (uint32_t t=0; t<duration; t++) {
+    sum += times[t];
+    if (t >= kControlRateDivider && times[t] > *worst)
+      *worst = times[t];
+  }
+  return sum / duration;
+}
+
+static double BenchShape(LfoShape shape) {
+  Random::Seed(kSeed);
+  lfo.Init();
+  lfo.set_pitch(0);
+  lfo.set_shape(shape);
+  int32_t acc = 0;
+  double start = Now();
+  for (uint32_t t=0; t<kLfoBenchDuration; t++) {
+    lfo.Step();
+    int16_t sine_sample, shape_sample;
+    lfo.Render(&sine_sample, &shape_sample);
+    acc += sine_sample + shape_sample;
+  }
+  double end = Now();
+  sink = acc;
+  return (end - start) / kLfoBenchDuration;
+}
+
+int main(int argc, char** argv) {
+  ControlScript script;
+
+  double worst;
+
+  printf("# ns/sample (mean, worst), %d samples per run\n", kBenchDuration);
+  for (int i=0; i<FEAT_MODE_LAST; i++) {
+    FeatureMode mode = static_cast<FeatureMode>(i);
+    MakeScript(mode, &script);
+    double mean = BenchProcessor(&script, kBenchDuration, &worst);
+    printf("mode %-16s %8.1f %8.1f\n", feat_mode_names[i], mean, worst);
+  }
+
+  for (int i=0; i<=SHAPE_LOGISTIC_SMOOTH; i++) {
+    LfoShape shape = static_cast<LfoShape>(i);
+    printf("shape %-15s %8.1f\n", shape_names[i], BenchShape(shape));
+  }
+
+  if (argc > 1) {
+    script.Init();
+    if (!script.Load(argv[1])) {
+      fprintf(stderr, "Could not read script %s\n", argv[1]);
+      return 1;
+    }
+    uint32_t duration = script.duration() + SAMPLE_RATE;
+    double mean = BenchProcessor(&script, duration, &worst);
+    printf("script %-14s %8.1f %8.1f\n", argv[1], mean, worst);
+  }
+  return 0;
+}
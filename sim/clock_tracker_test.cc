@@ -0,0 +1,111 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Drift test of the clock tracker: feeds it constant periods with a
+// symmetric random jitter, and checks that the tracked period does not
+// drift away from them, as it would with a biased rounding of the
+// smoothing. Also checks that it settles on a period after small tempo
+// changes, up and down.
+//
+// Usage: batumi_clock_test
+// Exits with 1 when a case fails.
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "stmlib/utils/random.h"
+
+#include "clock_tracker.h"
+
+using namespace batumi;
+using namespace stmlib;
+
+const uint32_t kNumTaps = 200000;
+const uint32_t kSeed = 0x21;
+// largest mean error accepted, in 1/32 of a sample
+const double kMaxDrift = 0.25;
+// largest error accepted after a tempo change, with no jitter: the
+// rounded smoothing stops within one unit of the period
+const int32_t kMaxSettlingError = 1;
+
+// in 1/32 of a sample: 100 samples, 1 s, 1 min
+static const uint32_t periods[] = { 3200, 32 * 16384, 32 * 16384 * 60 };
+static const int32_t jitters[] = { 0, 1, 2, 5, 16, 64 };
+
+static ClockTracker clock_tracker;
+
+// mean difference between the period and the intervals tapped, over the
+// second half of the taps
+static double Drift(uint32_t period, int32_t jitter) {
+  Random::Seed(kSeed);
+  clock_tracker.Init();
+  double sum = 0.0;
+  for (uint32_t t=0; t<kNumTaps; t++) {
+    int32_t noise = jitter
+      ? static_cast<int32_t>((Random::GetWord() >> 8) % (2 * jitter + 1)) -
+      jitter
+      : 0;
+    clock_tracker.Tap(period + noise);
+    clock_tracker.Update();
+    if (t >= kNumTaps / 2)
+      sum += static_cast<double>(clock_tracker.period()) - period - noise;
+  }
+  return sum / (kNumTaps - kNumTaps / 2);
+}
+
+// error of the period after it moved from period by a small ratio
+static int32_t SettlingError(uint32_t period, int32_t per_mille) {
+  clock_tracker.Init();
+  uint32_t target = period + static_cast<int64_t>(period) * per_mille / 1000;
+  for (uint32_t t=0; t<kNumTaps; t++) {
+    clock_tracker.Tap(t < kNumTaps / 2 ? period : target);
+    clock_tracker.Update();
+  }
+  return clock_tracker.period() - target;
+}
+
+int main(int argc, char** argv) {
+  uint32_t num_failures = 0;
+  for (size_t i=0; i<sizeof(periods) / sizeof(periods[0]); i++) {
+    for (size_t j=0; j<sizeof(jitters) / sizeof(jitters[0]); j++) {
+      double drift = Drift(periods[i], jitters[j]);
+      bool ok = drift <= kMaxDrift && drift >= -kMaxDrift;
+      printf("period %9u jitter %3d drift %7.3f %s\n", periods[i],
+             jitters[j], drift, ok ? "ok" : "FAIL");
+      if (!ok)
+        ++num_failures;
+    }
+    for (int32_t per_mille=-50; per_mille<=50; per_mille+=100) {
+      int32_t error = SettlingError(periods[i], per_mille);
+      bool ok = error <= kMaxSettlingError && error >= -kMaxSettlingError;
+      printf("period %9u tempo %+4d/1000 error %4d %s\n", periods[i],
+             per_mille, error, ok ? "ok" : "FAIL");
+      if (!ok)
+        ++num_failures;
+    }
+  }
+  return num_failures ? 1 : 0;
+}
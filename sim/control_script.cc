@@ -0,0 +1,152 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Scripted control sequences for the host simulation.
+
+#include "sim/control_script.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace batumi {
+
+using namespace std;
+
+ControlState control_state;
+uint16_t dac_output[8];
+
+static const char* control_names[CONTROL_ID_LAST] = {
+  "mode", "sync", "shape", "bank", "random", "waveform",
+  "coarse", "fine", "level", "atten", "phase", "cv", "reset", "saving"
+};
+
+void ControlState::Init() {
+  feat_mode = FEAT_MODE_FREE;
+  sync = false;
+  shape = 0;
+  saving = false;
+  for (uint8_t i=0; i<kNumSimChannels; i++) {
+    bank[i] = BANK_CLASSIC;
+    random_waveform[i] = 0;
+    waveform[i] = -1;
+    coarse[i] = UINT16_MAX / 2;
+    fine[i] = UINT16_MAX / 2;
+    level[i] = UINT16_MAX;
+    atten[i] = UINT16_MAX;
+    phase[i] = UINT16_MAX;
+    cv[i] = 0;
+    reset[i] = 0;
+  }
+}
+
+void ControlState::Set(ControlId id, uint8_t channel, int32_t value) {
+  if (channel >= kNumSimChannels) {
+    return;
+  }
+  switch (id) {
+  case CONTROL_ID_MODE: feat_mode = static_cast<FeatureMode>(value); break;
+  case CONTROL_ID_SYNC: sync = value; break;
+  case CONTROL_ID_SHAPE: shape = value & 3; break;
+  case CONTROL_ID_BANK: bank[channel] = static_cast<WaveBank>(value); break;
+  case CONTROL_ID_RANDOM: random_waveform[channel] = value & 3; break;
+  case CONTROL_ID_WAVEFORM: waveform[channel] = value; break;
+  case CONTROL_ID_COARSE: coarse[channel] = value; break;
+  case CONTROL_ID_FINE: fine[channel] = value; break;
+  case CONTROL_ID_LEVEL: level[channel] = value; break;
+  case CONTROL_ID_ATTEN: atten[channel] = value; break;
+  case CONTROL_ID_PHASE: phase[channel] = value; break;
+  case CONTROL_ID_CV: cv[channel] = value; break;
+  case CONTROL_ID_RESET: reset[channel] = value; break;
+  case CONTROL_ID_SAVING: saving = value; break;
+  case CONTROL_ID_LAST: break;
+  }
+}
+
+void ControlScript::Init() {
+  events_.clear();
+  position_ = 0;
+}
+
+bool ControlScript::Load(const char* file_name) {
+  FILE* fp = fopen(file_name, "r");
+  if (!fp) {
+    return false;
+  }
+  char line[128];
+  bool ok = true;
+  while (fgets(line, sizeof(line), fp)) {
+    if (line[0] == '#' || line[0] == '\n') {
+      continue;
+    }
+    unsigned long time;
+    char name[16];
+    int channel;
+    long value;
+    if (sscanf(line, "%lu %15s %d %ld", &time, name, &channel, &value) != 4) {
+      ok = false;
+      break;
+    }
+    int id = 0;
+    while (id < CONTROL_ID_LAST && strcmp(name, control_names[id])) {
+      ++id;
+    }
+    if (id == CONTROL_ID_LAST) {
+      ok = false;
+      break;
+    }
+    Add(time, static_cast<ControlId>(id), channel, value);
+  }
+  fclose(fp);
+  return ok;
+}
+
+void ControlScript::Add(
+    uint32_t time,
+    ControlId id,
+    uint8_t channel,
+    int32_t value) {
+  ControlEvent e;
+  e.time = time;
+  e.id = id;
+  e.channel = channel;
+  e.value = value;
+  events_.push_back(e);
+}
+
+void ControlScript::AddPulse(uint32_t time, uint8_t channel, uint32_t width) {
+  Add(time, CONTROL_ID_RESET, channel, INT16_MAX);
+  Add(time + width, CONTROL_ID_RESET, channel, 0);
+}
+
+void ControlScript::Apply(uint32_t time, ControlState* state) {
+  while (position_ < events_.size() && events_[position_].time <= time) {
+    const ControlEvent& e = events_[position_];
+    state->Set(e.id, e.channel, e.value);
+    ++position_;
+  }
+}
+
+}  // namespace batumi
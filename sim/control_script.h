@@ -0,0 +1,132 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Scripted control sequences for the host simulation.
+//
+// A script is a text file with one event per line:
+//
+//   <sample> <control> <channel> <value>
+//
+// where control is one of: mode, sync, shape, bank, random, waveform,
+// coarse, fine, level, atten, phase, cv, reset, saving. Lines starting with '#'
+// are ignored. Events must be sorted by time.
+
+#ifndef BATUMI_SIM_CONTROL_SCRIPT_H_
+#define BATUMI_SIM_CONTROL_SCRIPT_H_
+
+#include "stmlib/stmlib.h"
+
+#include <vector>
+
+#include "ui.h"
+
+namespace batumi {
+
+const uint8_t kNumSimChannels = 4;
+
+enum ControlId {
+  CONTROL_ID_MODE,
+  CONTROL_ID_SYNC,
+  CONTROL_ID_SHAPE,
+  CONTROL_ID_BANK,
+  CONTROL_ID_RANDOM,
+  CONTROL_ID_WAVEFORM,
+  CONTROL_ID_COARSE,
+  CONTROL_ID_FINE,
+  CONTROL_ID_LEVEL,
+  CONTROL_ID_ATTEN,
+  CONTROL_ID_PHASE,
+  CONTROL_ID_CV,
+  CONTROL_ID_RESET,
+  CONTROL_ID_SAVING,
+  CONTROL_ID_LAST
+};
+
+// State of the panel and of the inputs, as seen by the stubbed drivers.
+struct ControlState {
+  FeatureMode feat_mode;
+  bool sync;
+  uint8_t shape;
+  WaveBank bank[kNumSimChannels];
+  uint8_t random_waveform[kNumSimChannels];
+  int8_t waveform[kNumSimChannels];
+  uint16_t coarse[kNumSimChannels];
+  uint16_t fine[kNumSimChannels];
+  uint16_t level[kNumSimChannels];
+  uint16_t atten[kNumSimChannels];
+  uint16_t phase[kNumSimChannels];
+  int16_t cv[kNumSimChannels];
+  int16_t reset[kNumSimChannels];
+  // a flash write in progress
+  bool saving;
+
+  void Init();
+  void Set(ControlId id, uint8_t channel, int32_t value);
+};
+
+struct ControlEvent {
+  uint32_t time;
+  ControlId id;
+  uint8_t channel;
+  int32_t value;
+};
+
+class ControlScript {
+ public:
+  ControlScript() { }
+  ~ControlScript() { }
+
+  void Init();
+  bool Load(const char* file_name);
+  void Add(uint32_t time, ControlId id, uint8_t channel, int32_t value);
+
+  // Adds a reset/sync pulse of the given width (in samples).
+  void AddPulse(uint32_t time, uint8_t channel, uint32_t width);
+
+  // Applies all the events due at or before the given sample.
+  void Apply(uint32_t time, ControlState* state);
+
+  inline void Rewind() { position_ = 0; }
+  inline uint32_t duration() const {
+    return events_.empty() ? 0 : events_.back().time;
+  }
+
+ private:
+  std::vector<ControlEvent> events_;
+  size_t position_;
+
+  DISALLOW_COPY_AND_ASSIGN(ControlScript);
+};
+
+// Shared between the scripts and the stubbed Adc, Switches and Ui.
+extern ControlState control_state;
+
+// Last frame sent to the stubbed Dac, in PWM units.
+extern uint16_t dac_output[8];
+
+}  // namespace batumi
+
+#endif  // BATUMI_SIM_CONTROL_SCRIPT_H_
@@ -0,0 +1,531 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Golden-output regression tool: renders the 8 DAC outputs of the
+// processor for a set of scenarios, and checks them against the checksums
+// of reference renders, or records them and compares them with recorded
+// renders.
+//
+// Usage: batumi_regress <command> <path> [options] [script...]
+//   sums <file>     writes the checksums of the renders to file
+//   verify <file>   compares the renders with the checksums of file
+//   record <dir>    writes the renders to dir
+//   check <dir>     compares the renders with those of dir
+//   -t <tolerance>  largest difference accepted by check, in DAC units
+//                   (default 0: bit-exact)
+//   -d <seconds>    duration of the built-in scenarios (default 1)
+//
+// The built-in scenarios cover every feature mode and wave bank, with
+// sync off and on, and quad mode below and above unity gain. Each script
+// given is an extra scenario, named after its file and rendered for its
+// duration plus one second. Renders are 8-channel WAV files at the
+// sample rate, holding the PWM values scaled to 16 bits; the scenarios
+// that last minutes only keep one sample in kSlowDecimation. The
+// checksums are FNV-1a hashes of the samples of the renders, one line per
+// scenario; those of sim/golden_checksums.txt are of the built-in
+// scenarios at the default duration.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "sim/control_script.h"
+#include "sim/simulator.h"
+
+using namespace batumi;
+using namespace std;
+
+const uint32_t kSeed = 0x21;
+const uint8_t kPwmShift = 16 - kPwmResolution;
+const uint32_t kWavHeaderSize = 44;
+// steps of the sweeps of the built-in scenarios, whatever their duration
+const uint32_t kNumSteps = 64;
+const uint32_t kSlowDecimation = 1024;
+const uint32_t kFnvOffset = 2166136261UL;
+const uint32_t kFnvPrime = 16777619UL;
+
+static const char* feat_mode_names[FEAT_MODE_LAST] = {
+  "free", "quad", "phase", "divide"
+};
+
+static const char* bank_names[BANK_LAST] = {
+  "classic", "random"
+};
+
+struct Scenario {
+  string name;
+  ControlScript* script;
+  uint32_t duration;
+  uint32_t decimation;
+};
+
+static Simulator simulator;
+
+// Sweeps every control the processor reads: shapes, CVs, pots, and
+// trains of resets at different rates on every channel. The coarse pots
+// go back and forth over their whole range, so that the pitch of the
+// followers of the linked modes, and of the random bank, moves too.
+static void MakeScript(
+    FeatureMode mode,
+    WaveBank bank,
+    bool sync,
+    uint16_t level,
+    uint32_t duration,
+    ControlScript* script) {
+  script->Init();
+  script->Add(0, CONTROL_ID_MODE, 0, mode);
+  script->Add(0, CONTROL_ID_SYNC, 0, sync);
+  for (uint8_t i=0; i<kNumSimChannels; i++) {
+    script->Add(0, CONTROL_ID_BANK, i, bank);
+    script->Add(0, CONTROL_ID_RANDOM, i, i);
+    script->Add(0, CONTROL_ID_COARSE, i, 24000 + 9000 * i);
+    script->Add(0, CONTROL_ID_LEVEL, i, level);
+  }
+  const uint32_t step = duration / kNumSteps;
+  for (uint32_t n=1; n<kNumSteps; n++) {
+    uint32_t t = n * step;
+    if (n % 8 == 0) {
+      script->Add(t, CONTROL_ID_SHAPE, 0, n / 8);
+    }
+    for (uint8_t i=0; i<kNumSimChannels; i++) {
+      uint32_t coarse = (n * 4096 + i * 16384) & 0x1ffff;
+      script->Add(t, CONTROL_ID_COARSE, i,
+                  coarse < 0x10000 ? coarse : 0x1ffff - coarse);
+      int32_t cv = (n * 1500 + i * 8192) % 32768 - 16384;
+      script->Add(t, CONTROL_ID_CV, i, cv);
+      script->Add(t, CONTROL_ID_FINE, i, (n * 4096 + i * 16384) & 0xffff);
+      script->Add(t, CONTROL_ID_PHASE, i, (n * 2048 * (i + 1)) & 0xffff);
+      script->Add(t, CONTROL_ID_ATTEN, i, UINT16_MAX - (n * 1024 & 0x7fff));
+      if (n % (i + 2) == 0) {
+        script->AddPulse(t + i * 37, i, 16);
+      }
+    }
+  }
+}
+
+// times of the second sync edge of each channel, in seconds: the
+// periods between the edges outgrow 2^27 1/32 of a sample, with remainders
+// of 2^32 / period that do too
+static const uint16_t slow_sync_times[kNumSimChannels] = {
+  284, 306, 331, 360
+};
+
+// Sync clocks minutes apart, slower on each channel.
+static void MakeSlowScript(ControlScript* script) {
+  script->Init();
+  script->Add(0, CONTROL_ID_MODE, 0, FEAT_MODE_FREE);
+  script->Add(0, CONTROL_ID_SYNC, 0, true);
+  for (uint8_t i=0; i<kNumSimChannels; i++) {
+    script->Add(0, CONTROL_ID_BANK, i, BANK_CLASSIC);
+    script->Add(0, CONTROL_ID_COARSE, i, 0);
+    script->Add(0, CONTROL_ID_LEVEL, i, UINT16_MAX);
+    script->Add(0, CONTROL_ID_ATTEN, i, UINT16_MAX);
+  }
+  for (uint8_t i=0; i<kNumSimChannels; i++) {
+    script->AddPulse(SAMPLE_RATE, i, 16);
+    script->AddPulse(slow_sync_times[i] * SAMPLE_RATE, i, 16);
+  }
+}
+
+// Resets during two flash writes of 20 ms: pulses that end before the
+// write does, and pulses held past its end. A reset before, with no
+// write, for comparison.
+static void MakeSaveScript(FeatureMode mode, ControlScript* script) {
+  const uint32_t write_length = SAMPLE_RATE / 50;
+  const uint32_t writes[2] = { SAMPLE_RATE / 2, SAMPLE_RATE * 3 / 4 };
+  script->Init();
+  script->Add(0, CONTROL_ID_MODE, 0, mode);
+  script->Add(0, CONTROL_ID_SYNC, 0, false);
+  for (uint8_t i=0; i<kNumSimChannels; i++) {
+    script->Add(0, CONTROL_ID_BANK, i, BANK_CLASSIC);
+    script->Add(0, CONTROL_ID_COARSE, i, 24000 + 9000 * i);
+    script->Add(0, CONTROL_ID_LEVEL, i, UINT16_MAX);
+    script->Add(0, CONTROL_ID_ATTEN, i, UINT16_MAX);
+    script->AddPulse(SAMPLE_RATE / 4 + i * 37, i, 16);
+  }
+  // in the order of their times
+  script->Add(writes[0], CONTROL_ID_SAVING, 0, true);
+  for (uint8_t i=0; i<kNumSimChannels; i++) {
+    script->AddPulse(writes[0] + 40 + i * 64, i, 16);
+  }
+  script->Add(writes[0] + write_length, CONTROL_ID_SAVING, 0, false);
+  script->Add(writes[1], CONTROL_ID_SAVING, 0, true);
+  for (uint8_t i=0; i<kNumSimChannels; i++) {
+    script->Add(writes[1] + 200 + i * 37, CONTROL_ID_RESET, i, INT16_MAX);
+  }
+  script->Add(writes[1] + write_length, CONTROL_ID_SAVING, 0, false);
+  for (uint8_t i=0; i<kNumSimChannels; i++) {
+    script->Add(writes[1] + 500 + i * 37, CONTROL_ID_RESET, i, 0);
+  }
+}
+
+static string FileName(const char* dir, const string& name) {
+  return string(dir) + "/" + name + ".wav";
+}
+
+static void WriteLe(FILE* fp, uint32_t value, uint8_t size) {
+  for (uint8_t i=0; i<size; i++) {
+    fputc((value >> (8 * i)) & 0xff, fp);
+  }
+}
+
+static void WriteWavHeader(FILE* fp, uint32_t num_frames,
+                           uint32_t sample_rate) {
+  uint32_t data_size = num_frames * kNumDacChannels * 2;
+  fwrite("RIFF", 1, 4, fp);
+  WriteLe(fp, kWavHeaderSize - 8 + data_size, 4);
+  fwrite("WAVEfmt ", 1, 8, fp);
+  WriteLe(fp, 16, 4);
+  WriteLe(fp, 1, 2);  // PCM
+  WriteLe(fp, kNumDacChannels, 2);
+  WriteLe(fp, sample_rate, 4);
+  WriteLe(fp, sample_rate * kNumDacChannels * 2, 4);
+  WriteLe(fp, kNumDacChannels * 2, 2);
+  WriteLe(fp, 16, 2);
+  fwrite("data", 1, 4, fp);
+  WriteLe(fp, data_size, 4);
+}
+
+static uint32_t NumFrames(const Scenario& scenario) {
+  return scenario.duration / scenario.decimation;
+}
+
+// Renders a scenario, as PWM values scaled to the signed 16-bit range.
+static void Render(const Scenario& scenario, vector<int16_t>* frames) {
+  frames->resize(NumFrames(scenario) * kNumDacChannels);
+  simulator.Init(scenario.script, kSeed);
+  int16_t* frame = &(*frames)[0];
+  for (uint32_t t=0; t<NumFrames(scenario) * scenario.decimation; t++) {
+    simulator.Process();
+    if (t % scenario.decimation) {
+      continue;
+    }
+    for (uint8_t i=0; i<kNumDacChannels; i++) {
+      *frame++ = static_cast<int16_t>((dac_output[i] << kPwmShift) - 32768);
+    }
+  }
+}
+
+static bool Record(const char* dir, const Scenario& scenario) {
+  vector<int16_t> frames;
+  Render(scenario, &frames);
+  string file_name = FileName(dir, scenario.name);
+  FILE* fp = fopen(file_name.c_str(), "wb");
+  if (!fp) {
+    fprintf(stderr, "Could not write %s\n", file_name.c_str());
+    return false;
+  }
+  WriteWavHeader(fp, NumFrames(scenario),
+                 SAMPLE_RATE / scenario.decimation);
+  for (size_t i=0; i<frames.size(); i++) {
+    WriteLe(fp, static_cast<uint16_t>(frames[i]), 2);
+  }
+  fclose(fp);
+  printf("%-24s recorded\n", scenario.name.c_str());
+  return true;
+}
+
+static bool Check(const char* dir, const Scenario& scenario,
+                  uint16_t tolerance) {
+  string file_name = FileName(dir, scenario.name);
+  FILE* fp = fopen(file_name.c_str(), "rb");
+  if (!fp) {
+    printf("%-24s MISSING %s\n", scenario.name.c_str(), file_name.c_str());
+    return false;
+  }
+  vector<int16_t> golden(NumFrames(scenario) * kNumDacChannels);
+  // the renders are little-endian, like the hosts we run on
+  fseek(fp, kWavHeaderSize, SEEK_SET);
+  size_t size = fread(&golden[0], 2, golden.size(), fp);
+  fclose(fp);
+  if (size != golden.size()) {
+    printf("%-24s LENGTH %u samples, expected %u\n", scenario.name.c_str(),
+           static_cast<unsigned>(size / kNumDacChannels),
+           static_cast<unsigned>(NumFrames(scenario)));
+    return false;
+  }
+
+  vector<int16_t> frames;
+  Render(scenario, &frames);
+  uint32_t num_differences = 0;
+  uint32_t max_difference = 0;
+  size_t first = 0;
+  for (size_t i=0; i<frames.size(); i++) {
+    int32_t a = (frames[i] + 32768) >> kPwmShift;
+    int32_t b = (golden[i] + 32768) >> kPwmShift;
+    uint32_t difference = abs(a - b);
+    if (difference > tolerance) {
+      if (num_differences++ == 0) {
+        first = i;
+      }
+    }
+    if (difference > max_difference) {
+      max_difference = difference;
+    }
+  }
+  if (num_differences) {
+    printf("%-24s FAIL %u samples off by up to %u, first at %u (output %u)\n",
+           scenario.name.c_str(), num_differences, max_difference,
+           static_cast<unsigned>(first / kNumDacChannels *
+                                 scenario.decimation),
+           static_cast<unsigned>(first % kNumDacChannels));
+    return false;
+  }
+  printf("%-24s ok (max difference %u)\n", scenario.name.c_str(),
+         max_difference);
+  return true;
+}
+
+static uint32_t Checksum(const vector<int16_t>& frames) {
+  uint32_t hash = kFnvOffset;
+  for (size_t i=0; i<frames.size(); i++) {
+    uint16_t sample = frames[i];
+    hash = (hash ^ (sample & 0xff)) * kFnvPrime;
+    hash = (hash ^ (sample >> 8)) * kFnvPrime;
+  }
+  return hash;
+}
+
+static bool WriteChecksums(const char* file_name,
+                           const vector<Scenario>& scenarios) {
+  FILE* fp = fopen(file_name, "w");
+  if (!fp) {
+    fprintf(stderr, "Could not write %s\n", file_name);
+    return false;
+  }
+  fprintf(fp, "# Checksums of the renders of batumi_regress: scenario, "
+          "frames, FNV-1a\n");
+  for (size_t i=0; i<scenarios.size(); i++) {
+    vector<int16_t> frames;
+    Render(scenarios[i], &frames);
+    fprintf(fp, "%s %u %08x\n", scenarios[i].name.c_str(),
+            static_cast<unsigned>(NumFrames(scenarios[i])), Checksum(frames));
+    printf("%-24s recorded\n", scenarios[i].name.c_str());
+  }
+  fclose(fp);
+  return true;
+}
+
+struct Checksums {
+  vector<string> names;
+  vector<uint32_t> num_frames;
+  vector<uint32_t> checksums;
+};
+
+static bool ReadChecksums(const char* file_name, Checksums* checksums) {
+  FILE* fp = fopen(file_name, "r");
+  if (!fp) {
+    return false;
+  }
+  char line[128];
+  while (fgets(line, sizeof(line), fp)) {
+    if (line[0] == '#' || line[0] == '\n') {
+      continue;
+    }
+    char name[64];
+    unsigned num_frames, checksum;
+    if (sscanf(line, "%63s %u %x", name, &num_frames, &checksum) == 3) {
+      checksums->names.push_back(name);
+      checksums->num_frames.push_back(num_frames);
+      checksums->checksums.push_back(checksum);
+    }
+  }
+  fclose(fp);
+  return true;
+}
+
+static bool Verify(const Checksums& checksums, const Scenario& scenario) {
+  size_t i = 0;
+  while (i < checksums.names.size() && checksums.names[i] != scenario.name) {
+    ++i;
+  }
+  if (i == checksums.names.size()) {
+    printf("%-24s MISSING checksum\n", scenario.name.c_str());
+    return false;
+  }
+  if (checksums.num_frames[i] != NumFrames(scenario)) {
+    printf("%-24s LENGTH %u samples, expected %u\n", scenario.name.c_str(),
+           static_cast<unsigned>(NumFrames(scenario)),
+           static_cast<unsigned>(checksums.num_frames[i]));
+    return false;
+  }
+  vector<int16_t> frames;
+  Render(scenario, &frames);
+  uint32_t checksum = Checksum(frames);
+  if (checksum != checksums.checksums[i]) {
+    printf("%-24s FAIL checksum %08x, expected %08x\n",
+           scenario.name.c_str(), checksum, checksums.checksums[i]);
+    return false;
+  }
+  printf("%-24s ok\n", scenario.name.c_str());
+  return true;
+}
+
+static void Usage() {
+  fprintf(stderr, "Usage: batumi_regress sums|verify <checksums file> "
+          "[-d seconds] [script...]\n"
+          "       batumi_regress record|check <golden dir> "
+          "[-t tolerance] [-d seconds] [script...]\n");
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    Usage();
+    return 2;
+  }
+  bool sums = !strcmp(argv[1], "sums");
+  bool verify = !strcmp(argv[1], "verify");
+  bool record = !strcmp(argv[1], "record");
+  if (!sums && !verify && !record && strcmp(argv[1], "check")) {
+    Usage();
+    return 2;
+  }
+  const char* dir = argv[2];
+  uint16_t tolerance = 0;
+  uint32_t duration = SAMPLE_RATE;
+  vector<const char*> script_names;
+  for (int i=3; i<argc; i++) {
+    if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+      tolerance = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-d") && i + 1 < argc) {
+      duration = atof(argv[++i]) * SAMPLE_RATE;
+    } else {
+      script_names.push_back(argv[i]);
+    }
+  }
+
+  vector<Scenario> scenarios;
+  for (int mode=0; mode<FEAT_MODE_LAST; mode++) {
+    for (int bank=0; bank<BANK_LAST; bank++) {
+      for (int sync=0; sync<2; sync++) {
+        Scenario s;
+        s.name = string(feat_mode_names[mode]) + "_" + bank_names[bank]
+          + (sync ? "_sync" : "");
+        s.script = new ControlScript;
+        s.duration = duration;
+        s.decimation = 1;
+        MakeScript(static_cast<FeatureMode>(mode), static_cast<WaveBank>(bank),
+                   sync, UINT16_MAX, duration, s.script);
+        scenarios.push_back(s);
+      }
+    }
+  }
+  // in quad mode, the sum is normalized once the levels add up to more
+  // than unity gain
+  Scenario quad;
+  quad.name = "quad_low_level";
+  quad.script = new ControlScript;
+  quad.duration = duration;
+  quad.decimation = 1;
+  MakeScript(FEAT_MODE_QUAD, BANK_CLASSIC, false, UINT16_MAX / 5, duration,
+             quad.script);
+  scenarios.push_back(quad);
+  // minutes-long periods, of the rarely exercised ranges of the timings
+  Scenario slow;
+  slow.name = "slow_sync";
+  slow.script = new ControlScript;
+  slow.duration = 420 * SAMPLE_RATE;
+  slow.decimation = kSlowDecimation;
+  MakeSlowScript(slow.script);
+  scenarios.push_back(slow);
+  // resets during the writes of the settings
+  const FeatureMode save_modes[2] = { FEAT_MODE_FREE, FEAT_MODE_DIVIDE };
+  for (uint8_t i=0; i<2; i++) {
+    Scenario s;
+    s.name = string(feat_mode_names[save_modes[i]]) + "_save_reset";
+    s.script = new ControlScript;
+    s.duration = SAMPLE_RATE;
+    s.decimation = 1;
+    MakeSaveScript(save_modes[i], s.script);
+    scenarios.push_back(s);
+  }
+
+  for (size_t i=0; i<script_names.size(); i++) {
+    Scenario s;
+    string name = script_names[i];
+    size_t slash = name.find_last_of('/');
+    if (slash != string::npos) {
+      name = name.substr(slash + 1);
+    }
+    s.name = name.substr(0, name.find_last_of('.'));
+    s.script = new ControlScript;
+    s.script->Init();
+    if (!s.script->Load(script_names[i])) {
+      fprintf(stderr, "Could not read script %s\n", script_names[i]);
+      return 2;
+    }
+    s.duration = s.script->duration() + SAMPLE_RATE;
+    s.decimation = 1;
+    scenarios.push_back(s);
+  }
+
+  uint32_t num_failures = 0;
+  if (sums) {
+    if (!WriteChecksums(dir, scenarios)) {
+      ++num_failures;
+    }
+  } else if (verify) {
+    Checksums checksums;
+    if (!ReadChecksums(dir, &checksums)) {
+      fprintf(stderr, "Could not read the checksums %s\n", dir);
+      return 2;
+    }
+    for (size_t i=0; i<scenarios.size(); i++) {
+      if (!Verify(checksums, scenarios[i])) {
+        ++num_failures;
+      }
+    }
+  } else {
+    if (!record) {
+      // a check against nothing would only report MISSING scenarios
+      FILE* fp = fopen(FileName(dir, scenarios[0].name).c_str(), "rb");
+      if (!fp) {
+        fprintf(stderr, "No golden renders in %s: record them with "
+                "make regress_record at a reference revision\n", dir);
+        return 2;
+      }
+      fclose(fp);
+    }
+    for (size_t i=0; i<scenarios.size(); i++) {
+      bool ok = record
+        ? Record(dir, scenarios[i])
+        : Check(dir, scenarios[i], tolerance);
+      if (!ok) {
+        ++num_failures;
+      }
+    }
+  }
+  for (size_t i=0; i<scenarios.size(); i++) {
+    delete scenarios[i].script;
+  }
+  if (verify || !(sums || record)) {
+    printf("%u of %u scenarios differ\n", num_failures,
+           static_cast<unsigned>(scenarios.size()));
+  }
+  return num_failures ? 1 : 0;
+}
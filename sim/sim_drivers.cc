@@ -0,0 +1,139 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Host implementations of the hardware drivers and of the UI, driven by
+// the scripted control state.
+
+#include "drivers/adc.h"
+#include "drivers/dac.h"
+#include "drivers/leds.h"
+#include "drivers/settings_storage.h"
+#include "drivers/switches.h"
+#include "sim/control_script.h"
+#include "ui.h"
+
+namespace batumi {
+
+void Adc::Init() {
+  for (index_=0; index_<kNumAdcChannels; index_++) {
+    sequence_[index_] = 0;
+    age_[index_] = 0;
+  }
+  // read all current values
+  for (uint8_t i=0; i<kNumAdcChannels; i++) {
+    Scan();
+  }
+}
+
+void Adc::Scan() {
+  // like the hardware, one mux channel is read per sample
+  index_ = (index_ + 1) % kNumAdcChannels;
+  uint8_t channel = index_ % kNumSimChannels;
+  if (index_ < kNumSimChannels) {
+    values1_[index_] = control_state.cv[channel];
+    values2_[index_] = control_state.coarse[channel] - 32768;
+  } else {
+    values1_[index_] = control_state.reset[channel];
+  }
+  values2_[ADC_TACT_SWITCH - 8] = INT16_MIN;
+  ++sequence_[index_];
+}
+
+void Dac::Init() {
+  for (int i=0; i<kNumDacChannels; i++) {
+    value_[i] = UINT16_MAX;
+#ifdef DAC_DITHER
+    error_[i] = 0;
+#endif
+  }
+  Write();
+}
+
+void Dac::Write() {
+  for (int i=0; i<kNumDacChannels; i++)
+    dac_output[i] = value_[i];
+}
+
+void Leds::Init() {
+  for (int i=0; i<kNumLeds; i++)
+    values_[i] = 0;
+}
+
+void Leds::Write() { }
+
+void Switches::Init(Adc *adc) {
+  adc_ = adc;
+  Debounce();
+}
+
+void Switches::Debounce() {
+  // switches are active low, and debounced switches read 0x00 when held
+  switch_state_[SWITCH_SYNC] = control_state.sync ? 0x00 : 0xff;
+  switch_state_[SWITCH_WAV1] = control_state.shape & 1 ? 0x00 : 0xff;
+  switch_state_[SWITCH_WAV2] = control_state.shape & 2 ? 0x00 : 0xff;
+  switch_state_[SWITCH_SELECT] = 0xff;
+}
+
+void Ui::Init(Adc *adc) {
+  adc_ = adc;
+  leds_.Init();
+  switches_.Init(adc_);
+  animation_counter_ = 0;
+  fast_start_ = false;
+  settings_storage_.Poll();
+  Poll();
+}
+
+void Ui::Poll() {
+  switches_.Debounce();
+  mode_ = UI_MODE_NORMAL;
+  feat_mode_ = control_state.feat_mode;
+  for (uint8_t i=0; i<kNumSimChannels; i++) {
+    pot_value_[i] = pot_filtered_value_[i] = pot_coarse_value_[i] =
+      adc_->pot(i);
+    pot_fine_value_[i] = control_state.fine[i];
+    pot_level_value_[i] = control_state.level[i];
+    pot_atten_value_[i] = control_state.atten[i];
+    pot_phase_value_[i] = control_state.phase[i];
+    bank_[i] = control_state.bank[i];
+    random_waveform_index_[i] = control_state.random_waveform[i];
+    classic_waveform_index_[i] = control_state.waveform[i];
+    catchup_state_[i] = false;
+  }
+}
+
+// the flash writes are scripted: the storage is busy while the saving
+// control is set
+bool SettingsStorage::Poll() {
+  busy_ = control_state.saving;
+  return false;
+}
+
+bool Ui::DoEvents() { return settings_storage_.Poll(); }
+
+void Ui::FlushEvents() { }
+
+}  // namespace batumi
@@ -0,0 +1,75 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Host simulation of the module.
+
+#include "sim/simulator.h"
+
+#include "stmlib/utils/random.h"
+
+namespace batumi {
+
+using namespace stmlib;
+
+void Simulator::Init(ControlScript* script, uint32_t seed) {
+  script_ = script;
+  script_->Rewind();
+  time_ = 0;
+  ui_counter_ = 0;
+
+  control_state.Init();
+  script_->Apply(0, &control_state);
+
+  adc_.Init();
+  ui_.Init(&adc_);
+  dac_.Init();
+  tracer_.Init();
+  processor_.Init(&ui_, &adc_, &dac_, &tracer_);
+  Random::Seed(seed);
+}
+
+void Simulator::ProcessControls() {
+  script_->Apply(time_, &control_state);
+
+  // SysTick runs at 1kHz
+  ui_counter_ += 1000;
+  if (ui_counter_ >= SAMPLE_RATE) {
+    ui_counter_ -= SAMPLE_RATE;
+    ui_.Poll();
+    // the main loop runs once per SysTick
+    ui_.DoEvents();
+    tracer_.Drain();
+  }
+}
+
+void Simulator::ProcessAudio() {
+  adc_.Scan();
+  processor_.Process();
+  dac_.Write();
+  ++time_;
+}
+
+}  // namespace batumi
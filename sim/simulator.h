@@ -0,0 +1,81 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Host simulation of the module: runs the processor as the audio
+// interrupt would, with the UI polled at the SysTick rate.
+
+#ifndef BATUMI_SIM_SIMULATOR_H_
+#define BATUMI_SIM_SIMULATOR_H_
+
+#include "stmlib/stmlib.h"
+
+#include "drivers/adc.h"
+#include "drivers/dac.h"
+#include "drivers/tracer.h"
+#include "sim/control_script.h"
+#include "processor.h"
+#include "ui.h"
+
+namespace batumi {
+
+class Simulator {
+ public:
+  Simulator() { }
+  ~Simulator() { }
+
+  void Init(ControlScript* script, uint32_t seed);
+
+  // Renders one sample; the frame sent to the DAC is in dac_output.
+  inline void Process() {
+    ProcessControls();
+    ProcessAudio();
+  }
+
+  // The two parts of Process(): the controls of the script, then the UI
+  // and the main loop at the SysTick rate; then what the audio interrupt
+  // does.
+  void ProcessControls();
+  void ProcessAudio();
+
+  inline uint32_t time() const { return time_; }
+
+ private:
+  Adc adc_;
+  Dac dac_;
+  Ui ui_;
+  Tracer tracer_;
+  Processor processor_;
+  ControlScript* script_;
+
+  uint32_t time_;
+  uint32_t ui_counter_;
+
+  DISALLOW_COPY_AND_ASSIGN(Simulator);
+};
+
+}  // namespace batumi
+
+#endif  // BATUMI_SIM_SIMULATOR_H_
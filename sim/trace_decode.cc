@@ -0,0 +1,150 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+//
+// Decoder of the SWO stream of the TRACE build option: reads a capture
+// of the raw ITM packets and writes one CSV line per record.
+//
+// Usage: batumi_trace [capture]
+// Reads the standard input without a capture. Times are in samples, the
+// phase in cycles and the frequency in Hz. Only the 32-bit writes to port
+// kTracePort are read; the decoder resynchronizes on the header word of
+// the records after a loss.
+
+#include <cstdio>
+#include <vector>
+
+#include "drivers/tracer.h"
+
+using namespace batumi;
+using namespace std;
+
+static const char* record_names[TRACE_RECORD_LAST] = {
+  "state", "reset", "sync", "drops"
+};
+
+static inline bool IsHeader(uint32_t word) {
+  return (word >> 24) == kTraceMagic &&
+    ((word >> 20) & 0xf) < TRACE_RECORD_LAST;
+}
+
+static void WriteRecord(const uint32_t* words) {
+  uint32_t time = words[0];
+  TraceRecordType type = static_cast<TraceRecordType>((words[1] >> 20) & 0xf);
+  uint8_t channel = (words[1] >> 16) & 0xf;
+  uint16_t aux = words[1] & 0xffff;
+  printf("%u,%s,%u,", time, record_names[type], channel);
+  switch (type) {
+  case TRACE_RECORD_STATE:
+    printf("%.6f,%.4f,%u,%u,%u,,,,\n",
+           words[2] / 4294967296.0,
+           words[3] / 4294967296.0 * SAMPLE_RATE,
+           aux & 0xff, (aux >> 8) & 0x7f, aux >> 15);
+    break;
+  case TRACE_RECORD_RESET:
+  case TRACE_RECORD_SYNC:
+    printf(",,,,,%.5f,%.5f,", aux / 32.0, words[2] / 32.0);
+    if (type == TRACE_RECORD_SYNC) {
+      printf("%.5f", words[3] / 32.0);
+    }
+    printf(",\n");
+    break;
+  default:
+    printf(",,,,,,,,%u\n", words[2]);
+    break;
+  }
+}
+
+int main(int argc, char** argv) {
+  FILE* fp = stdin;
+  if (argc > 1) {
+    fp = fopen(argv[1], "rb");
+    if (!fp) {
+      fprintf(stderr, "Could not read %s\n", argv[1]);
+      return 2;
+    }
+  }
+
+  printf("time,record,channel,phase,frequency,divider,multiplier,blep,"
+         "delay,interval,period,drops\n");
+  vector<uint32_t> words;
+  uint32_t num_skipped = 0;
+  uint32_t num_overflows = 0;
+  int header;
+  while ((header = fgetc(fp)) != EOF) {
+    int c;
+    if (header == 0x00) {
+      // synchronization: zeros, then 0x80
+      while ((c = fgetc(fp)) == 0x00);
+      if (c != 0x80 && c != EOF) {
+        ungetc(c, fp);
+      }
+      continue;
+    } else if (header == 0x70) {
+      ++num_overflows;
+      continue;
+    } else if ((header & 3) == 0) {
+      // timestamps and extensions, with continuation bytes
+      if (header & 0x80) {
+        while ((c = fgetc(fp)) != EOF && (c & 0x80));
+      }
+      continue;
+    }
+
+    uint8_t size = (header & 3) == 3 ? 4 : (header & 3);
+    uint32_t payload = 0;
+    c = 0;
+    for (uint8_t i=0; i<size && c != EOF; i++) {
+      c = fgetc(fp);
+      payload |= static_cast<uint32_t>(c & 0xff) << (8 * i);
+    }
+    if (c == EOF) {
+      break;
+    }
+    // hardware source packets (DWT), other ports and sizes
+    if ((header & 4) || (header >> 3) != kTracePort || size != 4) {
+      continue;
+    }
+    words.push_back(payload);
+    if (words.size() == kTraceRecordWords) {
+      if (IsHeader(words[1])) {
+        WriteRecord(&words[0]);
+        words.clear();
+      } else {
+        words.erase(words.begin());
+        ++num_skipped;
+      }
+    }
+  }
+  if (fp != stdin) {
+    fclose(fp);
+  }
+  if (num_skipped || num_overflows) {
+    fprintf(stderr, "%u words skipped, %u ITM overflows\n",
+            num_skipped, num_overflows);
+  }
+  return 0;
+}
@@ -53,7 +53,8 @@ const int32_t kPotMoveThresholdOnRandomWaveformSelectMode = 1 << (16 - 5);  // 5
 
 const uint16_t kCatchupThreshold = 1 << 10;
 
-stmlib::Storage<0x8020000, 4> storage;
+// settings saved by earlier firmwares, in the same flash pages
+stmlib::Storage<0x8020000, 4> legacy_storage;
 
 void Ui::Init(Adc *adc) {
   mode_ = UI_MODE_SPLASH;
@@ -61,16 +62,38 @@ void Ui::Init(Adc *adc) {
   leds_.Init();
   switches_.Init(adc_);
   animation_counter_ = 0;
-
-  if (!storage.ParsimoniousLoad(&feat_mode_, SETTINGS_SIZE, &version_token_)) {
+  control_events_.Init();
+
+  // holding the button at power-on enters diagnostics after the splash
+#ifdef PROFILE_ISR
+  diagnostics_requested_ = adc_->value(ADC_TACT_SWITCH) <= 0;
+#else
+  diagnostics_requested_ = false;
+#endif
+  diagnostics_page_ = DIAGNOSTICS_PAGE_LOAD;
+
+  settings_storage_.Init(&feat_mode_, SETTINGS_SIZE);
+  bool loaded = settings_storage_.Load() ||
+    legacy_storage.ParsimoniousLoad(&feat_mode_, SETTINGS_SIZE,
+                                    &version_token_);
+  if (!loaded) {
     feat_mode_ = FEAT_MODE_FREE;
     clearAllHiddenSettings();
   }
 
+  // with settings to start from, the outputs do not wait for the end of
+  // the splash animation, and a press of the button ends it
+#ifdef FAST_BOOT
+  fast_start_ = loaded && !diagnostics_requested_;
+#else
+  fast_start_ = false;
+#endif
+
   // synchronize pots at startup
   for (uint8_t i=0; i<4; i++) {
     uint16_t adc_value = adc_->pot(i);
     pot_value_[i] = pot_filtered_value_[i] = pot_coarse_value_[i] = adc_value;
+    pot_delivered_value_[i] = adc_value;
     catchup_state_[i] = false;
   }
 }
@@ -82,7 +105,7 @@ void Ui::Poll() {
   // which are polled manually
   for (uint8_t i = SWITCH_SELECT; i < kNumSwitches; ++i) {
     if (switches_.just_pressed(i)) {
-      queue_.AddEvent(CONTROL_SWITCH, i, 0);
+      control_events_.PostEdge(CONTROL_SWITCH, i, 0);
       press_time_[i] = system_clock.milliseconds();
       detect_very_long_press_[i] = false;
       detect_clear_settings_long_press_[i] = false;
@@ -93,19 +116,19 @@ void Ui::Poll() {
       if (!detect_clear_settings_long_press_[i]) {
         if (!detect_very_long_press_[i]) {
           if (pressed_time > kLongPressDuration) {
-            queue_.AddEvent(CONTROL_SWITCH, i, pressed_time);
+            control_events_.PostEdge(CONTROL_SWITCH, i, pressed_time);
             detect_very_long_press_[i] = true;
           }
         } else {
           if (pressed_time > kVeryLongPressDuration) {
-            queue_.AddEvent(CONTROL_SWITCH, i, pressed_time);
+            control_events_.PostEdge(CONTROL_SWITCH, i, pressed_time);
             detect_very_long_press_[i] = false;
             detect_clear_settings_long_press_[i] = true;
           }
         }
       } else {
         if (pressed_time > kClearSettingsLongPressDuration) {
-          queue_.AddEvent(CONTROL_SWITCH, i, pressed_time);
+          control_events_.PostEdge(CONTROL_SWITCH, i, pressed_time);
           detect_very_long_press_[i] = false;
           detect_clear_settings_long_press_[i] = false;
           press_time_[i] = 0;
@@ -117,7 +140,7 @@ void Ui::Poll() {
         press_time_[i] != 0 &&
         !detect_very_long_press_[i] &&
         !detect_clear_settings_long_press_[i]) {
-      queue_.AddEvent(
+      control_events_.PostEdge(
           CONTROL_SWITCH,
           i,
           system_clock.milliseconds() - press_time_[i] + 1);
@@ -142,7 +165,7 @@ void Ui::Poll() {
 
     if (value >= current_value + potMoveThreshold ||
 	value <= current_value - potMoveThreshold) {
-      queue_.AddEvent(CONTROL_POT, i, value);
+      control_events_.Post(kPotSlot + i, CONTROL_POT, i, value);
       pot_value_[i] = value;
     }
   }
@@ -153,8 +176,9 @@ void Ui::Poll() {
     if (animation_counter_ % 64 == 0) {
       for (int i=0; i<kNumLeds; i++)
 	leds_.set(i, ((animation_counter_ / 64) % 4) == i);
-      if (animation_counter_ / 64 > 3)
-	mode_ = UI_MODE_NORMAL;
+      if (animation_counter_ / 64 > 3) {
+	leaveSplash();
+      }
     }
     animation_counter_++;
     break;
@@ -222,31 +246,72 @@ void Ui::Poll() {
       }
     }
     break;
+
+  case UI_MODE_DIAGNOSTICS:
+#ifdef PROFILE_ISR
+    switch (diagnostics_page_) {
+    case DIAGNOSTICS_PAGE_LOAD:
+      {
+	// bar graph of the CPU load, one LED per quarter
+	uint16_t load = profiler_->load();
+	for (uint8_t i=0; i<kNumLeds; i++)
+	  leds_.set(i, load > i * (UINT16_MAX / kNumLeds));
+      }
+      break;
+    case DIAGNOSTICS_PAGE_OVERRUNS:
+      {
+	// number of overruns in binary, saturated
+	uint32_t overruns = profiler_->overruns();
+	if (overruns > 15)
+	  overruns = 15;
+	for (uint8_t i=0; i<kNumLeds; i++)
+	  leds_.set(i, overruns & (1 << i));
+      }
+      break;
+    default:
+      // one LED per task, lit once it went over its budget
+      for (uint8_t i=0; i<kNumLeds; i++)
+	leds_.set(i, i < TASK_LAST &&
+		  scheduler_->overruns(static_cast<TaskId>(i)));
+      break;
+    }
+#endif
+    break;
   }
 
   leds_.Write();
 }
 
 void Ui::FlushEvents() {
-  queue_.Flush();
+  control_events_.Flush();
 }
 
-void Ui::OnSwitchPressed(const Event& e) {
+void Ui::OnSwitchPressed(const TimedEvent& e) {
 }
 
-void Ui::OnSwitchReleased(const Event& e) {
+void Ui::OnSwitchReleased(const TimedEvent& e) {
   switch (e.control_id) {
   case SWITCH_SYNC:
   case SWITCH_WAV1:
   case SWITCH_WAV2:
     break;
   case SWITCH_SELECT:
-    if (e.data > kClearSettingsLongPressDuration) {
+    if (mode_ == UI_MODE_SPLASH && fast_start_) {
+      leaveSplash();
+    } else if (mode_ == UI_MODE_DIAGNOSTICS) {
+      // short press shows the next page, long press leaves
+      if (e.data > kLongPressDuration) {
+	mode_ = UI_MODE_NORMAL;
+      } else {
+	diagnostics_page_ = static_cast<DiagnosticsPage>(
+	    (diagnostics_page_ + 1) % DIAGNOSTICS_PAGE_LAST);
+      }
+    } else if (e.data > kClearSettingsLongPressDuration) {
       // Clear all hidden settings and save to ROM
       clearAllHiddenSettings();
       animation_counter_ = 0;
       mode_ = UI_MODE_SPLASH;
-      storage.ParsimoniousSave(&feat_mode_, SETTINGS_SIZE, &version_token_);
+      settings_storage_.RequestImmediateSave();
     } else if (e.data > kVeryLongPressDuration) {
       if (mode_ != UI_MODE_WAVEBANK_SELECT) {
         mode_ = UI_MODE_SPLASH_FOR_WAVEBANK_SELECT;
@@ -262,6 +327,7 @@ void Ui::OnSwitchReleased(const Event& e) {
       switch (mode_) {
       case UI_MODE_SPLASH:
       case UI_MODE_SPLASH_FOR_WAVEBANK_SELECT:
+      case UI_MODE_DIAGNOSTICS:
 	break;
       case UI_MODE_ZOOM:
       case UI_MODE_WAVEBANK_SELECT:
@@ -272,7 +338,7 @@ void Ui::OnSwitchReleased(const Event& e) {
 	feat_mode_ = static_cast<FeatureMode>((feat_mode_ + 1) % FEAT_MODE_LAST);
 	// reset all alternate values
 	clearZoomSettings();
-	storage.ParsimoniousSave(&feat_mode_, SETTINGS_SIZE, &version_token_);
+	settings_storage_.RequestSave();
 	break;
       }
     }
@@ -280,9 +346,13 @@ void Ui::OnSwitchReleased(const Event& e) {
   }
 }
 
-void Ui::OnPotChanged(const Event& e) {
+void Ui::OnPotChanged(const TimedEvent& e) {
   switch (mode_) {
   case UI_MODE_SPLASH:
+    // the outputs already run: so do the pots
+    if (fast_start_)
+      pot_coarse_value_[e.control_id] = e.data;
+    break;
   case UI_MODE_SPLASH_FOR_WAVEBANK_SELECT:
     break;
   case UI_MODE_ZOOM:
@@ -302,13 +372,23 @@ void Ui::OnPotChanged(const Event& e) {
     }
     break;
   case UI_MODE_NORMAL:
+  case UI_MODE_DIAGNOSTICS:
     last_touched_pot_ = e.control_id;
-    if (!catchup_state_[e.control_id]) {
-      pot_coarse_value_[e.control_id] = e.data;
-    } else if (abs(e.data - pot_coarse_value_[e.control_id]) < kCatchupThreshold) {
-      pot_coarse_value_[e.control_id] = e.data;
-      catchup_state_[e.control_id] = false;
+    if (catchup_state_[e.control_id]) {
+      // the pot catches up once it comes near the value it left, or
+      // goes past it: the events of a pot are coalesced, so when the main
+      // loop is late (e.g. during a flash write) it can jump over the
+      // window around the value from one event to the next
+      int32_t low = std::min<int32_t>(e.data,
+                                      pot_delivered_value_[e.control_id]);
+      int32_t high = std::max<int32_t>(e.data,
+                                       pot_delivered_value_[e.control_id]);
+      int32_t coarse = pot_coarse_value_[e.control_id];
+      catchup_state_[e.control_id] = coarse <= low - kCatchupThreshold ||
+        coarse >= high + kCatchupThreshold;
     }
+    if (!catchup_state_[e.control_id])
+      pot_coarse_value_[e.control_id] = e.data;
     break;
 
   case UI_MODE_WAVEBANK_SELECT:
@@ -317,6 +397,7 @@ void Ui::OnPotChanged(const Event& e) {
     selectWaveformFromPot(e.control_id, e.data);
     break;
   }
+  pot_delivered_value_[e.control_id] = e.data;
 }
 
 void Ui::selectRandomWaveformFromPot(uint16_t id, int32_t potVal)
@@ -403,12 +484,27 @@ void Ui::gotoNormalModeWithCatchupAndSaving()
     }
 
   mode_ = UI_MODE_NORMAL;
-  storage.ParsimoniousSave(&feat_mode_, SETTINGS_SIZE, &version_token_);
+  // done with the settings modes: save now, a power off could follow
+  settings_storage_.RequestImmediateSave();
+}
+
+void Ui::leaveSplash()
+{
+  mode_ = diagnostics_requested_ ? UI_MODE_DIAGNOSTICS : UI_MODE_NORMAL;
+  diagnostics_requested_ = false;
+  fast_start_ = false;
+  profiler_->Reset();
+#ifdef PROFILE_ISR
+  scheduler_->Reset();
+#endif
 }
 
-void Ui::DoEvents() {
-  while (queue_.available()) {
-    Event e = queue_.PullEvent();
+bool Ui::DoEvents() {
+  // the switch edges, and the latest event of each pot
+  TimedEvent events[kNumSwitchEdges + kNumControlSlots];
+  uint8_t num_events = control_events_.Snapshot(events);
+  for (uint8_t i=0; i<num_events; i++) {
+    const TimedEvent& e = events[i];
     if (e.control_type == CONTROL_SWITCH) {
       if (e.data == 0) {
         OnSwitchPressed(e);
@@ -419,9 +515,7 @@ void Ui::DoEvents() {
       OnPotChanged(e);
     }
   }
-  if (queue_.idle_time() > 500) {
-    queue_.Touch();
-  }
+  return settings_storage_.Poll();
 }
 
 }  // namespace batumi
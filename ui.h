@@ -33,17 +33,26 @@
 
 #include "stmlib/stmlib.h"
 
-#include "stmlib/ui/event_queue.h"
-
 #include "drivers/adc.h"
 #include "drivers/leds.h"
+#include "drivers/profiler.h"
+#include "drivers/scheduler.h"
+#include "drivers/settings_storage.h"
 #include "drivers/switches.h"
 
+#include "control_events.h"
 #include "lfo.h"
 
 namespace batumi {
 
 const uint8_t kFinePotDivider = 8;
+const uint8_t kNumPots = 4;
+
+// slots of the control events, one per pot, and length of the FIFO of
+// the switch edges: presses, holds and releases
+const uint8_t kPotSlot = 0;
+const uint8_t kNumControlSlots = kPotSlot + kNumPots;
+const uint8_t kNumSwitchEdges = 8;
 
 enum FeatureMode {
   FEAT_MODE_FREE,
@@ -58,7 +67,16 @@ enum UiMode {
   UI_MODE_NORMAL,
   UI_MODE_ZOOM,
   UI_MODE_WAVEBANK_SELECT,
-  UI_MODE_SPLASH_FOR_WAVEBANK_SELECT
+  UI_MODE_SPLASH_FOR_WAVEBANK_SELECT,
+  UI_MODE_DIAGNOSTICS
+};
+
+// pages of the diagnostics mode, cycled by short presses of the button
+enum DiagnosticsPage {
+  DIAGNOSTICS_PAGE_LOAD,
+  DIAGNOSTICS_PAGE_OVERRUNS,
+  DIAGNOSTICS_PAGE_TASKS,
+  DIAGNOSTICS_PAGE_LAST
 };
 
 enum WaveBank {
@@ -79,9 +97,13 @@ class Ui {
   
   void Init(Adc *adc);
   void Poll();
-  void DoEvents();
+  // true if it saved the settings to flash
+  bool DoEvents();
   void FlushEvents();
 
+  inline void set_profiler(Profiler* profiler) { profiler_ = profiler; }
+  inline void set_scheduler(Scheduler* scheduler) { scheduler_ = scheduler; }
+
   inline uint16_t coarse(uint8_t channel) {
     return pot_coarse_value_[channel];
   }
@@ -104,6 +126,8 @@ class Ui {
 
   inline FeatureMode feat_mode() const { return feat_mode_; }
   inline UiMode mode() const { return mode_; }
+  // true while the outputs run through the splash animation
+  inline bool fast_start() const { return fast_start_; }
   inline WaveBank bank(uint8_t channel) const { return bank_[channel]; }
   inline uint8_t shape() const {
     return (switches_.pressed(2) << 1) | switches_.pressed(1);
@@ -120,21 +144,28 @@ class Ui {
   inline bool sync_mode() const {
     return switches_.pressed(0);
   }
+  // true while the settings are being written to flash
+  inline bool saving() const {
+    return settings_storage_.busy();
+  }
 
  private:
-  void OnSwitchPressed(const stmlib::Event& e);
-  void OnSwitchReleased(const stmlib::Event& e);
-  void OnPotChanged(const stmlib::Event& e);
+  void OnSwitchPressed(const TimedEvent& e);
+  void OnSwitchReleased(const TimedEvent& e);
+  void OnPotChanged(const TimedEvent& e);
 
   void selectRandomWaveformFromPot(uint16_t id, int32_t val);
   void selectWaveformFromPot(uint16_t id, int32_t val);
   void clearZoomSettings();
   void clearAllHiddenSettings();
   void gotoNormalModeWithCatchupAndSaving();
+  void leaveSplash();
 
   uint16_t pot_value_[4];
   uint16_t pot_filtered_value_[4];
   uint16_t pot_coarse_value_[4];
+  // value of the last event of each pot handled by DoEvents()
+  uint16_t pot_delivered_value_[4];
   uint8_t last_touched_pot_;
   uint32_t press_time_[kNumSwitches];
   bool detect_very_long_press_[kNumSwitches];
@@ -143,12 +174,17 @@ class Ui {
 
   int32_t animation_counter_;
 
-  stmlib::EventQueue<32> queue_;
+  ControlEvents<kNumControlSlots, kNumSwitchEdges> control_events_;
 
   Leds leds_;
   Switches switches_;
   Adc *adc_;
+  Profiler *profiler_;
+  Scheduler *scheduler_;
   UiMode mode_;
+  bool diagnostics_requested_;
+  DiagnosticsPage diagnostics_page_;
+  bool fast_start_;
 
   FeatureMode feat_mode_;
   uint8_t padding[3];
@@ -170,7 +206,12 @@ class Ui {
     sizeof(pot_atten_value_) +
     sizeof(padding)
   };
+  // the settings are saved as a single record
+  typedef char settings_size_check_[
+      SETTINGS_SIZE <= kSettingsMaxSize ? 1 : -1];
 
+  SettingsStorage settings_storage_;
+  // only used to load the settings of earlier firmwares
   uint16_t version_token_;
 
   DISALLOW_COPY_AND_ASSIGN(Ui);
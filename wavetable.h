@@ -0,0 +1,100 @@
+// Copyright 2018 Takashi Matsuura.
+//
+// Author: Takashi Matsuura (fwthesteelleg@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Interpolated lookups in wavetables stored as a fraction of their
+// period, and mirrored to the full period.
+
+#ifndef BATUMI_WAVETABLE_H_
+#define BATUMI_WAVETABLE_H_
+
+#include "stmlib/stmlib.h"
+
+#include "drivers/audio_ram.h"
+
+namespace batumi {
+
+enum WavetableSymmetry {
+  WAVETABLE_QUARTER,		// first quarter of a sine-like shape,
+				// mirrored and negated
+  WAVETABLE_HALF,		// first half of a shape odd around the
+				// middle of the period (saw)
+};
+
+// Tables have a period of 2^size_bits samples; wav_sine has 1024.
+
+// Number of entries of a table.
+AUDIO_INLINE size_t WavetableSize(WavetableSymmetry symmetry,
+				  uint8_t size_bits) {
+  return (1UL << (size_bits - (symmetry == WAVETABLE_QUARTER ? 2 : 1))) + 1;
+}
+
+AUDIO_INLINE int16_t InterpolateQuarterWave(const int16_t* table,
+					    uint32_t phase,
+					    uint8_t size_bits = 10) {
+  const uint32_t quarter = 1UL << (size_bits - 2);
+  uint32_t i = (phase >> (32 - size_bits)) & (quarter - 1);
+  int32_t a, b;
+  if (phase & (1UL << 30)) {
+    a = table[quarter - i];
+    b = table[quarter - 1 - i];
+  } else {
+    a = table[i];
+    b = table[i + 1];
+  }
+  int32_t fraction = (phase >> (16 - size_bits)) & 0xffff;
+  int32_t x = a + ((b - a) * fraction >> 16);
+  return phase & (1UL << 31) ? -x : x;
+}
+
+AUDIO_INLINE int16_t InterpolateHalfWave(const int16_t* table,
+					 uint32_t phase,
+					 uint8_t size_bits = 10) {
+  const uint32_t half = 1UL << (size_bits - 1);
+  uint32_t i = (phase >> (32 - size_bits)) & (half - 1);
+  int32_t a, b;
+  if (phase & (1UL << 31)) {
+    a = table[half - i];
+    b = table[half - 1 - i];
+  } else {
+    a = table[i];
+    b = table[i + 1];
+  }
+  int32_t fraction = (phase >> (16 - size_bits)) & 0xffff;
+  int32_t x = a + ((b - a) * fraction >> 16);
+  return phase & (1UL << 31) ? -x : x;
+}
+
+template<WavetableSymmetry symmetry>
+AUDIO_INLINE int16_t InterpolateWave(const int16_t* table, uint32_t phase,
+				     uint8_t size_bits = 10) {
+  return symmetry == WAVETABLE_QUARTER
+    ? InterpolateQuarterWave(table, phase, size_bits)
+    : InterpolateHalfWave(table, phase, size_bits);
+}
+
+}  // namespace batumi
+
+#endif  // BATUMI_WAVETABLE_H_